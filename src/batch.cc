@@ -0,0 +1,164 @@
+/*
+ * FILE             $Id$
+ *
+ * PROJECT          KHTML JavaScript compress utility
+ *
+ * DESCRIPTION      Batch mode - many files in one process
+ *
+ * AUTHOR           agent <agent@local>
+ *
+ * LICENSE          see COPYING
+ *
+ * Copyright (C) Seznam.cz a.s. 2026
+ * All Rights Reserved
+ *
+ * HISTORY
+ *       2026-10-17 (agent)
+ *                  First draft.
+ */
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <pthread.h>
+#include <unistd.h>
+#include <string.h>
+#include <errno.h>
+
+#include "batch.h"
+
+namespace {
+
+/**
+ * @short state shared by all worker threads.
+ */
+struct Pool_t {
+    JobList_t *jobs;       //< jobs to process.
+    JobList_t::size_type next; //< index of next unprocessed job.
+    JobFunc_t func;        //< job callback.
+    void *arg;             //< user data of callback.
+    std::ostream *err;     //< stream for error messages.
+    int failed;            //< number of failed jobs.
+    pthread_mutex_t lock;  //< guards next, failed and err.
+};
+
+/**
+ * @short worker thread - takes jobs until there is none.
+ * @param data pool.
+ * @return nothing.
+ */
+void *worker(void *data) {
+    Pool_t *pool = static_cast<Pool_t *>(data);
+
+    while (true) {
+        // take next job
+        pthread_mutex_lock(&pool->lock);
+        if (pool->next >= pool->jobs->size()) {
+            pthread_mutex_unlock(&pool->lock);
+            break;
+        }
+        Job_t &job = (*pool->jobs)[pool->next++];
+        pthread_mutex_unlock(&pool->lock);
+
+        // process it
+        std::ostringstream log;
+        try {
+            job.status = pool->func(job, log, pool->arg);
+        } catch (const std::exception &e) {
+            log << "ERR: " << e.what() << std::endl;
+            job.status = EXIT_FAILURE;
+        }
+        job.log = log.str();
+
+        // report it
+        pthread_mutex_lock(&pool->lock);
+        if (job.status != EXIT_SUCCESS)
+            ++pool->failed;
+        if (!job.log.empty())
+            *pool->err << job.from << ":" << std::endl << job.log
+                << std::flush;
+        pthread_mutex_unlock(&pool->lock);
+    }
+    return 0;
+}
+
+} // namespace
+
+// read input/output pairs from manifest
+bool readManifest(const std::string &manifest, JobList_t &jobs,
+                  std::ostream &err)
+{
+    std::ifstream file;
+    std::istream *in = &std::cin;
+    if (manifest != "-") {
+        file.open(manifest.c_str());
+        if (!file) {
+            err << "Cannot open manifest: " << manifest << "." << std::endl;
+            err << strerror(errno) << std::endl;
+            return false;
+        }
+        in = &file;
+    }
+
+    std::string line;
+    for (int lineNo = 1; std::getline(*in, line); ++lineNo) {
+        std::istringstream is(line);
+        std::string from, to, rest;
+        if (!(is >> from) || (from[0] == '#'))
+            continue;
+        if (!(is >> to) || (is >> rest)) {
+            err << manifest << ":" << lineNo
+                << ": expected input and output file." << std::endl;
+            return false;
+        }
+        jobs.push_back(Job_t(from, to));
+    }
+    return true;
+}
+
+// number of online processors
+int cpuCount() {
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count > 0)? count: 1;
+}
+
+// run jobs on pool of worker threads
+int runBatch(JobList_t &jobs, int workers, JobFunc_t func, void *arg,
+             std::ostream &err)
+{
+    Pool_t pool;
+    pool.jobs = &jobs;
+    pool.next = 0;
+    pool.func = func;
+    pool.arg = arg;
+    pool.err = &err;
+    pool.failed = 0;
+    pthread_mutex_init(&pool.lock, 0);
+
+    // no more threads than jobs
+    if (workers > (signed)jobs.size())
+        workers = jobs.size();
+    if (workers < 1)
+        workers = 1;
+
+    // spawn workers, the main thread is one of them
+    std::vector<pthread_t> threads;
+    for (int i = 1; i < workers; ++i) {
+        pthread_t thread;
+        if (pthread_create(&thread, 0, worker, &pool)) {
+            err << "Cannot create worker thread." << std::endl;
+            break;
+        }
+        threads.push_back(thread);
+    }
+    worker(&pool);
+
+    // wait for them
+    for (std::vector<pthread_t>::iterator ithread = threads.begin();
+            ithread != threads.end(); ++ithread)
+        pthread_join(*ithread, 0);
+
+    pthread_mutex_destroy(&pool.lock);
+    return pool.failed;
+}
+
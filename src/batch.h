@@ -0,0 +1,94 @@
+/*
+ * FILE             $Id$
+ *
+ * PROJECT          KHTML JavaScript compress utility
+ *
+ * DESCRIPTION      Batch mode - many files in one process
+ *
+ * AUTHOR           agent <agent@local>
+ *
+ * LICENSE          see COPYING
+ *
+ * Copyright (C) Seznam.cz a.s. 2026
+ * All Rights Reserved
+ *
+ * HISTORY
+ *       2026-10-17 (agent)
+ *                  First draft.
+ */
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <cstdlib>
+
+/**
+ * @short one input/output pair of batch.
+ */
+struct Job_t {
+    /**
+     * @short create new job.
+     * @param from read code from this file.
+     * @param to dump code to this file.
+     */
+    Job_t(const std::string &from, const std::string &to)
+        : from(from), to(to), status(EXIT_SUCCESS)
+    {}
+
+    std::string from; //< read code from this file.
+    std::string to;   //< dump code to this file.
+    int status;       //< exit status of job.
+    std::string log;  //< error messages of job.
+};
+
+typedef std::vector<Job_t> JobList_t;
+
+/**
+ * @short job callback - transform one file, errors write to err.
+ * @param job job to process.
+ * @param err stream for error messages.
+ * @param arg user data given to runBatch.
+ * @return EXIT_SUCCESS or EXIT_FAILURE.
+ */
+typedef int (*JobFunc_t)(const Job_t &job, std::ostream &err, void *arg);
+
+/**
+ * @short read input/output pairs from manifest file.
+ *
+ * Each non empty line contains input and output file separated by
+ * white spaces, lines starting with # are ignored.
+ *
+ * @param manifest path to manifest file ("-" means stdin).
+ * @param jobs append jobs here.
+ * @param err stream for error messages.
+ * @return true if manifest was read.
+ */
+bool readManifest(const std::string &manifest, JobList_t &jobs,
+                  std::ostream &err);
+
+/**
+ * @short return number of online processors.
+ * @return number of online processors (at least one).
+ */
+int cpuCount();
+
+/**
+ * @short run all jobs on pool of worker threads.
+ *
+ * Error log of each job is written to err as soon as the job is done.
+ *
+ * @param jobs jobs to process.
+ * @param workers number of worker threads.
+ * @param func job callback.
+ * @param arg user data passed to callback.
+ * @param err stream for error messages.
+ * @return number of failed jobs.
+ */
+int runBatch(JobList_t &jobs, int workers, JobFunc_t func, void *arg,
+             std::ostream &err);
+
+#endif /* BATCH_H */
+
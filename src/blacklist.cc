@@ -0,0 +1,252 @@
+/*
+ * FILE             $Id$
+ *
+ * PROJECT          KHTML JavaScript compress utility
+ *
+ * DESCRIPTION      Identifiers blacklist.
+ *
+ * AUTHOR           agent <agent@local>
+ *
+ * LICENSE          see COPYING
+ *
+ * Copyright (C) Seznam.cz a.s. 2026
+ * All Rights Reserved
+ *
+ * HISTORY
+ *       2026-10-17 (agent)
+ *                  First draft.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include "blacklist.h"
+#include "util.h"
+#include "kjs/lookup.h"
+
+using namespace KJS;
+
+namespace {
+
+/**
+ * @short reserved words and names of host objects, never obfuscated.
+ */
+constexpr const char *SYSTEM_BLACKLIST[] = {
+    "abstract",
+    "else",
+    "instanceof",
+    "switch",
+    "boolean",
+    "enum",
+    "int",
+    "synchronized",
+    "break",
+    "export",
+    "interface",
+    "this",
+    "byte",
+    "extends",
+    "long",
+    "throw",
+    "case",
+    "false",
+    "native",
+    "throws",
+    "catch",
+    "final",
+    "new",
+    "transient",
+    "char",
+    "finally",
+    "null",
+    "true",
+    "class",
+    "float",
+    "package",
+    "try",
+    "const",
+    "for",
+    "private",
+    "typeof",
+    "continue",
+    "function",
+    "protected",
+    "var",
+    "debugger",
+    "goto",
+    "public",
+    "void",
+    "default",
+    "if",
+    "return",
+    "volatile",
+    "delete",
+    "implements",
+    "short",
+    "while",
+    "do",
+    "import",
+    "static",
+    "with",
+    "double",
+    "in",
+    "super",
+    "undefined",
+    "arguments",
+    "alert",
+    "hidden",
+    "outerWidth",
+    "all",
+    "history",
+    "packages",
+    "anchor",
+    "image",
+    "pageXOffset",
+    "anchors",
+    "images",
+    "pageYOffset",
+    "area",
+    "isNaN",
+    "parent",
+    "array",
+    "java",
+    "parseFloat",
+    "assign",
+    "JavaArray",
+    "parseInt",
+    "blur",
+    "JavaClass",
+    "password",
+    "button",
+    "JavaObject",
+    "pkcs11",
+    "checkbox",
+    "JavaPackage",
+    "plugin",
+    "clearTimeout",
+    "innerHeight",
+    "prompt",
+    "clientInformation",
+    "innerWidth",
+    "prototype",
+    "close",
+    "layer",
+    "radio",
+    "closed",
+    "layers",
+    "reset",
+    "confirm",
+    "length",
+    "screenX",
+    "crypto",
+    "link",
+    "screenY",
+    "date",
+    "location",
+    "scroll",
+    "defaultStatus",
+    "Math",
+    "secure",
+    "document",
+    "mimeTypes",
+    "select",
+    "element",
+    "name",
+    "self",
+    "elements",
+    "navigate",
+    "setTimeout",
+    "embed",
+    "navigator",
+    "status",
+    "embeds",
+    "netscape",
+    "String",
+    "escape",
+    "Number",
+    "submit",
+    "eval",
+    "Object",
+    "sun",
+    "event",
+    "offscreenBuffering",
+    "taint",
+    "fileUpload",
+    "onblur",
+    "text",
+    "focus",
+    "onerror",
+    "textarea",
+    "form",
+    "onfocus",
+    "top",
+    "forms",
+    "onload",
+    "toString",
+    "frame",
+    "onunload",
+    "unescape",
+    "frames",
+    "open",
+    "untaint",
+    "frameRate",
+    "opener",
+    "valueOf",
+    "option",
+    "window",
+    "getClass",
+    "outerHeight",
+    "setInterval",
+    "clearInterval"
+};
+
+typedef PerfectHash<sizeof(SYSTEM_BLACKLIST) / sizeof(*SYSTEM_BLACKLIST)>
+    SystemBlacklist_t;
+
+/**
+ * @short system blacklist, built by compiler.
+ */
+constexpr SystemBlacklist_t systemBlacklist(SYSTEM_BLACKLIST);
+
+} // namespace
+
+/**
+ * @short return true if identifier is blacklisted.
+ * @param id identifier.
+ * @return true if identifier is blacklisted.
+ */
+bool Blacklist_t::find(const Identifier &id) {
+    return (systemBlacklist.find(id) >= 0) || user.find(id);
+}
+
+/**
+ * @short add identifier to blacklist.
+ * @param id identifier.
+ */
+void Blacklist_t::insert(const Identifier &id) {
+    if (systemBlacklist.find(id) < 0)
+        user.insert(id, true);
+}
+
+/**
+ * @short dump all blacklisted names to stream, sorted, one per line.
+ * @param os output stream.
+ * @param blacklist blacklist.
+ * @return output stream.
+ */
+std::ostream &operator<<(std::ostream &os, const Blacklist_t &blacklist) {
+    std::vector<std::string> names;
+    for (unsigned int i = 0; i < systemBlacklist.size(); ++i)
+        names.push_back(systemBlacklist.key(i));
+    for (Blacklist_t::IdentifierSet_t::EntryList_t::const_iterator
+            iset = blacklist.user.entries().begin();
+            iset != blacklist.user.entries().end(); ++iset)
+        if (!iset->key.isNull())
+            names.push_back(utf8(iset->key.ustring()));
+    std::sort(names.begin(), names.end());
+    for (std::vector<std::string>::const_iterator iname = names.begin();
+            iname != names.end(); ++iname)
+        os << *iname << std::endl;
+    return os;
+}
+
@@ -17,176 +17,50 @@
  *                  First draft.
  */
 
-const char *SYSTEM_BLACKLIST[] = {
-    "abstract",
-    "else",
-    "instanceof",
-    "switch",
-    "boolean",
-    "enum",
-    "int",
-    "synchronized",
-    "break",
-    "export",
-    "interface",
-    "this",
-    "byte",
-    "extends",
-    "long",
-    "throw",
-    "case",
-    "false",
-    "native",
-    "throws",
-    "catch",
-    "final",
-    "new",
-    "transient",
-    "char",
-    "finally",
-    "null",
-    "true",
-    "class",
-    "float",
-    "package",
-    "try",
-    "const",
-    "for",
-    "private",
-    "typeof",
-    "continue",
-    "function",
-    "protected",
-    "var",
-    "debugger",
-    "goto",
-    "public",
-    "void",
-    "default",
-    "if",
-    "return",
-    "volatile",
-    "delete",
-    "implements",
-    "short",
-    "while",
-    "do",
-    "import",
-    "static",
-    "with",
-    "double",
-    "in",
-    "super",
-    "undefined",
-    "arguments",
-    "alert",
-    "hidden",
-    "outerWidth",
-    "all",
-    "history",
-    "packages",
-    "anchor",
-    "image",
-    "pageXOffset",
-    "anchors",
-    "images",
-    "pageYOffset",
-    "area",
-    "isNaN",
-    "parent",
-    "array",
-    "java",
-    "parseFloat",
-    "assign",
-    "JavaArray",
-    "parseInt",
-    "blur",
-    "JavaClass",
-    "password",
-    "button",
-    "JavaObject",
-    "pkcs11",
-    "checkbox",
-    "JavaPackage",
-    "plugin",
-    "clearTimeout",
-    "innerHeight",
-    "prompt",
-    "clientInformation",
-    "innerWidth",
-    "prototype",
-    "close",
-    "layer",
-    "radio",
-    "closed",
-    "layers",
-    "reset",
-    "confirm",
-    "length",
-    "screenX",
-    "crypto",
-    "link",
-    "screenY",
-    "date",
-    "location",
-    "scroll",
-    "defaultStatus",
-    "Math",
-    "secure",
-    "document",
-    "mimeTypes",
-    "select",
-    "element",
-    "name",
-    "self",
-    "elements",
-    "navigate",
-    "setTimeout",
-    "embed",
-    "navigator",
-    "status",
-    "embeds",
-    "netscape",
-    "String",
-    "escape",
-    "Number",
-    "submit",
-    "eval",
-    "Object",
-    "sun",
-    "event",
-    "offscreenBuffering",
-    "taint",
-    "fileUpload",
-    "onblur",
-    "text",
-    "focus",
-    "onerror",
-    "textarea",
-    "form",
-    "onfocus",
-    "top",
-    "forms",
-    "onload",
-    "toString",
-    "frame",
-    "onunload",
-    "unescape",
-    "frames",
-    "open",
-    "untaint",
-    "frameRate",
-    "opener",
-    "valueOf",
-    "function",
-    "option",
-    "window",
-    "getClass",
-    "outerHeight",
-    "setInterval",
-    "clearInterval",
-    "setTimeout",
-    "clearTimeout",
-    0 // sentinel
+#ifndef BLACKLIST_H
+#define BLACKLIST_H
+
+#include <iostream>
+
+#include "idtable.h"
+
+/**
+ * @short identifiers which must not be obfuscated.
+ *
+ * System names (reserved words, host objects) live in perfect hash table
+ * built at compile time, names added at runtime (-b file, negative
+ * answers) in table keyed by interned identifier. Both are asked by one
+ * find().
+ */
+class Blacklist_t {
+public:
+    typedef IdentifierTable_t<bool> IdentifierSet_t;
+
+    /**
+     * @short return true if identifier is blacklisted.
+     * @param id identifier.
+     * @return true if identifier is blacklisted.
+     */
+    bool find(const KJS::Identifier &id);
+
+    /**
+     * @short add identifier to blacklist.
+     * @param id identifier.
+     */
+    void insert(const KJS::Identifier &id);
+
+    /**
+     * @short dump all blacklisted names to stream, sorted, one per line.
+     * @param os output stream.
+     * @param blacklist blacklist.
+     * @return output stream.
+     */
+    friend std::ostream &operator<<(std::ostream &os,
+                                    const Blacklist_t &blacklist);
+
+private:
+    IdentifierSet_t user; //< names added at runtime.
 };
 
+#endif /* BLACKLIST_H */
+
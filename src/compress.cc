@@ -21,35 +21,52 @@
 #include <iostream>
 #include <fstream>
 #include <iterator>
+#include <vector>
 #include <string.h>
 #include <errno.h>
 #include <algorithm>
-#include <typeinfo>
 
 #include "util.h"
 #include "compress.h"
-#include "blacklist.h"
-#include "kjs/nodes.h"
+#include "output.h"
+#include "emit.h"
 
 using namespace KJS;
 
 namespace {
 
-std::ostream &operator<<(std::ostream &os,
-                         const CompressStream_t::IdentifierMap_t &idmap) {
+typedef std::vector<std::pair<std::string, std::string> > NamePairList_t;
+
+/**
+ * @short return obfuscated identifiers sorted by origin name.
+ * @param idmap output names of identifiers.
+ * @return pairs of origin and obfuscated name.
+ */
+NamePairList_t obfuscated(const CompressStream_t::IdentifierMap_t &idmap) {
+    NamePairList_t names;
+    for (CompressStream_t::IdentifierMap_t::EntryList_t::const_iterator
+            iid = idmap.entries().begin(); iid != idmap.entries().end(); ++iid)
+        if (!iid->key.isNull() && iid->value.obfuscated)
+            names.push_back(std::make_pair(utf8(iid->key.ustring()),
+                                           iid->value.name));
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+std::ostream &operator<<(std::ostream &os, const NamePairList_t &names) {
     // simple dump map to stream
-    for (CompressStream_t::IdentifierMap_t::const_iterator iid = idmap.begin();
-            iid != idmap.end(); ++iid)
-        os << iid->second << ": " << iid->first << std::endl;
+    for (NamePairList_t::const_iterator iname = names.begin();
+            iname != names.end(); ++iname)
+        os << iname->second << ": " << iname->first << std::endl;
     return os;
 }
 
 std::ostream &operator<<(std::ostream &os,
-                         const CompressStream_t::StringSet_t &sset) {
-    // simple dump set to stream
-    for (CompressStream_t::StringSet_t::const_iterator isset = sset.begin();
-            isset != sset.end(); ++isset)
-        os << *isset << std::endl;
+                         const CompressStream_t::DecisionMap_t &dmap) {
+    // one answer per line
+    for (CompressStream_t::DecisionMap_t::const_iterator idmap = dmap.begin();
+            idmap != dmap.end(); ++idmap)
+        os << idmap->second << ' ' << idmap->first << std::endl;
     return os;
 }
 
@@ -90,115 +107,142 @@ std::string Base62Int_t::str() const {
     return s;
 }
 
-CompressStream_t &operator<<(CompressStream_t &cs, const KJS::Node *node) {
-    if (node) node->streamTo(cs);
-    return cs;
-}
+template <bool ENDL, bool OBFUSCATE, bool COMMENT>
+class CompressStream_t::Format_t {
+public:
+    static const bool PRETTY = false;
 
-CompressStream_t &operator<<(CompressStream_t &cs,
-                             const KJS::Identifier &value) {
-    // dump identfier
-    std::string id = cs.getIdFor(value.ustring().ascii());
-    cs.os << id;
+    Format_t(CompressStream_t &cs): cs(cs) {}
 
-    // add origin identfier
-    if (cs.comment)
-        cs.os << "/*" << value.ustring().ascii() << "*/";
+    Output_t &output() { return cs.os;}
 
-    return cs;
-}
+    void identifier(const Identifier &id) {
+        // dump identfier
+        if (OBFUSCATE)
+            cs.os << cs.getIdFor(id);
+        else dump(cs.os, id.ustring());
 
-CompressStream_t &operator<<(CompressStream_t &cs,
-                             const std::string &value) {
-    cs.os << value;
-    return cs;
-}
+        // add origin identfier
+        if (COMMENT) {
+            cs.os << "/*";
+            dump(cs.os, id.ustring());
+            cs.os << "*/";
+        }
+    }
 
-CompressStream_t &operator<<(CompressStream_t &cs,
-                             const char *value) {
-    cs.os << value;
-    return cs;
-}
+    void endl() { if (ENDL) cs.os << '\n';}
+    void indent() {}
+    void unindent() {}
 
-CompressStream_t &operator<<(CompressStream_t &cs,
-                             const char &value) {
-    cs.os << value;
-    return cs;
-}
+private:
+    CompressStream_t &cs; //< names of identifiers and buffer.
+};
 
-CompressStream_t &operator<<(CompressStream_t &cs,
-                             CompressStream_t::Format_t value) {
-    if (cs.endl && (value == CompressStream_t::ENDL))
-        cs.os << std::endl;
-    return cs;
+template <bool ENDL, bool OBFUSCATE, bool COMMENT>
+void CompressStream_t::emit(const KJS::Node *node) {
+    Format_t<ENDL, OBFUSCATE, COMMENT> format(*this);
+    Emitter_t::emit(format, node);
 }
 
 /**
  * @short dump node tree to stream and return stream.
  * @param node node tree to dump.
+ * @param out write compressed javascript source to this buffer.
  * @param obfuscate do obfuscate.
  * @param comment write origin Identifier in comment.
  * @param ask ask user whether obfuscate identifier.
  * @param prefix dont obfuscate identfiers with prefix
- * @param blacklistDump dump blacklist to this file.
+ * @param userBlacklist read blacklisted identifiers from this file.
+ * @param decisionsFile replay answers from this file, record new ones with
+ *        ask.
  * @param endl  write endl to buffer.
  */
-CompressStream_t::CompressStream_t(const Node *node, bool obfuscate,
-        bool comment, bool ask, const std::string &prefix,
-        const std::string &userBlacklist, const std::string &blacklistDump,
+CompressStream_t::CompressStream_t(const Node *node, Output_t &out,
+        bool obfuscate, bool comment, bool ask, const std::string &prefix,
+        const std::string &userBlacklist, const std::string &decisionsFile,
         bool endl)
-    : endl(endl), obfuscate(obfuscate), comment(comment), ask(ask),
-      prefix(prefix), blacklistDump(blacklistDump), lastId(0)
+    : os(out), ask(ask), prefix(prefix),
+      record(ask && !decisionsFile.empty()), lastId(0)
 {
-    // read system blacklist
-    std::copy(SYSTEM_BLACKLIST,
-              SYSTEM_BLACKLIST + sizeof(SYSTEM_BLACKLIST) / sizeof(char *) - 1,
-              std::inserter(blacklist, blacklist.begin()));
-
     // read user blacklist
     if (!userBlacklist.empty()) {
         std::ifstream ubl(userBlacklist.c_str());
         if (ubl) {
-            std::copy(std::istream_iterator<std::string>(ubl),
-                      std::istream_iterator<std::string>(),
-                      std::inserter(blacklist, blacklist.begin()));
+            std::string name;
+            while (ubl >> name)
+                addToBlacklist(name);
         } else {
             std::cerr << "Cannot read blacklist." << std::endl;
             std::cerr << strerror(errno) << std::endl;
         }
     }
 
-    // dump node tree
-    if (node) node->streamTo(*this);
+    // read answers of previous run, missing file means first run
+    if (!decisionsFile.empty()) {
+        std::ifstream dec(decisionsFile.c_str());
+        if (dec) {
+            char ch;
+            std::string id;
+            while (dec >> ch >> id)
+                decisions[id] = ch;
+        } else if (errno != ENOENT) {
+            std::cerr << "Cannot read decisions." << std::endl;
+            std::cerr << strerror(errno) << std::endl;
+        }
+    }
+
+    // dump node tree, options pick the emitter
+    typedef void (CompressStream_t::*Emit_t)(const KJS::Node *);
+    static const Emit_t emitters[] = {
+        &CompressStream_t::emit<false, false, false>,
+        &CompressStream_t::emit<false, false, true>,
+        &CompressStream_t::emit<false, true, false>,
+        &CompressStream_t::emit<false, true, true>,
+        &CompressStream_t::emit<true, false, false>,
+        &CompressStream_t::emit<true, false, true>,
+        &CompressStream_t::emit<true, true, false>,
+        &CompressStream_t::emit<true, true, true>,
+    };
+    (this->*emitters[4 * endl + 2 * obfuscate + comment])(node);
 }
 
 /**
- * @short dump obfuscate log and destroy object.
+ * @short dump obfuscate log, one line per obfuscated identifier.
+ * @param os output stream.
+ * @return true if any identifier was obfuscated.
  */
-CompressStream_t::~CompressStream_t() {
-    // dump obfuscate log
-    if (!idmap.empty()) {
-        std::ofstream fo("kjscompress.log");
-        if (fo) {
-            fo << idmap;
-            fo.close();
-        } else {
-            std::cerr << "Cannot write obfuscate log." << std::endl;
-            std::cerr << strerror(errno) << std::endl;
-        }
-    }
+bool CompressStream_t::dumpLog(std::ostream &os) const {
+    NamePairList_t names = obfuscated(idmap);
+    os << names;
+    return !names.empty();
+}
 
-    // dump blacklist
-    if (!blacklistDump.empty()) {
-        std::ofstream fb(blacklistDump.c_str());
-        if (fb) {
-            fb << blacklist;
-            fb.close();
-        } else {
-            std::cerr << "Cannot write blacklist." << std::endl;
-            std::cerr << strerror(errno) << std::endl;
-        }
-    }
+/**
+ * @short dump blacklisted identifiers, one per line.
+ * @param os output stream.
+ */
+void CompressStream_t::dumpBlacklist(std::ostream &os) const {
+    os << blacklist;
+}
+
+/**
+ * @short dump answers recorded with ask, one "y id" or "n id" per line.
+ * @param os output stream.
+ * @return true if answers were recorded.
+ */
+bool CompressStream_t::dumpDecisions(std::ostream &os) const {
+    if (!record)
+        return false;
+    os << decisions;
+    return true;
+}
+
+/**
+ * @short add identifier from blacklist file.
+ * @param name identifier (UTF-8).
+ */
+void CompressStream_t::addToBlacklist(const std::string &name) {
+    blacklist.insert(Identifier(decode(name.data(), name.size())));
 }
 
 /**
@@ -206,32 +250,31 @@ CompressStream_t::~CompressStream_t() {
  * @param identifier which identifier
  * @return id for Identifier.
  */
-std::string CompressStream_t::getIdFor(const std::string &id) {
-    // is obfuscator allowed?
-    if (!obfuscate)
-        return id;
+const std::string &CompressStream_t::getIdFor(const Identifier &identifier) {
+    // name already decided
+    Name_t *name = idmap.find(identifier);
+    if (name)
+        return name->name;
+    std::string id = utf8(identifier.ustring());
 
     // is identifier blacklisted by prefix?
     if (!prefix.empty() && (id.compare(0, prefix.size(), prefix) == 0))
-        return id;
+        return idmap.insert(identifier, Name_t(id)).name;
 
     // is id on blacklist?
-    CompressStream_t::StringSet_t::iterator ibl = blacklist.find(id);
-    if (ibl != blacklist.end())
-        return id;
+    if (blacklist.find(identifier))
+        return idmap.insert(identifier, Name_t(id)).name;
 
-    // find old obfuscated identifiers
-    CompressStream_t::IdentifierMap_t::iterator iid = idmap.find(id);
-    if (iid != idmap.end())
-        return iid->second;
+    // answered in previous run? (with or without ask)
+    CompressStream_t::DecisionMap_t::iterator idec = decisions.find(id);
+    if ((idec != decisions.end()) && (idec->second == 'n'))
+        return idmap.insert(identifier, Name_t(id)).name;
 
     // ask user?
-    if (ask) {
+    if (ask && (idec == decisions.end())) {
         // dump some bit of code
-        std::string code = os.str();
         std::cerr << "--------------------------------------" << std::endl
-            << code.substr((((signed)code.size() - 30) > 0)?
-                    (signed)code.size() - 30: 0) << id
+            << os.tail(30) << id
             << std::endl << "--------------------------------------" << std::endl
             << "Obfuscate `" << id << "' identfier? (y/n/a)" << std::endl;
 
@@ -239,693 +282,19 @@ std::string CompressStream_t::getIdFor(const std::string &id) {
         char ch;
         std::cin >> ch;
         if (((ch != 'Y') && (ch != 'y')) && ((ch != 'a') && (ch != 'A'))) {
-            blacklist.insert(id);
-            return id;
+            blacklist.insert(identifier);
+            if (record) decisions[id] = 'n';
+            return idmap.insert(identifier, Name_t(id)).name;
         }
         if ((ch == 'a') || (ch == 'A'))
             ask = false;
     }
+    if (record) decisions[id] = 'y';
 
     // generate new
     std::string nid = "__" + lastId.str();
     ++lastId;
 
-    // save them
-    idmap.insert(std::make_pair(id, nid));
-
-    // return it
-    return nid;
-}
-
-/*
- * Node dump rules
- */
-void NullNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "NullNode" << std::endl;
-#endif
-    os << "null";
-}
-
-void BooleanNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "BooleanNode" << std::endl;
-#endif
-    os << (val ? "true" : "false");
-}
-
-void NumberNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "NumberNode" << std::endl;
-#endif
-    os << UString::from(val).ascii();
-}
-
-void StringNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "StringNode" << std::endl;
-#endif
-    os << '"' << escape(val.ascii()) << '"';
-}
-
-void RegExpNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "RegExpNode" << std::endl;
-#endif
-    os << "/" << pattern.ascii();
-    os << "/" << flags.ascii();
-}
-
-void ThisNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "ThisNode" << std::endl;
-#endif
-    os << "this";
-}
-
-void ResolveNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "ResolveNode" << std::endl;
-#endif
-    os << ident;
-}
-
-void GroupNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "GroupNode" << std::endl;
-#endif
-    os << "(" << group << ")";
-}
-
-void ElementNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "ElementNode" << std::endl;
-#endif
-    for (const ElementNode *n = this; n; n = n->list) {
-        for (int i = 0; i < n->elision; i++)
-            os << ",";
-        os << n->node;
-        if (n->list)
-            os << ",";
-    }
-}
-
-void ArrayNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "ArrayNode" << std::endl;
-#endif
-    os << "[" << element;
-    for (int i = 0; i < elision; i++)
-        os << ",";
-    os << "]";
-}
-
-void ObjectLiteralNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "ObjectLiteralNode" << std::endl;
-#endif
-    if (list)
-        os << "{" << list << "}";
-    else
-        os << "{}";
-}
-
-void PropertyValueNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "PropertyValueNode" << std::endl;
-#endif
-    int count = 0;
-    for (const PropertyValueNode *n = this; n; n = n->list)
-        os << ((count++)? ",": "")
-            << "\"" << n->name << "\"" << ":" << n->assign;
-}
-
-void PropertyNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "PropertyNode" << std::endl;
-#endif
-    if (str.isNull())
-        os << UString::from(numeric).ascii();
-    else
-        os << escape(str.ascii());
-}
-
-void AccessorNode1::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "AccessorNode1" << std::endl;
-#endif
-    os << expr1 << "[" << expr2 << "]";
-}
-
-void AccessorNode2::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "AccessorNode2" << std::endl;
-#endif
-    os << expr << "." << ident;
-}
-
-void ArgumentListNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "ArgumentListNode" << std::endl;
-#endif
-    os << expr;
-    for (ArgumentListNode *n = list; n; n = n->list)
-        os << "," << n->expr;
-}
-
-void ArgumentsNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "ArgumentsNode" << std::endl;
-#endif
-    os << "(" << list << ")";
-}
-
-void NewExprNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "NewExprNode" << std::endl;
-#endif
-    os << "new " << expr << args;
-}
-
-void FunctionCallNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "FunctionCallNode" << std::endl;
-#endif
-    os << expr << args;
-}
-
-void PostfixNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "PostfixNode" << std::endl;
-#endif
-    os << expr;
-    if (oper == OpPlusPlus)
-        os << "++";
-    else
-        os << "--";
-}
-
-void DeleteNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "DeleteNode" << std::endl;
-#endif
-    os << "delete " << expr;
-}
-
-void VoidNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "VoidNode" << std::endl;
-#endif
-    os << "void " << expr;
-}
-
-void TypeOfNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "TypeOfNode" << std::endl;
-#endif
-    os << "typeof " << expr;
-}
-
-void PrefixNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "PrefixNode" << std::endl;
-#endif
-    os << (oper == OpPlusPlus ? "++" : "--") << expr;
-}
-
-void UnaryPlusNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "UnaryPlusNode" << std::endl;
-#endif
-    os << "+" << expr;
-}
-
-void NegateNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "NegateNode" << std::endl;
-#endif
-    os << "-" << expr;
+    // save and return it
+    return idmap.insert(identifier, Name_t(nid, true)).name;
 }
-
-void BitwiseNotNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "BitwiseNotNode" << std::endl;
-#endif
-    os << "~" << expr;
-}
-
-void LogicalNotNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "LogicalNotNode" << std::endl;
-#endif
-    os << "!" << expr;
-}
-
-void MultNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "MultNode" << std::endl;
-#endif
-    os << term1;
-    if (typeid(*term1) == typeid(KJS::PostfixNode))
-        os << " ";
-    os << oper;
-    if (typeid(*term2) == typeid(KJS::PrefixNode))
-        os << " ";
-    os << term2;
-}
-
-void AddNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "AddNode" << std::endl;
-#endif
-    os << term1;
-    if (typeid(*term1) == typeid(KJS::PostfixNode))
-        os << " ";
-    os << oper;
-    if (typeid(*term2) == typeid(KJS::PrefixNode))
-        os << " ";
-    os << term2;
-}
-
-void AppendStringNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "AppendStringNode" << std::endl;
-#endif
-    os << term << "+" << '"' << escape(str.ascii()) << '"';
-}
-
-void ShiftNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "ShiftNode" << std::endl;
-#endif
-    os << term1;
-    if (oper == OpLShift)
-        os << "<<";
-    else if (oper == OpRShift)
-        os << ">>";
-    else
-        os << ">>>";
-    os << term2;
-}
-
-void RelationalNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "RelationalNode" << std::endl;
-#endif
-    os << expr1;
-    switch (oper) {
-    case OpLess:
-        os << "<";
-        break;
-    case OpGreater:
-        os << ">";
-        break;
-    case OpLessEq:
-        os << "<=";
-        break;
-    case OpGreaterEq:
-        os << ">=";
-        break;
-    case OpInstanceOf:
-        os << " instanceof ";
-        break;
-    case OpIn:
-        os << " in ";
-        break;
-    default:
-        ;
-    }
-    os << expr2;
-}
-
-void EqualNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "EqualNode" << std::endl;
-#endif
-    os << expr1;
-    switch (oper) {
-    case OpEqEq:
-        os << "==";
-        break;
-    case OpNotEq:
-        os << "!=";
-        break;
-    case OpStrEq:
-        os << "===";
-        break;
-    case OpStrNEq:
-        os << "!==";
-        break;
-    default:
-        ;
-    }
-    os << expr2;
-}
-
-void BitOperNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "BitOperNode" << std::endl;
-#endif
-    os << expr1;
-    if (oper == OpBitAnd)
-        os << "&";
-    else if (oper == OpBitXOr)
-        os << "^";
-    else
-        os << "|";
-    os << expr2;
-}
-
-void BinaryLogicalNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "BinaryLogicalNode" << std::endl;
-#endif
-    os << expr1 << (oper == OpAnd ? "&&" : "||") << expr2;
-}
-
-void ConditionalNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "ConditionalNode" << std::endl;
-#endif
-    os << logical << "?" << expr1 << ":" << expr2;
-}
-
-void AssignNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "AssignNode" << std::endl;
-#endif
-    os << left;
-    const char *opStr;
-    switch (oper) {
-    case OpEqual:
-        opStr = "=";
-        break;
-    case OpMultEq:
-        opStr = "*=";
-        break;
-    case OpDivEq:
-        opStr = "/=";
-        break;
-    case OpPlusEq:
-        opStr = "+=";
-        break;
-    case OpMinusEq:
-        opStr = "-=";
-        break;
-    case OpLShift:
-        opStr = "<<=";
-        break;
-    case OpRShift:
-        opStr = ">>=";
-        break;
-    case OpURShift:
-        opStr = ">>=";
-        break;
-    case OpAndEq:
-        opStr = "&=";
-        break;
-    case OpXOrEq:
-        opStr = "^=";
-        break;
-    case OpOrEq:
-        opStr = "|=";
-        break;
-    case OpModEq:
-        opStr = "%=";
-        break;
-    default:
-        opStr = "?=";
-    }
-    os << opStr << expr;
-}
-
-void CommaNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "CommaNode" << std::endl;
-#endif
-    os << expr1 << "," << expr2;
-}
-
-void StatListNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "StatListNode" << std::endl;
-#endif
-    for (const StatListNode *n = this; n; n = n->list)
-        os << n->statement;
-}
-
-void AssignExprNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "AssignExprNode" << std::endl;
-#endif
-    os << "=" << expr;
-}
-
-void VarDeclNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "VarDeclNode" << std::endl;
-#endif
-    os << ident << init;
-}
-
-void VarDeclListNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "VarDeclListNode" << std::endl;
-#endif
-    os << var;
-    for (VarDeclListNode *n = list; n; n = n->list)
-        os << "," << n->var;
-}
-
-void VarStatementNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "VarStatementNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << "var " << list << ";";
-}
-
-void BlockNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "BlockNode" << std::endl;
-#endif
-      os << CompressStream_t::ENDL << "{" << source
-          << CompressStream_t::ENDL << "}";
-}
-
-void EmptyStatementNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "EmptyStatementNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << ";";
-}
-
-void ExprStatementNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "ExprStatementNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << expr << ";";
-}
-
-void IfNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "IfNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << "if(" << expr << ")" << statement1;
-    if (statement2) {
-        os << CompressStream_t::ENDL << "else";
-        if (!dynamic_cast<BlockNode *>(statement2))
-            os << "{" << statement2 << "}";
-        else
-            os << statement2;
-    }
-}
-
-void DoWhileNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "DoWhileNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << "do";
-    if (!dynamic_cast<BlockNode *>(statement))
-        os << "{" << statement << "}";
-    else
-        os << statement;
-    os << CompressStream_t::ENDL << "while(" << expr << ");";
-}
-
-void WhileNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "WhileNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << "while(" << expr << ")" << statement;
-}
-
-void ForNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "ForNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << "for(" << ((var)?"var ": "")
-        << expr1 << ";" << expr2 << ";" << expr3 << ")" << statement;
-}
-
-void ForInNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "ForInNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << "for(";
-    if (varDecl)
-        os << "var " << varDecl;
-    else
-        os << lexpr;
-    if (init)
-        os << "=" << init;
-    os << " in " << expr << ")" << statement;
-}
-
-void ContinueNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "ContinueNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << "continue";
-    if (!ident.isNull())
-        os << " " << ident;
-    os << ";";
-}
-
-void BreakNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "BreakNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << "break";
-    if (!ident.isNull())
-        os << " " << ident;
-    os << ";";
-}
-
-void ReturnNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "ReturnNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << "return";
-    if (value)
-        os << " " << value;
-    os << ";";
-}
-
-void WithNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "WithNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << "with(" << expr << ")" << statement;
-}
-
-void CaseClauseNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "CaseClauseNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL;
-    if (expr)
-        os << "case " << expr;
-    else
-        os << "default";
-    os << ":";
-    if (list)
-        os << list;
-}
-
-void ClauseListNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "ClauseListNode" << std::endl;
-#endif
-    for (const ClauseListNode *n = this; n; n = n->next())
-        os << n->clause();
-}
-
-void CaseBlockNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "CaseBlockNode" << std::endl;
-#endif
-    for (const ClauseListNode *n = list1; n; n = n->next())
-        os << n->clause();
-    if (def)
-        os << def;
-    for (const ClauseListNode *n = list2; n; n = n->next())
-        os << n->clause();
-}
-
-void SwitchNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "SwitchNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << "switch(" << expr << "){" << block
-        << CompressStream_t::ENDL << "}";
-}
-
-void LabelNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "LabelNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << label << ":" << statement;
-}
-
-void ThrowNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "ThrowNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << "throw " << expr << ";";
-}
-
-void CatchNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "CatchNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << "catch(" << ident << ")" << block;
-}
-
-void FinallyNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "FinallyNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << "finally" << block;
-}
-
-void TryNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "TryNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << "try" << block << _catch << _final;
-}
-
-void ParameterNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "ParameterNode" << std::endl;
-#endif
-    os << id;
-    for (ParameterNode *n = next; n; n = n->next)
-        os << "," << n->id;
-}
-
-void FuncDeclNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "FuncDeclNode" << std::endl;
-#endif
-    os << CompressStream_t::ENDL << "function " << ident << "(";
-    if (param)
-        os << param;
-    os << ")" << body;
-}
-
-void FuncExprNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "FuncExprNode" << std::endl;
-#endif
-    os << "function" << "(" << param << ")" << body;
-}
-
-void SourceElementsNode::streamTo(CompressStream_t &os) const {
-#ifdef DEBUG
-    std::cerr << "SourceElementsNode" << std::endl;
-#endif
-    for (const SourceElementsNode *n = this; n; n = n->elements)
-        os << n->element;
-}
-
@@ -20,12 +20,14 @@
 #ifndef COMPRESS_H
 #define COMPRESS_H
 
-#include <sstream>
 #include <string>
 #include <map>
-#include <set>
 
-namespace KJS { class Identifier; class Node;}
+#include "idtable.h"
+#include "blacklist.h"
+
+namespace KJS { class Node;}
+class Output_t;
 
 /**
  * @short simple base62 integer
@@ -66,73 +68,103 @@ private:
  */
 class CompressStream_t {
 public:
-    typedef std::map<std::string, std::string> IdentifierMap_t;
-    typedef std::set<std::string> StringSet_t;
-    enum Format_t { ENDL};
+    /**
+     * @short output name of identifier.
+     */
+    struct Name_t {
+        Name_t(const std::string &name = std::string(),
+               bool obfuscated = false)
+            : name(name), obfuscated(obfuscated)
+        {}
+
+        std::string name; //< name written to output.
+        bool obfuscated;  //< name was generated.
+    };
+
+    typedef IdentifierTable_t<Name_t> IdentifierMap_t;
+    typedef std::map<std::string, char> DecisionMap_t;
 
     /**
      * @short dump node tree to stream and return stream.
      * @param node node tree to dump.
+     * @param out write compressed javascript source to this buffer.
      * @param obfuscate do obfuscate.
      * @param comment write origin Identifier in comment.
      * @param ask ask user whether obfuscate identifier.
      * @param prefix dont obfuscate identfiers with prefix
-     * @param blacklistDump dump blacklist to this file.
+     * @param userBlacklist read blacklisted identifiers from this file.
+     * @param decisions replay answers from this file, record new ones
+     *        with ask.
      * @param endl  write endl to buffer.
      */
-    CompressStream_t(const KJS::Node *node,
+    CompressStream_t(const KJS::Node *node, Output_t &out,
             bool obfuscate = false, bool comment = false, bool ask = false,
             const std::string &prefix = std::string(),
             const std::string &userBlacklist = std::string(),
-            const std::string &blacklistDump = std::string(),
+            const std::string &decisions = std::string(),
             bool endl = false);
 
     /**
-     * @short dump obfuscate log and destroy object.
+     * @short dump obfuscate log, one line per obfuscated identifier.
+     * @param os output stream.
+     * @return true if any identifier was obfuscated.
      */
-    ~CompressStream_t();
+    bool dumpLog(std::ostream &os) const;
 
     /**
-     * @short return compressed javascript source.
-     * @return compressed javascript source.
+     * @short dump blacklisted identifiers, one per line.
+     * @param os output stream.
      */
-    std::string string() const { return os.str();}
+    void dumpBlacklist(std::ostream &os) const;
 
     /**
-     * @short dump node to stream and return stream.
-     * @param node to dump.
-     * @return compressed stream.
+     * @short dump answers recorded with ask, one "y id" or "n id" per line.
+     * @param os output stream.
+     * @return true if answers were recorded.
      */
-    friend CompressStream_t &operator<<(CompressStream_t &cs,
-                                        const KJS::Node *node);
-    friend CompressStream_t &operator<<(CompressStream_t &cs,
-                                        const KJS::Identifier &value);
-    friend CompressStream_t &operator<<(CompressStream_t &cs,
-                                        const std::string &value);
-    friend CompressStream_t &operator<<(CompressStream_t &cs,
-                                        const char *value);
-    friend CompressStream_t &operator<<(CompressStream_t &cs,
-                                        const char &value);
-    friend CompressStream_t &operator<<(CompressStream_t &cs,
-                                        CompressStream_t::Format_t value);
+    bool dumpDecisions(std::ostream &os) const;
 
 private:
+    /**
+     * @short output format of Emitter_t for compressed source.
+     *
+     * Options are template parameters, each set of options has its own
+     * emitter with the options resolved at compile time.
+     */
+    template <bool ENDL, bool OBFUSCATE, bool COMMENT>
+    class Format_t;
+
+    /**
+     * @short dump node tree by emitter of given options.
+     * @param node node tree to dump.
+     */
+    template <bool ENDL, bool OBFUSCATE, bool COMMENT>
+    void emit(const KJS::Node *node);
+
     /**
      * @short return id for Identifier.
+     *
+     * Name is decided once per identifier, then it is served from idmap.
+     * Returned reference is valid until next call.
+     *
      * @param identifier which identifier
      * @return id for Identifier.
      */
-    std::string getIdFor(const std::string &id);
+    const std::string &getIdFor(const KJS::Identifier &id);
+
+    /**
+     * @short add identifier from blacklist file.
+     * @param name identifier (UTF-8).
+     */
+    void addToBlacklist(const std::string &name);
 
-    std::ostringstream os;     //< stream buffer for javascript source.
-    bool endl;                 //< write endl to buffer.
-    bool obfuscate;            //< do obfuscate.
-    bool comment;              //< write origin Identifier in comment.
+    Output_t &os;              //< buffer for javascript source.
     bool ask;                  //< ask user whether obfuscate identifier.
-    IdentifierMap_t idmap;     //< map of obfuscated identifiers.
+    IdentifierMap_t idmap;     //< output names of identifiers.
     std::string prefix;        //< dont obfuscate identfiers with prefix
-    StringSet_t blacklist;     //< set of blacklisted identifiers.
-    std::string blacklistDump; //< dump blacklist to this file.
+    Blacklist_t blacklist;     //< blacklisted identifiers.
+    DecisionMap_t decisions;   //< y/n answers for identifiers.
+    bool record;               //< record answers.
     Base62Int_t lastId;        //< last obfuscate id.
 };
 
@@ -40,6 +40,8 @@
 #include <cstdlib>
 #include <cstdio>
 
+#include "input.h"
+
 // definice stavu automatu
 #define CSS_S_NORMAL        0
 #define CSS_S_COMMENTSWH    1
@@ -63,8 +65,8 @@
 
 class SpaceShrinker_t {
 public:
-    SpaceShrinker_t(std::istream &stream)
-        : stream(stream), flushed(true), ch(0)
+    SpaceShrinker_t(const char *data, std::size_t size)
+        : pos(data), end(data + size), flushed(true), eof(false), ch(0)
     {}
 
     SpaceShrinker_t &get(char &rch) {
@@ -75,13 +77,14 @@ public:
         }
 
         bool spaces = false;
-        while (stream.get(rch)) {
+        while (!(eof = (pos == end))) {
+            rch = *pos++;
             if (rch != ' ')
                 break;
             spaces = true;
         }
         if (spaces) {
-            stream.unget();
+            if (!eof) --pos;
             rch = ' ';
         }
         ch = rch;
@@ -93,12 +96,14 @@ public:
     }
 
     operator bool() {
-        return !stream.eof();
+        return !eof;
     }
 
 private:
-    std::istream &stream;
+    const char *pos;
+    const char *end;
     bool flushed;
+    bool eof;
     char ch;
 };
 
@@ -146,15 +151,8 @@ int main(int argc, char **argv) {
     }
 
     // open input/output
-    std::ifstream in;
-    if ((from == "-") || (from.empty())) {
-        in.copyfmt(std::cin);
-        in.clear(std::cin.rdstate());
-        in.std::basic_ios<char>::rdbuf(std::cin.rdbuf());
-    } else {
-        in.open(from.c_str());
-    }
-    if (!in) {
+    Input_t in;
+    if (!in.open(from)) {
         std::cerr << "Cannot open input file." << std::endl;
         std::cerr << strerror(errno) << std::endl;
         return EXIT_FAILURE;
@@ -167,7 +165,7 @@ int main(int argc, char **argv) {
     } else {
         out.open(to.c_str());
     }
-    if (!in) {
+    if (!out) {
         std::cerr << "Cannot open output file." << std::endl;
         std::cerr << strerror(errno) << std::endl;
         return EXIT_FAILURE;
@@ -177,7 +175,7 @@ int main(int argc, char **argv) {
         // css parser
         char parserState = CSS_S_NORMAL;
         char actualChar, nextChar = ' ';
-        SpaceShrinker_t input(in);
+        SpaceShrinker_t input(in.data(), in.size());
         while (input.get(actualChar)) {
 
             switch (parserState) {
@@ -20,52 +20,51 @@
 #ifndef DECOMPRESS_H
 #define DECOMPRESS_H
 
-#include <sstream>
 #include <string>
 
 namespace KJS { class Identifier; class Node;}
+class Output_t;
 
 /**
  * @short DeCompress stream - used for decompress javascript source.
+ *
+ * It is output format of Emitter_t: operators are spaced and statements
+ * are on own lines indented by nesting.
  */
 class DeCompressStream_t {
 public:
-    enum Format_t { ENDL, INDENT, UNINDENT, };
+    static const bool PRETTY = true;
 
     /**
      * @short dump node tree to stream and return stream.
      * @param node node tree to dump.
+     * @param out write decompressed javascript source to this buffer.
+     */
+    DeCompressStream_t(const KJS::Node *node, Output_t &out);
+
+    /**
+     * @short return buffer for javascript source.
+     * @return buffer for javascript source.
      */
-    DeCompressStream_t(const KJS::Node *node);
+    Output_t &output() { return os;}
 
     /**
-     * @short return decompressed javascript source.
-     * @return decompressed javascript source.
+     * @short write identifier.
+     * @param id identifier to write.
      */
-    std::string string() const { return os.str();}
+    void identifier(const KJS::Identifier &id);
 
     /**
-     * @short dump node to stream and return stream.
-     * @param node to dump.
-     * @return compressed stream.
+     * @short start new line at current indentation.
      */
-    friend DeCompressStream_t &operator<<(DeCompressStream_t &cs,
-                                          const KJS::Node *node);
-    friend DeCompressStream_t &operator<<(DeCompressStream_t &cs,
-                                          const KJS::Identifier &value);
-    friend DeCompressStream_t &operator<<(DeCompressStream_t &cs,
-                                          const std::string &value);
-    friend DeCompressStream_t &operator<<(DeCompressStream_t &cs,
-                                          const char *value);
-    friend DeCompressStream_t &operator<<(DeCompressStream_t &cs,
-                                          const char &value);
-    friend DeCompressStream_t &operator<<(DeCompressStream_t &cs,
-                                          DeCompressStream_t::Format_t value);
+    void endl();
+
+    void indent() { indentation += "    ";}
+    void unindent() { indentation.resize(indentation.size() - 4);}
 
 private:
-    std::ostringstream os; //< stream buffer for javascript source
-    std::string indent;    //< indentation buffer
+    Output_t &os;            //< buffer for javascript source
+    std::string indentation; //< indentation buffer
 };
 
 #endif /* DECOMPRESS_H */
-
@@ -0,0 +1,214 @@
+/*
+ * FILE             $Id$
+ *
+ * PROJECT          KHTML JavaScript compress utility
+ *
+ * DESCRIPTION      Javascript emitter of kjs parse tree
+ *
+ * AUTHOR           agent <agent@local>
+ *
+ * LICENSE          see COPYING
+ *
+ * Copyright (C) Seznam.cz a.s. 2026
+ * All Rights Reserved
+ *
+ * HISTORY
+ *       2026-10-17 (agent)
+ *                  First draft.
+ */
+
+#include <cmath>
+
+#include "emit.h"
+
+using namespace KJS;
+
+const KJS::Node *Emitter_t::leftmost(const KJS::Node *node) {
+    while (node) {
+        switch (node->kind()) {
+        case AccessorNode1Kind:
+            node = static_cast<const AccessorNode1 *>(node)->expr1;
+            break;
+        case AccessorNode2Kind:
+            node = static_cast<const AccessorNode2 *>(node)->expr;
+            break;
+        case FunctionCallNodeKind:
+            node = static_cast<const FunctionCallNode *>(node)->expr;
+            break;
+        case PostfixNodeKind:
+            node = static_cast<const PostfixNode *>(node)->expr;
+            break;
+        case MultNodeKind:
+            node = static_cast<const MultNode *>(node)->term1;
+            break;
+        case AddNodeKind:
+            node = static_cast<const AddNode *>(node)->term1;
+            break;
+        case AppendStringNodeKind:
+            node = static_cast<const AppendStringNode *>(node)->term;
+            break;
+        case ShiftNodeKind:
+            node = static_cast<const ShiftNode *>(node)->term1;
+            break;
+        case RelationalNodeKind:
+            node = static_cast<const RelationalNode *>(node)->expr1;
+            break;
+        case EqualNodeKind:
+            node = static_cast<const EqualNode *>(node)->expr1;
+            break;
+        case BitOperNodeKind:
+            node = static_cast<const BitOperNode *>(node)->expr1;
+            break;
+        case BinaryLogicalNodeKind:
+            node = static_cast<const BinaryLogicalNode *>(node)->expr1;
+            break;
+        case ConditionalNodeKind:
+            node = static_cast<const ConditionalNode *>(node)->logical;
+            break;
+        case AssignNodeKind:
+            node = static_cast<const AssignNode *>(node)->left;
+            break;
+        case CommaNodeKind:
+            node = static_cast<const CommaNode *>(node)->expr1;
+            break;
+        default:
+            return node;
+        }
+    }
+    return 0;
+}
+
+char Emitter_t::firstChar(const KJS::Node *node) {
+    node = leftmost(node);
+    if (!node)
+        return 0;
+    switch (node->kind()) {
+    case PrefixNodeKind:
+        return (static_cast<const PrefixNode *>(node)->oper == OpPlusPlus)?
+            '+': '-';
+    case UnaryPlusNodeKind:
+        return '+';
+    case NegateNodeKind:
+        return '-';
+    case RegExpNodeKind:
+        return '/';
+    case NumberNodeKind:
+        // folded constants may be negative
+        return std::signbit(node->toNumber(0))? '-': 0;
+    default:
+        return 0;
+    }
+}
+
+char Emitter_t::lastChar(const KJS::Node *node) {
+    while (node) {
+        switch (node->kind()) {
+        case MultNodeKind:
+            node = static_cast<const MultNode *>(node)->term2;
+            break;
+        case AddNodeKind:
+            node = static_cast<const AddNode *>(node)->term2;
+            break;
+        case ShiftNodeKind:
+            node = static_cast<const ShiftNode *>(node)->term2;
+            break;
+        case RelationalNodeKind:
+            node = static_cast<const RelationalNode *>(node)->expr2;
+            break;
+        case EqualNodeKind:
+            node = static_cast<const EqualNode *>(node)->expr2;
+            break;
+        case BitOperNodeKind:
+            node = static_cast<const BitOperNode *>(node)->expr2;
+            break;
+        case BinaryLogicalNodeKind:
+            node = static_cast<const BinaryLogicalNode *>(node)->expr2;
+            break;
+        case ConditionalNodeKind:
+            node = static_cast<const ConditionalNode *>(node)->expr2;
+            break;
+        case AssignNodeKind:
+            node = static_cast<const AssignNode *>(node)->expr;
+            break;
+        case CommaNodeKind:
+            node = static_cast<const CommaNode *>(node)->expr2;
+            break;
+        case PrefixNodeKind:
+            node = static_cast<const PrefixNode *>(node)->expr;
+            break;
+        case UnaryPlusNodeKind:
+            node = static_cast<const UnaryPlusNode *>(node)->expr;
+            break;
+        case NegateNodeKind:
+            node = static_cast<const NegateNode *>(node)->expr;
+            break;
+        case BitwiseNotNodeKind:
+            node = static_cast<const BitwiseNotNode *>(node)->expr;
+            break;
+        case LogicalNotNodeKind:
+            node = static_cast<const LogicalNotNode *>(node)->expr;
+            break;
+        case DeleteNodeKind:
+            node = static_cast<const DeleteNode *>(node)->expr;
+            break;
+        case VoidNodeKind:
+            node = static_cast<const VoidNode *>(node)->expr;
+            break;
+        case TypeOfNodeKind:
+            node = static_cast<const TypeOfNode *>(node)->expr;
+            break;
+        case PostfixNodeKind:
+            return (static_cast<const PostfixNode *>(node)->oper
+                    == OpPlusPlus)? '+': '-';
+        default:
+            return 0;
+        }
+    }
+    return 0;
+}
+
+bool Emitter_t::startsWithNotDecrement(const KJS::Node *node) {
+    node = leftmost(node);
+    if (!node || (node->kind() != LogicalNotNodeKind))
+        return false;
+    node = leftmost(static_cast<const LogicalNotNode *>(node)->expr);
+    return node && (node->kind() == PrefixNodeKind)
+        && (static_cast<const PrefixNode *>(node)->oper == OpMinusMinus);
+}
+
+bool Emitter_t::isIntegerLiteral(const KJS::Node *node) {
+    if (node->kind() != NumberNodeKind)
+        return false;
+    const UString number = UString::from(node->toNumber(0));
+    for (int i = 0; i < number.size(); ++i)
+        if ((number[i].uc < '0') || (number[i].uc > '9'))
+            return false;
+    return true;
+}
+
+#ifdef DEBUG
+const char *Emitter_t::name(KJS::NodeKind kind) {
+    static const char *names[] = {
+        "NoNode", "NullNode", "BooleanNode", "NumberNode", "StringNode",
+        "RegExpNode", "ThisNode", "ResolveNode", "GroupNode", "ElementNode",
+        "ArrayNode", "PropertyValueNode", "PropertyNode",
+        "ObjectLiteralNode", "AccessorNode1", "AccessorNode2",
+        "ArgumentListNode", "ArgumentsNode", "NewExprNode",
+        "FunctionCallNode", "PostfixNode", "DeleteNode", "VoidNode",
+        "TypeOfNode", "PrefixNode", "UnaryPlusNode", "NegateNode",
+        "BitwiseNotNode", "LogicalNotNode", "MultNode", "AddNode",
+        "AppendStringNode", "ShiftNode", "RelationalNode", "EqualNode",
+        "BitOperNode", "BinaryLogicalNode", "ConditionalNode", "AssignNode",
+        "CommaNode", "StatListNode", "AssignExprNode", "VarDeclNode",
+        "VarDeclListNode", "VarStatementNode", "BlockNode",
+        "EmptyStatementNode", "ExprStatementNode", "IfNode", "DoWhileNode",
+        "WhileNode", "ForNode", "ForInNode", "ContinueNode", "BreakNode",
+        "ReturnNode", "WithNode", "CaseClauseNode", "ClauseListNode",
+        "CaseBlockNode", "SwitchNode", "LabelNode", "ThrowNode", "CatchNode",
+        "FinallyNode", "TryNode", "ParameterNode", "FunctionBodyNode",
+        "FuncDeclNode", "FuncExprNode", "SourceElementsNode"
+    };
+    return (unsigned(kind) < sizeof(names) / sizeof(*names))?
+        names[kind]: "?";
+}
+#endif
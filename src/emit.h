@@ -0,0 +1,876 @@
+/*
+ * FILE             $Id$
+ *
+ * PROJECT          KHTML JavaScript compress utility
+ *
+ * DESCRIPTION      Javascript emitter of kjs parse tree
+ *
+ * AUTHOR           agent <agent@local>
+ *
+ * LICENSE          see COPYING
+ *
+ * Copyright (C) Seznam.cz a.s. 2026
+ * All Rights Reserved
+ *
+ * HISTORY
+ *       2026-10-17 (agent)
+ *                  First draft.
+ */
+
+#ifndef EMIT_H
+#define EMIT_H
+
+#ifdef DEBUG
+#include <iostream>
+#endif
+
+#include "util.h"
+#include "output.h"
+#include "kjs/nodes.h"
+
+/**
+ * @short dumps kjs parse tree as javascript source.
+ *
+ * Node dump rules are written once for all output formats. The format
+ * is a template parameter of emit(), so its rules are inlined into the
+ * emitter and the constant ones are resolved at compile time. Nodes are
+ * told apart by their kind, the emitter is friend of all node classes and
+ * reads their members. Format_t has to provide:
+ *   static const bool PRETTY:  spaces around operators and after commas,
+ *                              braces of wrapped statements on own line.
+ *   Output_t &output():        buffer for javascript source.
+ *   identifier(id):            write identifier.
+ *   endl():                    start new line (if format has lines).
+ *   indent(), unindent():      change indentation of following lines.
+ */
+class Emitter_t {
+public:
+    /**
+     * @short dump node and its children.
+     * @param format output format.
+     * @param node node to dump (0 means no node).
+     */
+    template <typename Format_t>
+    static void emit(Format_t &format, const KJS::Node *node);
+
+private:
+    /**
+     * @short choose token spelling by format.
+     * @param tight token for compressed output.
+     * @param pretty token for pretty output.
+     * @return token.
+     */
+    template <typename Format_t>
+    static const char *token(const char *tight, const char *pretty) {
+        return Format_t::PRETTY? pretty: tight;
+    }
+
+    /**
+     * @short dump statement wrapped to braces unless it is block.
+     * @param format output format.
+     * @param node statement.
+     */
+    template <typename Format_t>
+    static void emitBlock(Format_t &format, const KJS::Node *node);
+
+    /**
+     * @short return node whose dump starts the dump of given node.
+     * @param node node (may be 0).
+     * @return the leftmost operand.
+     */
+    static const KJS::Node *leftmost(const KJS::Node *node);
+
+    /**
+     * @short return char which starts dumped node if it can glue with
+     *        operator before it.
+     * @param node node (may be 0).
+     * @return '+', '-', '/' or 0 for other chars.
+     */
+    static char firstChar(const KJS::Node *node);
+
+    /**
+     * @short return char which ends dumped node if it can glue with
+     *        operator after it.
+     * @param node node (may be 0).
+     * @return '+', '-' or 0 for other chars.
+     */
+    static char lastChar(const KJS::Node *node);
+
+    /**
+     * @short return true if dumped node starts with "!--".
+     * @param node node (may be 0).
+     * @return true if "<" before node would start html comment.
+     */
+    static bool startsWithNotDecrement(const KJS::Node *node);
+
+    /**
+     * @short return true if node is dumped as integer literal.
+     * @param node node.
+     * @return true if "." after node would be taken as decimal point.
+     */
+    static bool isIntegerLiteral(const KJS::Node *node);
+
+#ifdef DEBUG
+    /**
+     * @short return name of kind for debug dumps.
+     * @param kind kind of node.
+     * @return name of kjs node class.
+     */
+    static const char *name(KJS::NodeKind kind);
+#endif
+};
+
+template <typename Format_t>
+void Emitter_t::emitBlock(Format_t &format, const KJS::Node *node) {
+    if (node->kind() == KJS::BlockNodeKind) {
+        emit(format, node);
+        return;
+    }
+    Output_t &os = format.output();
+    if (Format_t::PRETTY)
+        format.endl();
+    os << "{";
+    format.indent();
+    emit(format, node);
+    format.unindent();
+    if (Format_t::PRETTY)
+        format.endl();
+    os << "}";
+}
+
+/*
+ * Node dump rules, lists are linked from their first node
+ */
+template <typename Format_t>
+void Emitter_t::emit(Format_t &format, const KJS::Node *node) {
+    using namespace KJS;
+    if (!node) return;
+#ifdef DEBUG
+    std::cerr << name(node->kind()) << std::endl;
+#endif
+
+    Output_t &os = format.output();
+    switch (node->kind()) {
+    case NoNodeKind:
+        break;
+
+    case NullNodeKind:
+        os << "null";
+        break;
+
+    case BooleanNodeKind:
+        os << (static_cast<const BooleanNode *>(node)->val?
+               "true": "false");
+        break;
+
+    case NumberNodeKind:
+        dump(os, UString::from(static_cast<const NumberNode *>(node)->val));
+        break;
+
+    case StringNodeKind:
+        os << '"';
+        dump(os, escape(static_cast<const StringNode *>(node)->val));
+        os << '"';
+        break;
+
+    case RegExpNodeKind: {
+        const RegExpNode *n = static_cast<const RegExpNode *>(node);
+        os << "/";
+        dump(os, n->pattern);
+        os << "/";
+        dump(os, n->flags);
+        break;
+    }
+
+    case ThisNodeKind:
+        os << "this";
+        break;
+
+    case ResolveNodeKind:
+        format.identifier(static_cast<const ResolveNode *>(node)->ident);
+        break;
+
+    case GroupNodeKind:
+        os << "(";
+        emit(format, static_cast<const GroupNode *>(node)->group);
+        os << ")";
+        break;
+
+    case ElementNodeKind:
+        for (const ElementNode *n = static_cast<const ElementNode *>(node);
+                n; n = n->list) {
+            for (int e = n->elision; e; --e)
+                os << token<Format_t>(",", ", ");
+            emit(format, n->node);
+            if (n->list)
+                os << token<Format_t>(",", ", ");
+        }
+        break;
+
+    case ArrayNodeKind: {
+        const ArrayNode *n = static_cast<const ArrayNode *>(node);
+        os << "[";
+        emit(format, n->element);
+        for (int e = n->elision; e; --e)
+            os << token<Format_t>(",", ", ");
+        os << "]";
+        break;
+    }
+
+    case PropertyValueNodeKind:
+        for (const PropertyValueNode *n =
+                static_cast<const PropertyValueNode *>(node);
+                n; n = n->list) {
+            if (n != node)
+                os << token<Format_t>(",", ", ");
+            os << "\"";
+            emit(format, n->name);
+            os << "\"" << token<Format_t>(":", ": ");
+            emit(format, n->assign);
+        }
+        break;
+
+    case PropertyNodeKind: {
+        const PropertyNode *n = static_cast<const PropertyNode *>(node);
+        if (n->str.isNull())
+            dump(os, UString::from(n->numeric));
+        else
+            dump(os, escape(n->str.ustring()));
+        break;
+    }
+
+    case ObjectLiteralNodeKind: {
+        const ObjectLiteralNode *n =
+            static_cast<const ObjectLiteralNode *>(node);
+        if (n->list) {
+            os << "{";
+            emit(format, n->list);
+            os << "}";
+        } else
+            os << "{}";
+        break;
+    }
+
+    case AccessorNode1Kind: {
+        const AccessorNode1 *n = static_cast<const AccessorNode1 *>(node);
+        emit(format, n->expr1);
+        os << "[";
+        emit(format, n->expr2);
+        os << "]";
+        break;
+    }
+
+    case AccessorNode2Kind: {
+        // 1 .x, the dot would be taken as decimal point of the integer
+        const AccessorNode2 *n = static_cast<const AccessorNode2 *>(node);
+        emit(format, n->expr);
+        if (isIntegerLiteral(n->expr))
+            os << " ";
+        os << ".";
+        format.identifier(n->ident);
+        break;
+    }
+
+    case ArgumentListNodeKind:
+        for (const ArgumentListNode *n =
+                static_cast<const ArgumentListNode *>(node);
+                n; n = n->list) {
+            if (n != node)
+                os << token<Format_t>(",", ", ");
+            emit(format, n->expr);
+        }
+        break;
+
+    case ArgumentsNodeKind:
+        os << "(";
+        emit(format, static_cast<const ArgumentsNode *>(node)->list);
+        os << ")";
+        break;
+
+    case NewExprNodeKind: {
+        const NewExprNode *n = static_cast<const NewExprNode *>(node);
+        os << "new ";
+        emit(format, n->expr);
+        emit(format, n->args);
+        break;
+    }
+
+    case FunctionCallNodeKind: {
+        const FunctionCallNode *n =
+            static_cast<const FunctionCallNode *>(node);
+        emit(format, n->expr);
+        emit(format, n->args);
+        break;
+    }
+
+    case PostfixNodeKind: {
+        const PostfixNode *n = static_cast<const PostfixNode *>(node);
+        emit(format, n->expr);
+        os << ((n->oper == OpPlusPlus)? "++": "--");
+        break;
+    }
+
+    case DeleteNodeKind:
+        os << "delete ";
+        emit(format, static_cast<const DeleteNode *>(node)->expr);
+        break;
+
+    case VoidNodeKind:
+        os << "void ";
+        emit(format, static_cast<const VoidNode *>(node)->expr);
+        break;
+
+    case TypeOfNodeKind:
+        os << "typeof ";
+        emit(format, static_cast<const TypeOfNode *>(node)->expr);
+        break;
+
+    case PrefixNodeKind: {
+        const PrefixNode *n = static_cast<const PrefixNode *>(node);
+        os << ((n->oper == OpPlusPlus)? "++": "--");
+        emit(format, n->expr);
+        break;
+    }
+
+    case UnaryPlusNodeKind: {
+        // + +a and + ++a must not glue to one token
+        const Node *expr = static_cast<const UnaryPlusNode *>(node)->expr;
+        if (Format_t::PRETTY)
+            os << " + ";
+        else
+            os << ((firstChar(expr) == '+')? "+ ": "+");
+        emit(format, expr);
+        break;
+    }
+
+    case NegateNodeKind: {
+        const Node *expr = static_cast<const NegateNode *>(node)->expr;
+        if (Format_t::PRETTY)
+            os << " - ";
+        else
+            os << ((firstChar(expr) == '-')? "- ": "-");
+        emit(format, expr);
+        break;
+    }
+
+    case BitwiseNotNodeKind:
+        os << token<Format_t>("~", " ~ ");
+        emit(format, static_cast<const BitwiseNotNode *>(node)->expr);
+        break;
+
+    case LogicalNotNodeKind:
+        os << token<Format_t>("!", "! ");
+        emit(format, static_cast<const LogicalNotNode *>(node)->expr);
+        break;
+
+    case MultNodeKind: {
+        // a/ /re/ must not glue to comment
+        const MultNode *n = static_cast<const MultNode *>(node);
+        emit(format, n->term1);
+        if (Format_t::PRETTY || (lastChar(n->term1) == n->oper))
+            os << " ";
+        os << n->oper;
+        if (Format_t::PRETTY || (firstChar(n->term2) == n->oper))
+            os << " ";
+        emit(format, n->term2);
+        break;
+    }
+
+    case AddNodeKind: {
+        // a- -b and a++ +b must not glue to one token
+        const AddNode *n = static_cast<const AddNode *>(node);
+        emit(format, n->term1);
+        if (Format_t::PRETTY || (lastChar(n->term1) == n->oper))
+            os << " ";
+        os << n->oper;
+        if (Format_t::PRETTY || (firstChar(n->term2) == n->oper))
+            os << " ";
+        emit(format, n->term2);
+        break;
+    }
+
+    case AppendStringNodeKind: {
+        const AppendStringNode *n =
+            static_cast<const AppendStringNode *>(node);
+        emit(format, n->term);
+        os << token<Format_t>("+", " + ") << '"';
+        dump(os, escape(n->str));
+        os << '"';
+        break;
+    }
+
+    case ShiftNodeKind: {
+        const ShiftNode *n = static_cast<const ShiftNode *>(node);
+        emit(format, n->term1);
+        if (n->oper == OpLShift)
+            os << token<Format_t>("<<", " << ");
+        else if (n->oper == OpRShift)
+            os << token<Format_t>(">>", " >> ");
+        else
+            os << token<Format_t>(">>>", " >>> ");
+        emit(format, n->term2);
+        break;
+    }
+
+    case RelationalNodeKind: {
+        const RelationalNode *n = static_cast<const RelationalNode *>(node);
+        emit(format, n->expr1);
+        switch (n->oper) {
+        case OpLess:
+            // a< !--b, <!-- starts html comment
+            if (Format_t::PRETTY)
+                os << " < ";
+            else
+                os << (startsWithNotDecrement(n->expr2)? "< ": "<");
+            break;
+        case OpGreater:
+            os << token<Format_t>(">", " > ");
+            break;
+        case OpLessEq:
+            os << token<Format_t>("<=", " <= ");
+            break;
+        case OpGreaterEq:
+            os << token<Format_t>(">=", " >= ");
+            break;
+        case OpInstanceOf:
+            os << " instanceof ";
+            break;
+        case OpIn:
+            os << " in ";
+            break;
+        default:
+            ;
+        }
+        emit(format, n->expr2);
+        break;
+    }
+
+    case EqualNodeKind: {
+        const EqualNode *n = static_cast<const EqualNode *>(node);
+        emit(format, n->expr1);
+        switch (n->oper) {
+        case OpEqEq:
+            os << token<Format_t>("==", " == ");
+            break;
+        case OpNotEq:
+            os << token<Format_t>("!=", " != ");
+            break;
+        case OpStrEq:
+            os << token<Format_t>("===", " === ");
+            break;
+        case OpStrNEq:
+            os << token<Format_t>("!==", " !== ");
+            break;
+        default:
+            ;
+        }
+        emit(format, n->expr2);
+        break;
+    }
+
+    case BitOperNodeKind: {
+        const BitOperNode *n = static_cast<const BitOperNode *>(node);
+        emit(format, n->expr1);
+        if (n->oper == OpBitAnd)
+            os << token<Format_t>("&", " & ");
+        else if (n->oper == OpBitXOr)
+            os << token<Format_t>("^", " ^ ");
+        else
+            os << token<Format_t>("|", " | ");
+        emit(format, n->expr2);
+        break;
+    }
+
+    case BinaryLogicalNodeKind: {
+        const BinaryLogicalNode *n =
+            static_cast<const BinaryLogicalNode *>(node);
+        emit(format, n->expr1);
+        if (n->oper == OpAnd)
+            os << token<Format_t>("&&", " && ");
+        else
+            os << token<Format_t>("||", " || ");
+        emit(format, n->expr2);
+        break;
+    }
+
+    case ConditionalNodeKind: {
+        const ConditionalNode *n = static_cast<const ConditionalNode *>(node);
+        emit(format, n->logical);
+        os << token<Format_t>("?", "? ");
+        emit(format, n->expr1);
+        os << token<Format_t>(":", ": ");
+        emit(format, n->expr2);
+        break;
+    }
+
+    case AssignNodeKind: {
+        const AssignNode *n = static_cast<const AssignNode *>(node);
+        emit(format, n->left);
+        const char *opStr;
+        switch (n->oper) {
+        case OpEqual:
+            opStr = token<Format_t>("=", " = ");
+            break;
+        case OpMultEq:
+            opStr = token<Format_t>("*=", " *= ");
+            break;
+        case OpDivEq:
+            opStr = token<Format_t>("/=", " /= ");
+            break;
+        case OpPlusEq:
+            opStr = token<Format_t>("+=", " += ");
+            break;
+        case OpMinusEq:
+            opStr = token<Format_t>("-=", " -= ");
+            break;
+        case OpLShift:
+            opStr = token<Format_t>("<<=", " <<= ");
+            break;
+        case OpRShift:
+            opStr = token<Format_t>(">>=", " >>= ");
+            break;
+        case OpURShift:
+            opStr = token<Format_t>(">>>=", " >>>= ");
+            break;
+        case OpAndEq:
+            opStr = token<Format_t>("&=", " &= ");
+            break;
+        case OpXOrEq:
+            opStr = token<Format_t>("^=", " ^= ");
+            break;
+        case OpOrEq:
+            opStr = token<Format_t>("|=", " |= ");
+            break;
+        case OpModEq:
+            opStr = token<Format_t>("%=", " %= ");
+            break;
+        default:
+            opStr = token<Format_t>("?=", " ?= ");
+        }
+        os << opStr;
+        emit(format, n->expr);
+        break;
+    }
+
+    case CommaNodeKind: {
+        const CommaNode *n = static_cast<const CommaNode *>(node);
+        emit(format, n->expr1);
+        os << token<Format_t>(",", ", ");
+        emit(format, n->expr2);
+        break;
+    }
+
+    case StatListNodeKind:
+        for (const StatListNode *n = static_cast<const StatListNode *>(node);
+                n; n = n->list)
+            emit(format, n->statement);
+        break;
+
+    case AssignExprNodeKind:
+        os << token<Format_t>("=", " = ");
+        emit(format, static_cast<const AssignExprNode *>(node)->expr);
+        break;
+
+    case VarDeclNodeKind: {
+        const VarDeclNode *n = static_cast<const VarDeclNode *>(node);
+        format.identifier(n->ident);
+        emit(format, n->init);
+        break;
+    }
+
+    case VarDeclListNodeKind:
+        for (const VarDeclListNode *n =
+                static_cast<const VarDeclListNode *>(node);
+                n; n = n->list) {
+            if (n != node)
+                os << token<Format_t>(",", ", ");
+            emit(format, n->var);
+        }
+        break;
+
+    case VarStatementNodeKind:
+        format.endl();
+        os << "var ";
+        emit(format, static_cast<const VarStatementNode *>(node)->list);
+        os << ";";
+        break;
+
+    case BlockNodeKind:
+    case FunctionBodyNodeKind:
+        format.endl();
+        os << "{";
+        format.indent();
+        emit(format, static_cast<const BlockNode *>(node)->source);
+        format.unindent();
+        format.endl();
+        os << "}";
+        break;
+
+    case EmptyStatementNodeKind:
+        format.endl();
+        os << ";";
+        break;
+
+    case ExprStatementNodeKind:
+        format.endl();
+        emit(format, static_cast<const ExprStatementNode *>(node)->expr);
+        os << ";";
+        break;
+
+    case IfNodeKind: {
+        const IfNode *n = static_cast<const IfNode *>(node);
+        format.endl();
+        os << token<Format_t>("if(", "if (");
+        emit(format, n->expr);
+        os << ")";
+        format.indent();
+        emit(format, n->statement1);
+        format.unindent();
+        if (n->statement2) {
+            format.endl();
+            os << "else";
+            format.indent();
+            emitBlock(format, n->statement2);
+            format.unindent();
+        }
+        break;
+    }
+
+    case DoWhileNodeKind: {
+        const DoWhileNode *n = static_cast<const DoWhileNode *>(node);
+        format.endl();
+        os << "do";
+        format.indent();
+        emitBlock(format, n->statement);
+        format.unindent();
+        format.endl();
+        os << token<Format_t>("while(", "while (");
+        emit(format, n->expr);
+        os << ");";
+        break;
+    }
+
+    case WhileNodeKind: {
+        const WhileNode *n = static_cast<const WhileNode *>(node);
+        format.endl();
+        os << token<Format_t>("while(", "while (");
+        emit(format, n->expr);
+        os << ")";
+        format.indent();
+        emit(format, n->statement);
+        format.unindent();
+        break;
+    }
+
+    case ForNodeKind: {
+        const ForNode *n = static_cast<const ForNode *>(node);
+        format.endl();
+        os << token<Format_t>("for(", "for (") << ((n->var)? "var ": "");
+        emit(format, n->expr1);
+        os << token<Format_t>(";", "; ");
+        emit(format, n->expr2);
+        os << token<Format_t>(";", "; ");
+        emit(format, n->expr3);
+        os << ")";
+        format.indent();
+        emit(format, n->statement);
+        format.unindent();
+        break;
+    }
+
+    case ForInNodeKind: {
+        const ForInNode *n = static_cast<const ForInNode *>(node);
+        format.endl();
+        os << token<Format_t>("for(", "for (");
+        if (n->varDecl) {
+            os << "var ";
+            emit(format, n->varDecl);
+        } else
+            emit(format, n->lexpr);
+        if (n->init) {
+            os << "=";
+            emit(format, n->init);
+        }
+        os << " in ";
+        emit(format, n->expr);
+        os << ")";
+        format.indent();
+        emit(format, n->statement);
+        format.unindent();
+        break;
+    }
+
+    case ContinueNodeKind: {
+        const ContinueNode *n = static_cast<const ContinueNode *>(node);
+        format.endl();
+        os << "continue";
+        if (!n->ident.isNull()) {
+            os << " ";
+            format.identifier(n->ident);
+        }
+        os << ";";
+        break;
+    }
+
+    case BreakNodeKind: {
+        const BreakNode *n = static_cast<const BreakNode *>(node);
+        format.endl();
+        os << "break";
+        if (!n->ident.isNull()) {
+            os << " ";
+            format.identifier(n->ident);
+        }
+        os << ";";
+        break;
+    }
+
+    case ReturnNodeKind: {
+        const ReturnNode *n = static_cast<const ReturnNode *>(node);
+        format.endl();
+        os << "return";
+        if (n->value) {
+            os << " ";
+            emit(format, n->value);
+        }
+        os << ";";
+        break;
+    }
+
+    case WithNodeKind: {
+        const WithNode *n = static_cast<const WithNode *>(node);
+        format.endl();
+        os << "with(";
+        emit(format, n->expr);
+        os << ")";
+        emit(format, n->statement);
+        break;
+    }
+
+    case CaseClauseNodeKind: {
+        const CaseClauseNode *n = static_cast<const CaseClauseNode *>(node);
+        format.endl();
+        if (n->expr) {
+            os << "case ";
+            emit(format, n->expr);
+        } else
+            os << "default";
+        os << ":";
+        format.indent();
+        emit(format, n->list);
+        format.unindent();
+        break;
+    }
+
+    case ClauseListNodeKind:
+        for (const ClauseListNode *n =
+                static_cast<const ClauseListNode *>(node); n; n = n->next())
+            emit(format, n->clause());
+        break;
+
+    case CaseBlockNodeKind: {
+        // clauses in source order, default is between the lists
+        const CaseBlockNode *n = static_cast<const CaseBlockNode *>(node);
+        emit(format, n->list1);
+        emit(format, n->def);
+        emit(format, n->list2);
+        break;
+    }
+
+    case SwitchNodeKind: {
+        const SwitchNode *n = static_cast<const SwitchNode *>(node);
+        format.endl();
+        os << "switch(";
+        emit(format, n->expr);
+        os << token<Format_t>("){", ") {");
+        format.indent();
+        emit(format, n->block);
+        format.unindent();
+        format.endl();
+        os << "}";
+        break;
+    }
+
+    case LabelNodeKind: {
+        const LabelNode *n = static_cast<const LabelNode *>(node);
+        format.endl();
+        format.identifier(n->label);
+        os << ":";
+        format.indent();
+        emit(format, n->statement);
+        format.unindent();
+        break;
+    }
+
+    case ThrowNodeKind:
+        format.endl();
+        os << "throw ";
+        emit(format, static_cast<const ThrowNode *>(node)->expr);
+        os << ";";
+        break;
+
+    case CatchNodeKind: {
+        const CatchNode *n = static_cast<const CatchNode *>(node);
+        format.endl();
+        os << "catch(";
+        format.identifier(n->ident);
+        os << ")";
+        emit(format, n->block);
+        break;
+    }
+
+    case FinallyNodeKind:
+        format.endl();
+        os << token<Format_t>("finally", "finally ");
+        emit(format, static_cast<const FinallyNode *>(node)->block);
+        break;
+
+    case TryNodeKind: {
+        const TryNode *n = static_cast<const TryNode *>(node);
+        format.endl();
+        os << token<Format_t>("try", "try ");
+        emit(format, n->block);
+        emit(format, n->_catch);
+        emit(format, n->_final);
+        break;
+    }
+
+    case ParameterNodeKind:
+        for (const ParameterNode *n = static_cast<const ParameterNode *>(node);
+                n; n = n->next) {
+            if (n != node)
+                os << token<Format_t>(",", ", ");
+            format.identifier(n->id);
+        }
+        break;
+
+    case FuncDeclNodeKind: {
+        const FuncDeclNode *n = static_cast<const FuncDeclNode *>(node);
+        format.endl();
+        os << "function ";
+        format.identifier(n->ident);
+        os << "(";
+        emit(format, n->param);
+        os << ")";
+        emit(format, n->body);
+        break;
+    }
+
+    case FuncExprNodeKind: {
+        const FuncExprNode *n = static_cast<const FuncExprNode *>(node);
+        os << "function" << "(";
+        emit(format, n->param);
+        os << ")";
+        emit(format, n->body);
+        break;
+    }
+
+    case SourceElementsNodeKind:
+        for (const SourceElementsNode *n =
+                static_cast<const SourceElementsNode *>(node);
+                n; n = n->elements)
+            emit(format, n->element);
+        break;
+    }
+}
+
+#endif /* EMIT_H */
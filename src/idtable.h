@@ -0,0 +1,142 @@
+/*
+ * FILE             $Id$
+ *
+ * PROJECT          KHTML JavaScript compress utility
+ *
+ * DESCRIPTION      Hash table keyed by interned identifier
+ *
+ * AUTHOR           agent <agent@local>
+ *
+ * LICENSE          see COPYING
+ *
+ * Copyright (C) Seznam.cz a.s. 2026
+ * All Rights Reserved
+ *
+ * HISTORY
+ *       2026-10-17 (agent)
+ *                  First draft.
+ */
+
+#ifndef IDTABLE_H
+#define IDTABLE_H
+
+#include <vector>
+
+#include "kjs/identifier.h"
+
+/**
+ * @short open addressing hash table keyed by interned identifier.
+ *
+ * Identifiers are interned, so key comparison is one pointer compare and
+ * hash was computed when identifier was interned. Table keeps reference
+ * to its keys.
+ */
+template <typename Value_t>
+class IdentifierTable_t {
+public:
+    /**
+     * @short one slot of table, null key means empty slot.
+     */
+    struct Entry_t {
+        Entry_t(): value() {}
+
+        KJS::Identifier key; //< identifier.
+        Value_t value;       //< value of identifier.
+    };
+
+    typedef std::vector<Entry_t> EntryList_t;
+
+    /**
+     * @short create new empty table.
+     */
+    IdentifierTable_t(): slots(MIN_SIZE), count(0) {}
+
+    /**
+     * @short find value of identifier.
+     * @param id identifier.
+     * @return value of identifier or 0.
+     */
+    Value_t *find(const KJS::Identifier &id) {
+        Entry_t &entry = probe(id);
+        return entry.key.isNull()? 0: &entry.value;
+    }
+
+    /**
+     * @short insert identifier unless it is already in table.
+     *
+     * Returned reference is valid until next insert.
+     *
+     * @param id identifier.
+     * @param value value of identifier.
+     * @return value of identifier in table.
+     */
+    Value_t &insert(const KJS::Identifier &id, const Value_t &value) {
+        Entry_t *entry = &probe(id);
+        if (!entry->key.isNull())
+            return entry->value;
+
+        // keep load factor under 1/2
+        if (2 * (count + 1) > slots.size()) {
+            rehash();
+            entry = &probe(id);
+        }
+
+        entry->key = id;
+        entry->value = value;
+        ++count;
+        return entry->value;
+    }
+
+    /**
+     * @short return number of identifiers in table.
+     * @return number of identifiers in table.
+     */
+    std::size_t size() const { return count;}
+
+    /**
+     * @short return true if table is empty.
+     * @return true if table is empty.
+     */
+    bool empty() const { return !count;}
+
+    /**
+     * @short return all slots of table (empty slots have null key).
+     * @return all slots of table.
+     */
+    const EntryList_t &entries() const { return slots;}
+
+private:
+    static const std::size_t MIN_SIZE = 64; //< initial number of slots.
+
+    /**
+     * @short find slot of identifier or empty slot where it belongs.
+     * @param id identifier.
+     * @return slot.
+     */
+    Entry_t &probe(const KJS::Identifier &id) {
+        std::size_t mask = slots.size() - 1;
+        for (std::size_t i = id.hash() & mask; ; i = (i + 1) & mask) {
+            Entry_t &entry = slots[i];
+            if (entry.key.isNull() || (entry.key.key() == id.key()))
+                return entry;
+        }
+    }
+
+    /**
+     * @short double number of slots.
+     */
+    void rehash() {
+        EntryList_t old(2 * slots.size());
+        old.swap(slots);
+        for (typename EntryList_t::iterator iold = old.begin();
+                iold != old.end(); ++iold)
+            if (!iold->key.isNull())
+                probe(iold->key) = *iold;
+    }
+
+    EntryList_t slots; //< slots of table, size is power of two.
+    std::size_t count; //< number of used slots.
+};
+
+#endif /* IDTABLE_H */
+
@@ -0,0 +1,120 @@
+/*
+ * FILE             $Id$
+ *
+ * PROJECT          KHTML JavaScript compress utility
+ *
+ * DESCRIPTION      Input file reader
+ *
+ * AUTHOR           agent <agent@local>
+ *
+ * LICENSE          see COPYING
+ *
+ * Copyright (C) Seznam.cz a.s. 2026
+ * All Rights Reserved
+ *
+ * HISTORY
+ *       2026-10-17 (agent)
+ *                  First draft.
+ */
+
+#include <cstdlib>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <errno.h>
+
+#include "input.h"
+
+namespace {
+
+const std::size_t BLOCK_SIZE = 1 << 16; //< read block size.
+
+} // namespace
+
+/**
+ * @short read whole file into memory.
+ * @param path path to file ("-" or empty means stdin).
+ * @return true if file was read, otherwise errno is set.
+ */
+bool Input_t::open(const std::string &path) {
+    close();
+
+    // open file
+    bool stdinput = (path == "-") || path.empty();
+    int fd = stdinput? STDIN_FILENO: ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    // map regular files
+    struct stat st;
+    bool ok = false;
+    if (!fstat(fd, &st) && S_ISREG(st.st_mode) && (st.st_size > 0)) {
+        void *addr = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED) {
+            madvise(addr, st.st_size, MADV_SEQUENTIAL);
+            buffer = static_cast<char *>(addr);
+            length = st.st_size;
+            mapped = true;
+            ok = true;
+        }
+    }
+
+    // read the others
+    if (!mapped)
+        ok = read(fd);
+
+    // close file, keep errno of failed read
+    int error = errno;
+    if (!stdinput)
+        ::close(fd);
+    errno = error;
+    return ok;
+}
+
+/**
+ * @short read file by blocks until eof.
+ * @param fd file descriptor.
+ * @return true if file was read.
+ */
+bool Input_t::read(int fd) {
+    std::size_t capacity = 0;
+    while (true) {
+        // make room for next block
+        if (capacity - length < BLOCK_SIZE) {
+            capacity = capacity? 2 * capacity: BLOCK_SIZE;
+            char *tmp = static_cast<char *>(realloc(buffer, capacity));
+            if (!tmp) {
+                errno = ENOMEM;
+                return false;
+            }
+            buffer = tmp;
+        }
+
+        // read it
+        ssize_t count = ::read(fd, buffer + length, capacity - length);
+        if (count < 0) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+        if (count == 0)
+            return true;
+        length += count;
+    }
+}
+
+/**
+ * @short release file content.
+ */
+void Input_t::close() {
+    if (mapped)
+        munmap(buffer, length);
+    else
+        free(buffer);
+    buffer = 0;
+    length = 0;
+    mapped = false;
+}
+
@@ -0,0 +1,85 @@
+/*
+ * FILE             $Id$
+ *
+ * PROJECT          KHTML JavaScript compress utility
+ *
+ * DESCRIPTION      Input file reader
+ *
+ * AUTHOR           agent <agent@local>
+ *
+ * LICENSE          see COPYING
+ *
+ * Copyright (C) Seznam.cz a.s. 2026
+ * All Rights Reserved
+ *
+ * HISTORY
+ *       2026-10-17 (agent)
+ *                  First draft.
+ */
+
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <string>
+#include <cstddef>
+
+/**
+ * @short whole content of input file in memory.
+ *
+ * Regular files are mapped to memory, other files (stdin, pipes) are read
+ * by large blocks into one buffer.
+ */
+class Input_t {
+public:
+    /**
+     * @short create new empty input.
+     */
+    Input_t(): buffer(0), length(0), mapped(false) {}
+
+    /**
+     * @short release input and destroy object.
+     */
+    ~Input_t() { close();}
+
+    /**
+     * @short read whole file into memory.
+     * @param path path to file ("-" or empty means stdin).
+     * @return true if file was read, otherwise errno is set.
+     */
+    bool open(const std::string &path);
+
+    /**
+     * @short release file content.
+     */
+    void close();
+
+    /**
+     * @short return file content (not zero terminated).
+     * @return file content.
+     */
+    const char *data() const { return buffer;}
+
+    /**
+     * @short return size of file content.
+     * @return size of file content.
+     */
+    std::size_t size() const { return length;}
+
+private:
+    Input_t(const Input_t &);
+    Input_t &operator=(const Input_t &);
+
+    /**
+     * @short read file by blocks until eof.
+     * @param fd file descriptor.
+     * @return true if file was read.
+     */
+    bool read(int fd);
+
+    char *buffer;       //< file content.
+    std::size_t length; //< size of file content.
+    bool mapped;        //< buffer is mapped file.
+};
+
+#endif /* INPUT_H */
+
@@ -0,0 +1,89 @@
+// -*- c-basic-offset: 2 -*-
+/*
+ *  This file is part of the KDE libraries
+ *  Copyright (C) 2026 agent (agent@local)
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include <stdlib.h>
+#include <new>
+
+#include "arena.h"
+
+using namespace KJS;
+
+// space before the data of block, keeps the data aligned
+static const size_t headerSize = 16;
+
+Arena::Finalizer Arena::heap = { 0, 0 };
+
+void *Arena::grow(size_t size)
+{
+  // big requests get a block of their own
+  size_t capacity = size > blockSize / 4 ? size : (size_t)blockSize;
+  Block *block = static_cast<Block *>(malloc(headerSize + capacity));
+  if (!block)
+    throw std::bad_alloc();
+  char *data = reinterpret_cast<char *>(block) + headerSize;
+
+  if (capacity == size && blocks) {
+    // keep on filling the current block
+    block->next = blocks->next;
+    blocks->next = block;
+    return data;
+  }
+  block->next = blocks;
+  blocks = block;
+  pos = data + size;
+  limit = data + capacity;
+  return data;
+}
+
+void *Arena::allocateHeap(size_t size)
+{
+  Finalizer *f = static_cast<Finalizer *>(::operator new(finalizerSize + size));
+  f->next = &heap;
+  f->destroy = 0;
+  return reinterpret_cast<char *>(f) + finalizerSize;
+}
+
+void Arena::release(void *p)
+{
+  if (!p)
+    return;
+  Finalizer *f = reinterpret_cast<Finalizer *>(static_cast<char *>(p) - finalizerSize);
+  if (f->next == &heap)
+    ::operator delete(f);
+  else
+    f->destroy = 0;
+}
+
+void Arena::clear()
+{
+  // objects may still use memory of the blocks while they are destroyed
+  for (Finalizer *f = finalizers; f; f = f->next)
+    if (f->destroy)
+      f->destroy(reinterpret_cast<char *>(f) + finalizerSize);
+  finalizers = 0;
+
+  while (blocks) {
+    Block *next = blocks->next;
+    free(blocks);
+    blocks = next;
+  }
+  pos = limit = 0;
+}
@@ -0,0 +1,121 @@
+// -*- c-basic-offset: 2 -*-
+/*
+ *  This file is part of the KDE libraries
+ *  Copyright (C) 2026 agent (agent@local)
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifndef _KJS_ARENA_H_
+#define _KJS_ARENA_H_
+
+#include <stddef.h>
+
+namespace KJS {
+
+  /**
+   * @short Bump allocator of one parse.
+   *
+   * Memory is taken from big blocks by moving a pointer, nothing is freed
+   * separately. All of it is released at once by clear() or when the
+   * arena is destroyed.
+   *
+   * Objects owning memory of their own are allocated with a destroy
+   * callback; clear() calls the callbacks before it releases the blocks.
+   * Such allocation carries a small header and so does heap memory of
+   * allocateHeap(), release() tells the two of them apart by it.
+   */
+  class Arena {
+  public:
+    typedef void (*Destroy)(void *);
+
+    Arena() : blocks(0), pos(0), limit(0), finalizers(0) { }
+    ~Arena() { clear(); }
+
+    /**
+     * Allocate size bytes aligned for any type.
+     */
+    void *allocate(size_t size)
+    {
+      size = (size + alignment - 1) & ~(alignment - 1);
+      if (size > (size_t)(limit - pos))
+        return grow(size);
+      void *p = pos;
+      pos += size;
+      return p;
+    }
+
+    /**
+     * Allocate size bytes aligned for any type, destroy is called with them
+     * by clear(), the last allocated first.
+     */
+    void *allocate(size_t size, Destroy destroy)
+    {
+      Finalizer *f = static_cast<Finalizer *>(allocate(finalizerSize + size));
+      f->next = finalizers;
+      f->destroy = destroy;
+      finalizers = f;
+      return reinterpret_cast<char *>(f) + finalizerSize;
+    }
+
+    /**
+     * Allocate size bytes on heap with the header of allocate(size, destroy).
+     */
+    static void *allocateHeap(size_t size);
+
+    /**
+     * Free memory of allocateHeap(). Memory of allocate(size, destroy)
+     * stays in its arena, only its destroy callback is dropped because
+     * the object is gone already.
+     */
+    static void release(void *p);
+
+    /**
+     * Call destroy callbacks and release all memory of the arena.
+     */
+    void clear();
+
+  private:
+    enum { alignment = 16, blockSize = 1 << 16 };
+
+    struct Block {
+      Block *next;
+    };
+
+    // header of memory with destroy callback, chained from the newest one,
+    // heap memory is chained to the heap marker
+    struct Finalizer {
+      Finalizer *next;
+      Destroy destroy;
+    };
+    static Finalizer heap;
+    enum { finalizerSize = (sizeof(Finalizer) + alignment - 1) & ~(alignment - 1) };
+
+    void *grow(size_t size);
+
+    // not copyable
+    Arena(const Arena &);
+    Arena &operator=(const Arena &);
+
+    Block *blocks;
+    char *pos;
+    char *limit;
+    Finalizer *finalizers;
+  };
+
+} // namespace
+
+#endif
@@ -29,7 +29,7 @@
 #include "internal.h"
 #include "error_object.h"
 
-#include "array_object.lut.h"
+#include "lookup.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -408,24 +408,24 @@ unsigned ArrayInstanceImp::pushUndefinedObjectsToEnd(ExecState *exec)
 
 // ------------------------------ ArrayPrototypeImp ----------------------------
 
+static constexpr HashEntry arrayTableEntries[] = {
+  { "toString",       ArrayProtoFuncImp::ToString,       DontEnum|Function, 0 },
+  { "toLocaleString", ArrayProtoFuncImp::ToLocaleString, DontEnum|Function, 0 },
+  { "concat",         ArrayProtoFuncImp::Concat,         DontEnum|Function, 1 },
+  { "join",           ArrayProtoFuncImp::Join,           DontEnum|Function, 1 },
+  { "pop",            ArrayProtoFuncImp::Pop,            DontEnum|Function, 0 },
+  { "push",           ArrayProtoFuncImp::Push,           DontEnum|Function, 1 },
+  { "reverse",        ArrayProtoFuncImp::Reverse,        DontEnum|Function, 0 },
+  { "shift",          ArrayProtoFuncImp::Shift,          DontEnum|Function, 0 },
+  { "slice",          ArrayProtoFuncImp::Slice,          DontEnum|Function, 2 },
+  { "sort",           ArrayProtoFuncImp::Sort,           DontEnum|Function, 1 },
+  { "splice",         ArrayProtoFuncImp::Splice,         DontEnum|Function, 2 },
+  { "unshift",        ArrayProtoFuncImp::UnShift,        DontEnum|Function, 1 }
+};
+KJS_HASH_TABLE(arrayTable);
+
 const ClassInfo ArrayPrototypeImp::info = {"Array", &ArrayInstanceImp::info, &arrayTable, 0};
 
-/* Source for array_object.lut.h
-@begin arrayTable 17
-  toString       ArrayProtoFuncImp::ToString       DontEnum|Function 0
-  toLocaleString ArrayProtoFuncImp::ToLocaleString DontEnum|Function 0
-  concat         ArrayProtoFuncImp::Concat         DontEnum|Function 1
-  join           ArrayProtoFuncImp::Join           DontEnum|Function 1
-  pop            ArrayProtoFuncImp::Pop            DontEnum|Function 0
-  push           ArrayProtoFuncImp::Push           DontEnum|Function 1
-  reverse        ArrayProtoFuncImp::Reverse        DontEnum|Function 0
-  shift          ArrayProtoFuncImp::Shift          DontEnum|Function 0
-  slice          ArrayProtoFuncImp::Slice          DontEnum|Function 2
-  sort           ArrayProtoFuncImp::Sort           DontEnum|Function 1
-  splice         ArrayProtoFuncImp::Splice         DontEnum|Function 2
-  unshift        ArrayProtoFuncImp::UnShift        DontEnum|Function 1
-@end
-*/
 
 // ECMA 15.4.4
 ArrayPrototypeImp::ArrayPrototypeImp(ExecState */*exec*/,
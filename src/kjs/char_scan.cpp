@@ -0,0 +1,161 @@
+// -*- c-basic-offset: 2 -*-
+/*
+ *  This file is part of the KDE libraries
+ *  Copyright (C) 2026 agent (agent@local)
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include "char_scan.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define KJS_SCAN_X86
+#include <immintrin.h>
+#endif
+
+using namespace KJS;
+
+static inline bool isBlank(unsigned short c)
+{
+  return (c == ' ' || c == '\t' || c == 0x0b || c == 0x0c || c == 0xa0);
+}
+
+static const UChar *findScalar(const UChar *p, const UChar *end,
+                               unsigned short c1, unsigned short c2,
+                               unsigned short c3, unsigned short c4,
+                               unsigned short c5)
+{
+  for (; p != end; p++)
+    if (p->uc == c1 || p->uc == c2 || p->uc == c3 || p->uc == c4 ||
+        p->uc == c5)
+      break;
+  return p;
+}
+
+static const UChar *skipBlanksScalar(const UChar *p, const UChar *end)
+{
+  while (p != end && isBlank(p->uc))
+    p++;
+  return p;
+}
+
+#ifdef KJS_SCAN_X86
+
+// the loops below read UChar arrays as arrays of 16 bit lanes
+static_assert(sizeof(UChar) == 2, "UChar must be 16 bit");
+
+__attribute__((target("sse2")))
+static const UChar *findSSE2(const UChar *p, const UChar *end,
+                             unsigned short c1, unsigned short c2,
+                             unsigned short c3, unsigned short c4,
+                             unsigned short c5)
+{
+  const __m128i v1 = _mm_set1_epi16(c1), v2 = _mm_set1_epi16(c2);
+  const __m128i v3 = _mm_set1_epi16(c3), v4 = _mm_set1_epi16(c4);
+  const __m128i v5 = _mm_set1_epi16(c5);
+  for (; end - p >= 8; p += 8) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    __m128i hit = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi16(v, v1), _mm_cmpeq_epi16(v, v2)),
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(v, v3),
+                                  _mm_cmpeq_epi16(v, v4)),
+                     _mm_cmpeq_epi16(v, v5)));
+    if (int mask = _mm_movemask_epi8(hit))
+      return p + (__builtin_ctz(mask) >> 1);
+  }
+  return findScalar(p, end, c1, c2, c3, c4, c5);
+}
+
+__attribute__((target("sse2")))
+static const UChar *skipBlanksSSE2(const UChar *p, const UChar *end)
+{
+  const __m128i space = _mm_set1_epi16(' '), tab = _mm_set1_epi16('\t');
+  const __m128i vtab = _mm_set1_epi16(0x0b), ff = _mm_set1_epi16(0x0c);
+  const __m128i nbsp = _mm_set1_epi16(0xa0);
+  for (; end - p >= 8; p += 8) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    __m128i blank = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi16(v, space), _mm_cmpeq_epi16(v, tab)),
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(v, vtab),
+                                  _mm_cmpeq_epi16(v, ff)),
+                     _mm_cmpeq_epi16(v, nbsp)));
+    if (int mask = ~_mm_movemask_epi8(blank) & 0xffff)
+      return p + (__builtin_ctz(mask) >> 1);
+  }
+  return skipBlanksScalar(p, end);
+}
+
+__attribute__((target("avx2")))
+static const UChar *findAVX2(const UChar *p, const UChar *end,
+                             unsigned short c1, unsigned short c2,
+                             unsigned short c3, unsigned short c4,
+                             unsigned short c5)
+{
+  const __m256i v1 = _mm256_set1_epi16(c1), v2 = _mm256_set1_epi16(c2);
+  const __m256i v3 = _mm256_set1_epi16(c3), v4 = _mm256_set1_epi16(c4);
+  const __m256i v5 = _mm256_set1_epi16(c5);
+  for (; end - p >= 16; p += 16) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    __m256i hit = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi16(v, v1), _mm256_cmpeq_epi16(v, v2)),
+        _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi16(v, v3),
+                                        _mm256_cmpeq_epi16(v, v4)),
+                        _mm256_cmpeq_epi16(v, v5)));
+    if (unsigned int mask = _mm256_movemask_epi8(hit))
+      return p + (__builtin_ctz(mask) >> 1);
+  }
+  return findSSE2(p, end, c1, c2, c3, c4, c5);
+}
+
+__attribute__((target("avx2")))
+static const UChar *skipBlanksAVX2(const UChar *p, const UChar *end)
+{
+  const __m256i space = _mm256_set1_epi16(' '), tab = _mm256_set1_epi16('\t');
+  const __m256i vtab = _mm256_set1_epi16(0x0b), ff = _mm256_set1_epi16(0x0c);
+  const __m256i nbsp = _mm256_set1_epi16(0xa0);
+  for (; end - p >= 16; p += 16) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    __m256i blank = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi16(v, space),
+                        _mm256_cmpeq_epi16(v, tab)),
+        _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi16(v, vtab),
+                                        _mm256_cmpeq_epi16(v, ff)),
+                        _mm256_cmpeq_epi16(v, nbsp)));
+    if (unsigned int mask = ~_mm256_movemask_epi8(blank))
+      return p + (__builtin_ctz(mask) >> 1);
+  }
+  return skipBlanksSSE2(p, end);
+}
+
+#endif /* KJS_SCAN_X86 */
+
+static CharScan::Scanners pickScanners()
+{
+  CharScan::Scanners scanners = { findScalar, skipBlanksScalar };
+#ifdef KJS_SCAN_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    scanners.find = findAVX2;
+    scanners.skipBlanks = skipBlanksAVX2;
+  } else if (__builtin_cpu_supports("sse2")) {
+    scanners.find = findSSE2;
+    scanners.skipBlanks = skipBlanksSSE2;
+  }
+#endif
+  return scanners;
+}
+
+const CharScan::Scanners CharScan::scanners = pickScanners();
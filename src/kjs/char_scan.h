@@ -0,0 +1,78 @@
+// -*- c-basic-offset: 2 -*-
+/*
+ *  This file is part of the KDE libraries
+ *  Copyright (C) 2026 agent (agent@local)
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifndef _KJS_CHAR_SCAN_H_
+#define _KJS_CHAR_SCAN_H_
+
+#include "ustring.h"
+
+namespace KJS {
+
+  /**
+   * @short Vectorized scanning of UChar buffers.
+   *
+   * Used by the lexer to jump over comments and blanks in one step instead
+   * of shifting character by character. Uses AVX2 or SSE2 when the CPU
+   * supports it (checked once at startup), plain loops otherwise.
+   */
+  class CharScan {
+  public:
+    /**
+     * Find the first character equal to one of c1 .. c5 (pass the same
+     * character more times if you need less of them).
+     * @return pointer to the character or end if there is none.
+     */
+    static const UChar *find(const UChar *p, const UChar *end,
+                             unsigned short c1, unsigned short c2,
+                             unsigned short c3, unsigned short c4,
+                             unsigned short c5)
+    {
+      return scanners.find(p, end, c1, c2, c3, c4, c5);
+    }
+
+    /**
+     * Find the first character which is not a blank (see
+     * Lexer::isWhiteSpace).
+     * @return pointer to the character or end if there is none.
+     */
+    static const UChar *skipBlanks(const UChar *p, const UChar *end)
+    {
+      return scanners.skipBlanks(p, end);
+    }
+
+    /**
+     * Implementations picked for the running CPU.
+     */
+    struct Scanners {
+      const UChar *(*find)(const UChar *p, const UChar *end,
+                           unsigned short c1, unsigned short c2,
+                           unsigned short c3, unsigned short c4,
+                           unsigned short c5);
+      const UChar *(*skipBlanks)(const UChar *p, const UChar *end);
+    };
+
+  private:
+    static const Scanners scanners;
+  };
+
+} // namespace
+
+#endif
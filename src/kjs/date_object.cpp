@@ -60,7 +60,7 @@
 #include "error_object.h"
 #include "operations.h"
 
-#include "date_object.lut.h"
+#include "lookup.h"
 
 #ifdef _MSC_VER
 #  define strncasecmp(a,b,c) _strnicmp(a,b,c)
@@ -285,58 +285,57 @@ DateInstanceImp::DateInstanceImp(ObjectImp *proto)
 
 // ------------------------------ DatePrototypeImp -----------------------------
 
+// We use a negative ID to denote the "UTC" variant.
+static constexpr HashEntry dateTableEntries[] = {
+  { "toString",           DateProtoFuncImp::ToString,           DontEnum|Function, 0 },
+  { "toUTCString",        DateProtoFuncImp::ToUTCString,        DontEnum|Function, 0 },
+  { "toDateString",       DateProtoFuncImp::ToDateString,       DontEnum|Function, 0 },
+  { "toTimeString",       DateProtoFuncImp::ToTimeString,       DontEnum|Function, 0 },
+  { "toLocaleString",     DateProtoFuncImp::ToLocaleString,     DontEnum|Function, 0 },
+  { "toLocaleDateString", DateProtoFuncImp::ToLocaleDateString, DontEnum|Function, 0 },
+  { "toLocaleTimeString", DateProtoFuncImp::ToLocaleTimeString, DontEnum|Function, 0 },
+  { "valueOf",            DateProtoFuncImp::ValueOf,            DontEnum|Function, 0 },
+  { "getTime",            DateProtoFuncImp::GetTime,            DontEnum|Function, 0 },
+  { "getFullYear",        DateProtoFuncImp::GetFullYear,        DontEnum|Function, 0 },
+  { "getUTCFullYear",     -DateProtoFuncImp::GetFullYear,       DontEnum|Function, 0 },
+  { "toGMTString",        DateProtoFuncImp::ToGMTString,        DontEnum|Function, 0 },
+  { "getMonth",           DateProtoFuncImp::GetMonth,           DontEnum|Function, 0 },
+  { "getUTCMonth",        -DateProtoFuncImp::GetMonth,          DontEnum|Function, 0 },
+  { "getDate",            DateProtoFuncImp::GetDate,            DontEnum|Function, 0 },
+  { "getUTCDate",         -DateProtoFuncImp::GetDate,           DontEnum|Function, 0 },
+  { "getDay",             DateProtoFuncImp::GetDay,             DontEnum|Function, 0 },
+  { "getUTCDay",          -DateProtoFuncImp::GetDay,            DontEnum|Function, 0 },
+  { "getHours",           DateProtoFuncImp::GetHours,           DontEnum|Function, 0 },
+  { "getUTCHours",        -DateProtoFuncImp::GetHours,          DontEnum|Function, 0 },
+  { "getMinutes",         DateProtoFuncImp::GetMinutes,         DontEnum|Function, 0 },
+  { "getUTCMinutes",      -DateProtoFuncImp::GetMinutes,        DontEnum|Function, 0 },
+  { "getSeconds",         DateProtoFuncImp::GetSeconds,         DontEnum|Function, 0 },
+  { "getUTCSeconds",      -DateProtoFuncImp::GetSeconds,        DontEnum|Function, 0 },
+  { "getMilliseconds",    DateProtoFuncImp::GetMilliSeconds,    DontEnum|Function, 0 },
+  { "getUTCMilliseconds", -DateProtoFuncImp::GetMilliSeconds,   DontEnum|Function, 0 },
+  { "getTimezoneOffset",  DateProtoFuncImp::GetTimezoneOffset,  DontEnum|Function, 0 },
+  { "setTime",            DateProtoFuncImp::SetTime,            DontEnum|Function, 1 },
+  { "setMilliseconds",    DateProtoFuncImp::SetMilliSeconds,    DontEnum|Function, 1 },
+  { "setUTCMilliseconds", -DateProtoFuncImp::SetMilliSeconds,   DontEnum|Function, 1 },
+  { "setSeconds",         DateProtoFuncImp::SetSeconds,         DontEnum|Function, 2 },
+  { "setUTCSeconds",      -DateProtoFuncImp::SetSeconds,        DontEnum|Function, 2 },
+  { "setMinutes",         DateProtoFuncImp::SetMinutes,         DontEnum|Function, 3 },
+  { "setUTCMinutes",      -DateProtoFuncImp::SetMinutes,        DontEnum|Function, 3 },
+  { "setHours",           DateProtoFuncImp::SetHours,           DontEnum|Function, 4 },
+  { "setUTCHours",        -DateProtoFuncImp::SetHours,          DontEnum|Function, 4 },
+  { "setDate",            DateProtoFuncImp::SetDate,            DontEnum|Function, 1 },
+  { "setUTCDate",         -DateProtoFuncImp::SetDate,           DontEnum|Function, 1 },
+  { "setMonth",           DateProtoFuncImp::SetMonth,           DontEnum|Function, 2 },
+  { "setUTCMonth",        -DateProtoFuncImp::SetMonth,          DontEnum|Function, 2 },
+  { "setFullYear",        DateProtoFuncImp::SetFullYear,        DontEnum|Function, 3 },
+  { "setUTCFullYear",     -DateProtoFuncImp::SetFullYear,       DontEnum|Function, 3 },
+  { "setYear",            DateProtoFuncImp::SetYear,            DontEnum|Function, 1 },
+  { "getYear",            DateProtoFuncImp::GetYear,            DontEnum|Function, 0 }
+};
+KJS_HASH_TABLE(dateTable);
+
 const ClassInfo DatePrototypeImp::info = {"Date", &DateInstanceImp::info, &dateTable, 0};
 
-/* Source for date_object.lut.h
-   We use a negative ID to denote the "UTC" variant.
-@begin dateTable 61
-  toString		DateProtoFuncImp::ToString		DontEnum|Function	0
-  toUTCString		DateProtoFuncImp::ToUTCString		DontEnum|Function	0
-  toDateString		DateProtoFuncImp::ToDateString		DontEnum|Function	0
-  toTimeString		DateProtoFuncImp::ToTimeString		DontEnum|Function	0
-  toLocaleString	DateProtoFuncImp::ToLocaleString	DontEnum|Function	0
-  toLocaleDateString	DateProtoFuncImp::ToLocaleDateString	DontEnum|Function	0
-  toLocaleTimeString	DateProtoFuncImp::ToLocaleTimeString	DontEnum|Function	0
-  valueOf		DateProtoFuncImp::ValueOf		DontEnum|Function	0
-  getTime		DateProtoFuncImp::GetTime		DontEnum|Function	0
-  getFullYear		DateProtoFuncImp::GetFullYear		DontEnum|Function	0
-  getUTCFullYear	-DateProtoFuncImp::GetFullYear		DontEnum|Function	0
-  toGMTString		DateProtoFuncImp::ToGMTString		DontEnum|Function	0
-  getMonth		DateProtoFuncImp::GetMonth		DontEnum|Function	0
-  getUTCMonth		-DateProtoFuncImp::GetMonth		DontEnum|Function	0
-  getDate		DateProtoFuncImp::GetDate		DontEnum|Function	0
-  getUTCDate		-DateProtoFuncImp::GetDate		DontEnum|Function	0
-  getDay		DateProtoFuncImp::GetDay		DontEnum|Function	0
-  getUTCDay		-DateProtoFuncImp::GetDay		DontEnum|Function	0
-  getHours		DateProtoFuncImp::GetHours		DontEnum|Function	0
-  getUTCHours		-DateProtoFuncImp::GetHours		DontEnum|Function	0
-  getMinutes		DateProtoFuncImp::GetMinutes		DontEnum|Function	0
-  getUTCMinutes		-DateProtoFuncImp::GetMinutes		DontEnum|Function	0
-  getSeconds		DateProtoFuncImp::GetSeconds		DontEnum|Function	0
-  getUTCSeconds		-DateProtoFuncImp::GetSeconds		DontEnum|Function	0
-  getMilliseconds	DateProtoFuncImp::GetMilliSeconds	DontEnum|Function	0
-  getUTCMilliseconds	-DateProtoFuncImp::GetMilliSeconds	DontEnum|Function	0
-  getTimezoneOffset	DateProtoFuncImp::GetTimezoneOffset	DontEnum|Function	0
-  setTime		DateProtoFuncImp::SetTime		DontEnum|Function	1
-  setMilliseconds	DateProtoFuncImp::SetMilliSeconds	DontEnum|Function	1
-  setUTCMilliseconds	-DateProtoFuncImp::SetMilliSeconds	DontEnum|Function	1
-  setSeconds		DateProtoFuncImp::SetSeconds		DontEnum|Function	2
-  setUTCSeconds		-DateProtoFuncImp::SetSeconds		DontEnum|Function	2
-  setMinutes		DateProtoFuncImp::SetMinutes		DontEnum|Function	3
-  setUTCMinutes		-DateProtoFuncImp::SetMinutes		DontEnum|Function	3
-  setHours		DateProtoFuncImp::SetHours		DontEnum|Function	4
-  setUTCHours		-DateProtoFuncImp::SetHours		DontEnum|Function	4
-  setDate		DateProtoFuncImp::SetDate		DontEnum|Function	1
-  setUTCDate		-DateProtoFuncImp::SetDate		DontEnum|Function	1
-  setMonth		DateProtoFuncImp::SetMonth		DontEnum|Function	2
-  setUTCMonth		-DateProtoFuncImp::SetMonth		DontEnum|Function	2
-  setFullYear		DateProtoFuncImp::SetFullYear		DontEnum|Function	3
-  setUTCFullYear	-DateProtoFuncImp::SetFullYear		DontEnum|Function	3
-  setYear		DateProtoFuncImp::SetYear		DontEnum|Function	1
-  getYear		DateProtoFuncImp::GetYear		DontEnum|Function	0
-  toGMTString		DateProtoFuncImp::ToGMTString		DontEnum|Function	0
-@end
-*/
 // ECMA 15.9.4
 
 DatePrototypeImp::DatePrototypeImp(ExecState *,
@@ -482,6 +482,16 @@ extern double rnd_prod(double, double), rnd_quot(double, double);
 #endif
 #endif /* NO_LONG_LONG */
 
+/* numbers are converted on several threads in batch mode */
+#ifdef HAVE_PTHREAD
+#define MULTIPLE_THREADS
+#include <pthread.h>
+static pthread_mutex_t dtoa_lock[2] = {
+	PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER };
+#define ACQUIRE_DTOA_LOCK(n)	pthread_mutex_lock(&dtoa_lock[n])
+#define FREE_DTOA_LOCK(n)	pthread_mutex_unlock(&dtoa_lock[n])
+#endif
+
 #ifndef MULTIPLE_THREADS
 #define ACQUIRE_DTOA_LOCK(n)	/*nothing*/
 #define FREE_DTOA_LOCK(n)	/*nothing*/
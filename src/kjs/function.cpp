@@ -786,7 +786,7 @@ Value GlobalFuncImp::call(ExecState *exec, Object &thisObj, const List &args)
       fprintf(stderr, "eval(): %s\n", s.ascii());
 #endif
       SourceCode *source;
-      FunctionBodyNode *progNode = Parser::parse(s.data(),s.size(),&source,&errLine,&errMsg);
+      FunctionBodyNode *progNode = Parser::parse(s,&source,&errLine,&errMsg);
 
       // notify debugger that source has been parsed
       Debugger *dbg = exec->interpreter()->imp()->debugger();
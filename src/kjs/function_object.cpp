@@ -221,7 +221,7 @@ Object FunctionObjectImp::construct(ExecState *exec, const List &args)
   SourceCode *source;
   int errLine;
   UString errMsg;
-  FunctionBodyNode *progNode = Parser::parse(body.data(),body.size(),&source,&errLine,&errMsg);
+  FunctionBodyNode *progNode = Parser::parse(body,&source,&errLine,&errMsg);
 
   // notify debugger that source has been parsed
   Debugger *dbg = exec->dynamicInterpreter()->imp()->debugger();
@@ -1,14 +1,14 @@
-/* A Bison parser, made by GNU Bison 2.2.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* Skeleton implementation for Bison's Yacc-like parsers in C
+/* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003, 2004, 2005, 2006
-   Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
-   This program is free software; you can redistribute it and/or modify
+   This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
 
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
@@ -16,9 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 51 Franklin Street, Fifth Floor,
-   Boston, MA 02110-1301, USA.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -36,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -43,165 +45,33 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.2"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
 
 /* Pure parsers.  */
-#define YYPURE 0
+#define YYPURE 1
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
 
-/* Using locations.  */
-#define YYLSP_NEEDED 1
 
 /* Substitute the variable and function names.  */
-#define yyparse kjsyyparse
-#define yylex   kjsyylex
-#define yyerror kjsyyerror
-#define yylval  kjsyylval
-#define yychar  kjsyychar
-#define yydebug kjsyydebug
-#define yynerrs kjsyynerrs
-#define yylloc kjsyylloc
-
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     NULLTOKEN = 258,
-     TRUETOKEN = 259,
-     FALSETOKEN = 260,
-     STRING = 261,
-     NUMBER = 262,
-     BREAK = 263,
-     CASE = 264,
-     DEFAULT = 265,
-     FOR = 266,
-     NEW = 267,
-     VAR = 268,
-     CONST = 269,
-     CONTINUE = 270,
-     FUNCTION = 271,
-     RETURN = 272,
-     VOID = 273,
-     DELETE = 274,
-     IF = 275,
-     THIS = 276,
-     DO = 277,
-     WHILE = 278,
-     ELSE = 279,
-     IN = 280,
-     INSTANCEOF = 281,
-     TYPEOF = 282,
-     SWITCH = 283,
-     WITH = 284,
-     RESERVED = 285,
-     THROW = 286,
-     TRY = 287,
-     CATCH = 288,
-     FINALLY = 289,
-     DEBUGGER = 290,
-     EQEQ = 291,
-     NE = 292,
-     STREQ = 293,
-     STRNEQ = 294,
-     LE = 295,
-     GE = 296,
-     OR = 297,
-     AND = 298,
-     PLUSPLUS = 299,
-     MINUSMINUS = 300,
-     LSHIFT = 301,
-     RSHIFT = 302,
-     URSHIFT = 303,
-     PLUSEQUAL = 304,
-     MINUSEQUAL = 305,
-     MULTEQUAL = 306,
-     DIVEQUAL = 307,
-     LSHIFTEQUAL = 308,
-     RSHIFTEQUAL = 309,
-     URSHIFTEQUAL = 310,
-     ANDEQUAL = 311,
-     MODEQUAL = 312,
-     XOREQUAL = 313,
-     OREQUAL = 314,
-     IDENT = 315,
-     AUTOPLUSPLUS = 316,
-     AUTOMINUSMINUS = 317
-   };
-#endif
-/* Tokens.  */
-#define NULLTOKEN 258
-#define TRUETOKEN 259
-#define FALSETOKEN 260
-#define STRING 261
-#define NUMBER 262
-#define BREAK 263
-#define CASE 264
-#define DEFAULT 265
-#define FOR 266
-#define NEW 267
-#define VAR 268
-#define CONST 269
-#define CONTINUE 270
-#define FUNCTION 271
-#define RETURN 272
-#define VOID 273
-#define DELETE 274
-#define IF 275
-#define THIS 276
-#define DO 277
-#define WHILE 278
-#define ELSE 279
-#define IN 280
-#define INSTANCEOF 281
-#define TYPEOF 282
-#define SWITCH 283
-#define WITH 284
-#define RESERVED 285
-#define THROW 286
-#define TRY 287
-#define CATCH 288
-#define FINALLY 289
-#define DEBUGGER 290
-#define EQEQ 291
-#define NE 292
-#define STREQ 293
-#define STRNEQ 294
-#define LE 295
-#define GE 296
-#define OR 297
-#define AND 298
-#define PLUSPLUS 299
-#define MINUSMINUS 300
-#define LSHIFT 301
-#define RSHIFT 302
-#define URSHIFT 303
-#define PLUSEQUAL 304
-#define MINUSEQUAL 305
-#define MULTEQUAL 306
-#define DIVEQUAL 307
-#define LSHIFTEQUAL 308
-#define RSHIFTEQUAL 309
-#define URSHIFTEQUAL 310
-#define ANDEQUAL 311
-#define MODEQUAL 312
-#define XOREQUAL 313
-#define OREQUAL 314
-#define IDENT 315
-#define AUTOPLUSPLUS 316
-#define AUTOMINUSMINUS 317
-
-
-
-
-/* Copy the first part of user declarations.  */
+#define yyparse         kjsyyparse
+#define yylex           kjsyylex
+#define yyerror         kjsyyerror
+#define yydebug         kjsyydebug
+#define yynerrs         kjsyynerrs
+
+/* First part of user prologue.  */
 #line 1 "grammar.y"
 
 
@@ -244,122 +114,291 @@
 #undef YYMAXDEPTH
 #endif
 #define YYERROR_VERBOSE
-#define DBG(l, s, e) { l->setLoc(s.first_line, e.last_line, Parser::source); } // location
-
-extern int yylex();
-static int yyerror (const char *);
-static bool automatic();
+#define DBG(l, s, e) { l->setLoc(s.first_line, e.last_line, parser->source); } // location
 
 using namespace KJS;
 
+extern int yylex(void *lvalp, void *llocp, Parser *parser);
+static int yyerror(void *llocp, Parser *parser, const char *);
+static bool automatic(Parser *parser, int yychar);
 
 
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
+#line 127 "grammar.cpp"
 
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
-#endif
-
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
-#line 52 "grammar.y"
-{
-  int                 ival;
-  double              dval;
-  UString             *ustr;
-  Identifier          *ident;
-  Node                *node;
-  StatementNode       *stat;
-  ParameterNode       *param;
-  FunctionBodyNode    *body;
-  FuncDeclNode        *func;
-  FunctionBodyNode    *prog;
-  AssignExprNode      *init;
-  SourceElementsNode  *srcs;
-  StatListNode        *slist;
-  ArgumentsNode       *args;
-  ArgumentListNode    *alist;
-  VarDeclNode         *decl;
-  VarDeclListNode     *vlist;
-  CaseBlockNode       *cblk;
-  ClauseListNode      *clist;
-  CaseClauseNode      *ccl;
-  ElementNode         *elm;
-  Operator            op;
-  PropertyValueNode   *plist;
-  PropertyNode        *pnode;
-  CatchNode           *cnode;
-  FinallyNode         *fnode;
-}
-/* Line 193 of yacc.c.  */
-#line 308 "grammar.tab.c"
-	YYSTYPE;
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
-# define YYSTYPE_IS_TRIVIAL 1
-#endif
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
 
-#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
-typedef struct YYLTYPE
+#include "grammar.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-  int first_line;
-  int first_column;
-  int last_line;
-  int last_column;
-} YYLTYPE;
-# define yyltype YYLTYPE /* obsolescent; will be withdrawn */
-# define YYLTYPE_IS_DECLARED 1
-# define YYLTYPE_IS_TRIVIAL 1
-#endif
-
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_NULLTOKEN = 3,                  /* NULLTOKEN  */
+  YYSYMBOL_TRUETOKEN = 4,                  /* TRUETOKEN  */
+  YYSYMBOL_FALSETOKEN = 5,                 /* FALSETOKEN  */
+  YYSYMBOL_STRING = 6,                     /* STRING  */
+  YYSYMBOL_NUMBER = 7,                     /* NUMBER  */
+  YYSYMBOL_BREAK = 8,                      /* BREAK  */
+  YYSYMBOL_CASE = 9,                       /* CASE  */
+  YYSYMBOL_DEFAULT = 10,                   /* DEFAULT  */
+  YYSYMBOL_FOR = 11,                       /* FOR  */
+  YYSYMBOL_NEW = 12,                       /* NEW  */
+  YYSYMBOL_VAR = 13,                       /* VAR  */
+  YYSYMBOL_CONST = 14,                     /* CONST  */
+  YYSYMBOL_CONTINUE = 15,                  /* CONTINUE  */
+  YYSYMBOL_FUNCTION = 16,                  /* FUNCTION  */
+  YYSYMBOL_RETURN = 17,                    /* RETURN  */
+  YYSYMBOL_VOID = 18,                      /* VOID  */
+  YYSYMBOL_DELETE = 19,                    /* DELETE  */
+  YYSYMBOL_IF = 20,                        /* IF  */
+  YYSYMBOL_THIS = 21,                      /* THIS  */
+  YYSYMBOL_DO = 22,                        /* DO  */
+  YYSYMBOL_WHILE = 23,                     /* WHILE  */
+  YYSYMBOL_ELSE = 24,                      /* ELSE  */
+  YYSYMBOL_IN = 25,                        /* IN  */
+  YYSYMBOL_INSTANCEOF = 26,                /* INSTANCEOF  */
+  YYSYMBOL_TYPEOF = 27,                    /* TYPEOF  */
+  YYSYMBOL_SWITCH = 28,                    /* SWITCH  */
+  YYSYMBOL_WITH = 29,                      /* WITH  */
+  YYSYMBOL_RESERVED = 30,                  /* RESERVED  */
+  YYSYMBOL_THROW = 31,                     /* THROW  */
+  YYSYMBOL_TRY = 32,                       /* TRY  */
+  YYSYMBOL_CATCH = 33,                     /* CATCH  */
+  YYSYMBOL_FINALLY = 34,                   /* FINALLY  */
+  YYSYMBOL_DEBUGGER = 35,                  /* DEBUGGER  */
+  YYSYMBOL_EQEQ = 36,                      /* EQEQ  */
+  YYSYMBOL_NE = 37,                        /* NE  */
+  YYSYMBOL_STREQ = 38,                     /* STREQ  */
+  YYSYMBOL_STRNEQ = 39,                    /* STRNEQ  */
+  YYSYMBOL_LE = 40,                        /* LE  */
+  YYSYMBOL_GE = 41,                        /* GE  */
+  YYSYMBOL_OR = 42,                        /* OR  */
+  YYSYMBOL_AND = 43,                       /* AND  */
+  YYSYMBOL_PLUSPLUS = 44,                  /* PLUSPLUS  */
+  YYSYMBOL_MINUSMINUS = 45,                /* MINUSMINUS  */
+  YYSYMBOL_LSHIFT = 46,                    /* LSHIFT  */
+  YYSYMBOL_RSHIFT = 47,                    /* RSHIFT  */
+  YYSYMBOL_URSHIFT = 48,                   /* URSHIFT  */
+  YYSYMBOL_PLUSEQUAL = 49,                 /* PLUSEQUAL  */
+  YYSYMBOL_MINUSEQUAL = 50,                /* MINUSEQUAL  */
+  YYSYMBOL_MULTEQUAL = 51,                 /* MULTEQUAL  */
+  YYSYMBOL_DIVEQUAL = 52,                  /* DIVEQUAL  */
+  YYSYMBOL_LSHIFTEQUAL = 53,               /* LSHIFTEQUAL  */
+  YYSYMBOL_RSHIFTEQUAL = 54,               /* RSHIFTEQUAL  */
+  YYSYMBOL_URSHIFTEQUAL = 55,              /* URSHIFTEQUAL  */
+  YYSYMBOL_ANDEQUAL = 56,                  /* ANDEQUAL  */
+  YYSYMBOL_MODEQUAL = 57,                  /* MODEQUAL  */
+  YYSYMBOL_XOREQUAL = 58,                  /* XOREQUAL  */
+  YYSYMBOL_OREQUAL = 59,                   /* OREQUAL  */
+  YYSYMBOL_IDENT = 60,                     /* IDENT  */
+  YYSYMBOL_AUTOPLUSPLUS = 61,              /* AUTOPLUSPLUS  */
+  YYSYMBOL_AUTOMINUSMINUS = 62,            /* AUTOMINUSMINUS  */
+  YYSYMBOL_63_ = 63,                       /* '/'  */
+  YYSYMBOL_64_ = 64,                       /* '('  */
+  YYSYMBOL_65_ = 65,                       /* ')'  */
+  YYSYMBOL_66_ = 66,                       /* '{'  */
+  YYSYMBOL_67_ = 67,                       /* '}'  */
+  YYSYMBOL_68_ = 68,                       /* ','  */
+  YYSYMBOL_69_ = 69,                       /* '['  */
+  YYSYMBOL_70_ = 70,                       /* ']'  */
+  YYSYMBOL_71_ = 71,                       /* ':'  */
+  YYSYMBOL_72_ = 72,                       /* '.'  */
+  YYSYMBOL_73_ = 73,                       /* '+'  */
+  YYSYMBOL_74_ = 74,                       /* '-'  */
+  YYSYMBOL_75_ = 75,                       /* '~'  */
+  YYSYMBOL_76_ = 76,                       /* '!'  */
+  YYSYMBOL_77_ = 77,                       /* '*'  */
+  YYSYMBOL_78_ = 78,                       /* '%'  */
+  YYSYMBOL_79_ = 79,                       /* '<'  */
+  YYSYMBOL_80_ = 80,                       /* '>'  */
+  YYSYMBOL_81_ = 81,                       /* '&'  */
+  YYSYMBOL_82_ = 82,                       /* '^'  */
+  YYSYMBOL_83_ = 83,                       /* '|'  */
+  YYSYMBOL_84_ = 84,                       /* '?'  */
+  YYSYMBOL_85_ = 85,                       /* '='  */
+  YYSYMBOL_86_ = 86,                       /* ';'  */
+  YYSYMBOL_YYACCEPT = 87,                  /* $accept  */
+  YYSYMBOL_Literal = 88,                   /* Literal  */
+  YYSYMBOL_PrimaryExpr = 89,               /* PrimaryExpr  */
+  YYSYMBOL_ArrayLiteral = 90,              /* ArrayLiteral  */
+  YYSYMBOL_ElementList = 91,               /* ElementList  */
+  YYSYMBOL_ElisionOpt = 92,                /* ElisionOpt  */
+  YYSYMBOL_Elision = 93,                   /* Elision  */
+  YYSYMBOL_PropertyNameAndValueList = 94,  /* PropertyNameAndValueList  */
+  YYSYMBOL_PropertyName = 95,              /* PropertyName  */
+  YYSYMBOL_MemberExpr = 96,                /* MemberExpr  */
+  YYSYMBOL_NewExpr = 97,                   /* NewExpr  */
+  YYSYMBOL_CallExpr = 98,                  /* CallExpr  */
+  YYSYMBOL_Arguments = 99,                 /* Arguments  */
+  YYSYMBOL_ArgumentList = 100,             /* ArgumentList  */
+  YYSYMBOL_LeftHandSideExpr = 101,         /* LeftHandSideExpr  */
+  YYSYMBOL_PostfixExpr = 102,              /* PostfixExpr  */
+  YYSYMBOL_UnaryExpr = 103,                /* UnaryExpr  */
+  YYSYMBOL_MultiplicativeExpr = 104,       /* MultiplicativeExpr  */
+  YYSYMBOL_AdditiveExpr = 105,             /* AdditiveExpr  */
+  YYSYMBOL_ShiftExpr = 106,                /* ShiftExpr  */
+  YYSYMBOL_RelationalExpr = 107,           /* RelationalExpr  */
+  YYSYMBOL_EqualityExpr = 108,             /* EqualityExpr  */
+  YYSYMBOL_BitwiseANDExpr = 109,           /* BitwiseANDExpr  */
+  YYSYMBOL_BitwiseXORExpr = 110,           /* BitwiseXORExpr  */
+  YYSYMBOL_BitwiseORExpr = 111,            /* BitwiseORExpr  */
+  YYSYMBOL_LogicalANDExpr = 112,           /* LogicalANDExpr  */
+  YYSYMBOL_LogicalORExpr = 113,            /* LogicalORExpr  */
+  YYSYMBOL_ConditionalExpr = 114,          /* ConditionalExpr  */
+  YYSYMBOL_AssignmentExpr = 115,           /* AssignmentExpr  */
+  YYSYMBOL_AssignmentOperator = 116,       /* AssignmentOperator  */
+  YYSYMBOL_Expr = 117,                     /* Expr  */
+  YYSYMBOL_Statement = 118,                /* Statement  */
+  YYSYMBOL_Block = 119,                    /* Block  */
+  YYSYMBOL_StatementList = 120,            /* StatementList  */
+  YYSYMBOL_VariableStatement = 121,        /* VariableStatement  */
+  YYSYMBOL_VariableDeclarationList = 122,  /* VariableDeclarationList  */
+  YYSYMBOL_VariableDeclaration = 123,      /* VariableDeclaration  */
+  YYSYMBOL_ConstStatement = 124,           /* ConstStatement  */
+  YYSYMBOL_ConstDeclarationList = 125,     /* ConstDeclarationList  */
+  YYSYMBOL_ConstDeclaration = 126,         /* ConstDeclaration  */
+  YYSYMBOL_Initializer = 127,              /* Initializer  */
+  YYSYMBOL_EmptyStatement = 128,           /* EmptyStatement  */
+  YYSYMBOL_ExprStatement = 129,            /* ExprStatement  */
+  YYSYMBOL_IfStatement = 130,              /* IfStatement  */
+  YYSYMBOL_IterationStatement = 131,       /* IterationStatement  */
+  YYSYMBOL_ExprOpt = 132,                  /* ExprOpt  */
+  YYSYMBOL_ContinueStatement = 133,        /* ContinueStatement  */
+  YYSYMBOL_BreakStatement = 134,           /* BreakStatement  */
+  YYSYMBOL_ReturnStatement = 135,          /* ReturnStatement  */
+  YYSYMBOL_WithStatement = 136,            /* WithStatement  */
+  YYSYMBOL_SwitchStatement = 137,          /* SwitchStatement  */
+  YYSYMBOL_CaseBlock = 138,                /* CaseBlock  */
+  YYSYMBOL_CaseClausesOpt = 139,           /* CaseClausesOpt  */
+  YYSYMBOL_CaseClauses = 140,              /* CaseClauses  */
+  YYSYMBOL_CaseClause = 141,               /* CaseClause  */
+  YYSYMBOL_DefaultClause = 142,            /* DefaultClause  */
+  YYSYMBOL_LabelledStatement = 143,        /* LabelledStatement  */
+  YYSYMBOL_ThrowStatement = 144,           /* ThrowStatement  */
+  YYSYMBOL_TryStatement = 145,             /* TryStatement  */
+  YYSYMBOL_DebuggerStatement = 146,        /* DebuggerStatement  */
+  YYSYMBOL_Catch = 147,                    /* Catch  */
+  YYSYMBOL_Finally = 148,                  /* Finally  */
+  YYSYMBOL_FunctionDeclaration = 149,      /* FunctionDeclaration  */
+  YYSYMBOL_FunctionDeclarationInternal = 150, /* FunctionDeclarationInternal  */
+  YYSYMBOL_FunctionExpr = 151,             /* FunctionExpr  */
+  YYSYMBOL_FormalParameterList = 152,      /* FormalParameterList  */
+  YYSYMBOL_FunctionBody = 153,             /* FunctionBody  */
+  YYSYMBOL_Program = 154,                  /* Program  */
+  YYSYMBOL_SourceElements = 155,           /* SourceElements  */
+  YYSYMBOL_SourceElement = 156             /* SourceElement  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-/* Copy the second part of user declarations.  */
 
 
-/* Line 216 of yacc.c.  */
-#line 333 "grammar.tab.c"
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
 typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef short int yytype_int8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -367,55 +406,106 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
-# if YYENABLE_NLS
+# if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int i)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (i)
-    int i;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return i;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -432,11 +522,11 @@ YYID (i)
 #    define alloca _alloca
 #   else
 #    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
 #     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#     ifndef _STDLIB_H
-#      define _STDLIB_H 1
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
 #     endif
 #    endif
 #   endif
@@ -444,8 +534,8 @@ YYID (i)
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -459,90 +549,92 @@ YYID (i)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
 #   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
 #  endif
-#  if (defined __cplusplus && ! defined _STDLIB_H \
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#   ifndef _STDLIB_H
-#    define _STDLIB_H 1
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
 #   endif
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL \
-	     && defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL \
+             && defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss;
-  YYSTYPE yyvs;
-    YYLTYPE yyls;
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+  YYLTYPE yyls_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE) + sizeof (YYLTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
       + 2 * YYSTACK_GAP_MAXIMUM)
 
-/* Copy COUNT objects from FROM to TO.  The source and destination do
-   not overlap.  */
-# ifndef YYCOPY
-#  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
-#  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  YYSIZE_T yyi;				\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (YYID (0))
-#  endif
-# endif
+# define YYCOPY_NEEDED 1
 
 /* Relocate STACK from its old location to the new one.  The
    local variables YYSIZE and YYSTACKSIZE give the old and new number of
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack)					\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack, Stack, yysize);				\
-	Stack = &yyptr->Stack;						\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  195
 /* YYLAST -- Last index in YYTABLE.  */
@@ -554,18 +646,23 @@ union yyalloc
 #define YYNNTS  70
 /* YYNRULES -- Number of rules.  */
 #define YYNRULES  210
-/* YYNRULES -- Number of states.  */
+/* YYNSTATES -- Number of states.  */
 #define YYNSTATES  377
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   317
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
-static const yytype_uint8 yytranslate[] =
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -602,306 +699,97 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint16 yyprhs[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,     0,     3,     5,     7,     9,    11,    13,    15,    17,
-      19,    21,    23,    25,    29,    32,    36,    41,    45,    49,
-      55,    58,    63,    64,    66,    68,    71,    75,    81,    83,
-      85,    87,    89,    91,    96,   100,   104,   106,   109,   112,
-     115,   120,   124,   127,   131,   133,   137,   139,   141,   143,
-     146,   149,   151,   154,   157,   160,   163,   166,   169,   172,
-     175,   178,   181,   184,   186,   190,   194,   198,   200,   204,
-     208,   210,   214,   218,   222,   224,   228,   232,   236,   240,
-     244,   248,   250,   254,   258,   262,   266,   268,   272,   274,
-     278,   280,   284,   286,   290,   292,   296,   298,   304,   306,
-     310,   312,   314,   316,   318,   320,   322,   324,   326,   328,
-     330,   332,   334,   336,   340,   342,   344,   346,   348,   350,
-     352,   354,   356,   358,   360,   362,   364,   366,   368,   370,
-     372,   375,   379,   381,   384,   388,   392,   394,   398,   400,
-     403,   407,   411,   413,   417,   419,   422,   425,   427,   430,
-     433,   439,   447,   454,   460,   470,   481,   489,   498,   508,
-     509,   511,   514,   517,   521,   525,   528,   531,   535,   539,
-     542,   545,   549,   553,   559,   565,   569,   575,   576,   578,
-     580,   583,   587,   592,   595,   599,   603,   607,   611,   615,
-     619,   624,   627,   630,   636,   639,   641,   644,   650,   657,
-     662,   668,   670,   674,   677,   681,   682,   684,   686,   689,
-     691
+       0,   173,   173,   174,   175,   176,   177,   178,   181,   188,
+     189,   190,   191,   192,   193,   194,   195,   199,   200,   201,
+     205,   206,   211,   212,   216,   217,   221,   222,   227,   228,
+     229,   233,   234,   235,   236,   237,   241,   242,   246,   247,
+     248,   249,   253,   254,   258,   259,   263,   264,   268,   269,
+     270,   274,   275,   276,   277,   278,   279,   280,   281,   282,
+     283,   284,   285,   289,   290,   291,   292,   296,   297,   298,
+     302,   303,   304,   305,   309,   310,   312,   314,   316,   318,
+     320,   325,   326,   327,   328,   329,   333,   334,   338,   339,
+     343,   344,   348,   349,   354,   355,   360,   361,   366,   367,
+     372,   373,   374,   375,   376,   377,   378,   379,   380,   381,
+     382,   383,   387,   388,   392,   393,   394,   395,   396,   397,
+     398,   399,   400,   401,   402,   403,   404,   405,   406,   407,
+     411,   412,   416,   417,   421,   423,   433,   434,   439,   440,
+     444,   446,   456,   457,   462,   463,   467,   471,   475,   477,
+     485,   486,   491,   492,   493,   496,   499,   502,   505,   511,
+     512,   516,   517,   521,   522,   529,   530,   534,   535,   543,
+     544,   548,   549,   557,   562,   567,   568,   573,   574,   578,
+     579,   583,   584,   588,   589,   593,   598,   599,   606,   607,
+     608,   612,   613,   622,   627,   631,   633,   637,   638,   643,
+     644,   650,   651,   655,   657,   662,   665,   670,   671,   675,
+     676
 };
+#endif
 
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int16 yyrhs[] =
-{
-     154,     0,    -1,     3,    -1,     4,    -1,     5,    -1,     7,
-      -1,     6,    -1,    63,    -1,    52,    -1,    21,    -1,    60,
-      -1,    88,    -1,    90,    -1,    64,   117,    65,    -1,    66,
-      67,    -1,    66,    94,    67,    -1,    66,    94,    68,    67,
-      -1,    69,    92,    70,    -1,    69,    91,    70,    -1,    69,
-      91,    68,    92,    70,    -1,    92,   115,    -1,    91,    68,
-      92,   115,    -1,    -1,    93,    -1,    68,    -1,    93,    68,
-      -1,    95,    71,   115,    -1,    94,    68,    95,    71,   115,
-      -1,    60,    -1,     6,    -1,     7,    -1,    89,    -1,   151,
-      -1,    96,    69,   117,    70,    -1,    96,    72,    60,    -1,
-      12,    96,    99,    -1,    96,    -1,    12,    97,    -1,    96,
-      99,    -1,    98,    99,    -1,    98,    69,   117,    70,    -1,
-      98,    72,    60,    -1,    64,    65,    -1,    64,   100,    65,
-      -1,   115,    -1,   100,    68,   115,    -1,    97,    -1,    98,
-      -1,   101,    -1,   101,    44,    -1,   101,    45,    -1,   102,
-      -1,    19,   103,    -1,    18,   103,    -1,    27,   103,    -1,
-      44,   103,    -1,    61,   103,    -1,    45,   103,    -1,    62,
-     103,    -1,    73,   103,    -1,    74,   103,    -1,    75,   103,
-      -1,    76,   103,    -1,   103,    -1,   104,    77,   103,    -1,
-     104,    63,   103,    -1,   104,    78,   103,    -1,   104,    -1,
-     105,    73,   104,    -1,   105,    74,   104,    -1,   105,    -1,
-     106,    46,   105,    -1,   106,    47,   105,    -1,   106,    48,
-     105,    -1,   106,    -1,   107,    79,   106,    -1,   107,    80,
-     106,    -1,   107,    40,   106,    -1,   107,    41,   106,    -1,
-     107,    26,   106,    -1,   107,    25,   106,    -1,   107,    -1,
-     108,    36,   107,    -1,   108,    37,   107,    -1,   108,    38,
-     107,    -1,   108,    39,   107,    -1,   108,    -1,   109,    81,
-     108,    -1,   109,    -1,   110,    82,   109,    -1,   110,    -1,
-     111,    83,   110,    -1,   111,    -1,   112,    43,   111,    -1,
-     112,    -1,   113,    42,   112,    -1,   113,    -1,   113,    84,
-     115,    71,   115,    -1,   114,    -1,   101,   116,   115,    -1,
-      85,    -1,    49,    -1,    50,    -1,    51,    -1,    52,    -1,
-      53,    -1,    54,    -1,    55,    -1,    56,    -1,    58,    -1,
-      59,    -1,    57,    -1,   115,    -1,   117,    68,   115,    -1,
-     119,    -1,   121,    -1,   124,    -1,   128,    -1,   129,    -1,
-     130,    -1,   131,    -1,   133,    -1,   134,    -1,   135,    -1,
-     136,    -1,   137,    -1,   143,    -1,   144,    -1,   145,    -1,
-     146,    -1,    66,    67,    -1,    66,   155,    67,    -1,   118,
-      -1,   120,   118,    -1,    13,   122,    86,    -1,    13,   122,
-       1,    -1,   123,    -1,   122,    68,   123,    -1,    60,    -1,
-      60,   127,    -1,    14,   125,    86,    -1,    14,   125,     1,
-      -1,   126,    -1,   125,    68,   123,    -1,    60,    -1,    60,
-     127,    -1,    85,   115,    -1,    86,    -1,   117,    86,    -1,
-     117,     1,    -1,    20,    64,   117,    65,   118,    -1,    20,
-      64,   117,    65,   118,    24,   118,    -1,    22,   118,    23,
-      64,   117,    65,    -1,    23,    64,   117,    65,   118,    -1,
-      11,    64,   132,    86,   132,    86,   132,    65,   118,    -1,
-      11,    64,    13,   122,    86,   132,    86,   132,    65,   118,
-      -1,    11,    64,   101,    25,   117,    65,   118,    -1,    11,
-      64,    13,    60,    25,   117,    65,   118,    -1,    11,    64,
-      13,    60,   127,    25,   117,    65,   118,    -1,    -1,   117,
-      -1,    15,    86,    -1,    15,     1,    -1,    15,    60,    86,
-      -1,    15,    60,     1,    -1,     8,    86,    -1,     8,     1,
-      -1,     8,    60,    86,    -1,     8,    60,     1,    -1,    17,
-      86,    -1,    17,     1,    -1,    17,   117,    86,    -1,    17,
-     117,     1,    -1,    29,    64,   117,    65,   118,    -1,    28,
-      64,   117,    65,   138,    -1,    66,   139,    67,    -1,    66,
-     139,   142,   139,    67,    -1,    -1,   140,    -1,   141,    -1,
-     140,   141,    -1,     9,   117,    71,    -1,     9,   117,    71,
-     120,    -1,    10,    71,    -1,    10,    71,   120,    -1,    60,
-      71,   118,    -1,    31,   117,    86,    -1,    31,   117,     1,
-      -1,    32,   119,   147,    -1,    32,   119,   148,    -1,    32,
-     119,   147,   148,    -1,    35,    86,    -1,    35,     1,    -1,
-      33,    64,    60,    65,   119,    -1,    34,   119,    -1,   150,
-      -1,    18,   150,    -1,    16,    60,    64,    65,   153,    -1,
-      16,    60,    64,   152,    65,   153,    -1,    16,    64,    65,
-     153,    -1,    16,    64,   152,    65,   153,    -1,    60,    -1,
-     152,    68,    60,    -1,    66,    67,    -1,    66,   155,    67,
-      -1,    -1,   155,    -1,   156,    -1,   155,   156,    -1,   118,
-      -1,   149,    -1
-};
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,   169,   169,   170,   171,   172,   173,   174,   177,   184,
-     185,   186,   187,   188,   189,   190,   191,   195,   196,   197,
-     201,   202,   207,   208,   212,   213,   217,   218,   223,   224,
-     225,   229,   230,   231,   232,   233,   237,   238,   242,   243,
-     244,   245,   249,   250,   254,   255,   259,   260,   264,   265,
-     266,   270,   271,   272,   273,   274,   275,   276,   277,   278,
-     279,   280,   281,   285,   286,   287,   288,   292,   293,   294,
-     298,   299,   300,   301,   305,   306,   308,   310,   312,   314,
-     316,   321,   322,   323,   324,   325,   329,   330,   334,   335,
-     339,   340,   344,   345,   350,   351,   356,   357,   362,   363,
-     368,   369,   370,   371,   372,   373,   374,   375,   376,   377,
-     378,   379,   383,   384,   388,   389,   390,   391,   392,   393,
-     394,   395,   396,   397,   398,   399,   400,   401,   402,   403,
-     407,   408,   412,   413,   417,   419,   429,   430,   435,   436,
-     440,   442,   452,   453,   458,   459,   463,   467,   471,   473,
-     481,   482,   487,   488,   489,   492,   495,   498,   501,   507,
-     508,   512,   513,   517,   518,   525,   526,   530,   531,   539,
-     540,   544,   545,   553,   558,   563,   564,   569,   570,   574,
-     575,   579,   580,   584,   585,   589,   594,   595,   602,   603,
-     604,   608,   609,   618,   623,   627,   629,   633,   634,   639,
-     640,   646,   647,   651,   653,   658,   661,   666,   667,   671,
-     672
-};
-#endif
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "NULLTOKEN", "TRUETOKEN", "FALSETOKEN",
-  "STRING", "NUMBER", "BREAK", "CASE", "DEFAULT", "FOR", "NEW", "VAR",
-  "CONST", "CONTINUE", "FUNCTION", "RETURN", "VOID", "DELETE", "IF",
-  "THIS", "DO", "WHILE", "ELSE", "IN", "INSTANCEOF", "TYPEOF", "SWITCH",
-  "WITH", "RESERVED", "THROW", "TRY", "CATCH", "FINALLY", "DEBUGGER",
-  "EQEQ", "NE", "STREQ", "STRNEQ", "LE", "GE", "OR", "AND", "PLUSPLUS",
-  "MINUSMINUS", "LSHIFT", "RSHIFT", "URSHIFT", "PLUSEQUAL", "MINUSEQUAL",
-  "MULTEQUAL", "DIVEQUAL", "LSHIFTEQUAL", "RSHIFTEQUAL", "URSHIFTEQUAL",
-  "ANDEQUAL", "MODEQUAL", "XOREQUAL", "OREQUAL", "IDENT", "AUTOPLUSPLUS",
-  "AUTOMINUSMINUS", "'/'", "'('", "')'", "'{'", "'}'", "','", "'['", "']'",
-  "':'", "'.'", "'+'", "'-'", "'~'", "'!'", "'*'", "'%'", "'<'", "'>'",
-  "'&'", "'^'", "'|'", "'?'", "'='", "';'", "$accept", "Literal",
-  "PrimaryExpr", "ArrayLiteral", "ElementList", "ElisionOpt", "Elision",
-  "PropertyNameAndValueList", "PropertyName", "MemberExpr", "NewExpr",
-  "CallExpr", "Arguments", "ArgumentList", "LeftHandSideExpr",
-  "PostfixExpr", "UnaryExpr", "MultiplicativeExpr", "AdditiveExpr",
-  "ShiftExpr", "RelationalExpr", "EqualityExpr", "BitwiseANDExpr",
-  "BitwiseXORExpr", "BitwiseORExpr", "LogicalANDExpr", "LogicalORExpr",
-  "ConditionalExpr", "AssignmentExpr", "AssignmentOperator", "Expr",
-  "Statement", "Block", "StatementList", "VariableStatement",
-  "VariableDeclarationList", "VariableDeclaration", "ConstStatement",
-  "ConstDeclarationList", "ConstDeclaration", "Initializer",
-  "EmptyStatement", "ExprStatement", "IfStatement", "IterationStatement",
-  "ExprOpt", "ContinueStatement", "BreakStatement", "ReturnStatement",
-  "WithStatement", "SwitchStatement", "CaseBlock", "CaseClausesOpt",
-  "CaseClauses", "CaseClause", "DefaultClause", "LabelledStatement",
-  "ThrowStatement", "TryStatement", "DebuggerStatement", "Catch",
-  "Finally", "FunctionDeclaration", "FunctionDeclarationInternal",
-  "FunctionExpr", "FormalParameterList", "FunctionBody", "Program",
-  "SourceElements", "SourceElement", 0
+  "\"end of file\"", "error", "\"invalid token\"", "NULLTOKEN",
+  "TRUETOKEN", "FALSETOKEN", "STRING", "NUMBER", "BREAK", "CASE",
+  "DEFAULT", "FOR", "NEW", "VAR", "CONST", "CONTINUE", "FUNCTION",
+  "RETURN", "VOID", "DELETE", "IF", "THIS", "DO", "WHILE", "ELSE", "IN",
+  "INSTANCEOF", "TYPEOF", "SWITCH", "WITH", "RESERVED", "THROW", "TRY",
+  "CATCH", "FINALLY", "DEBUGGER", "EQEQ", "NE", "STREQ", "STRNEQ", "LE",
+  "GE", "OR", "AND", "PLUSPLUS", "MINUSMINUS", "LSHIFT", "RSHIFT",
+  "URSHIFT", "PLUSEQUAL", "MINUSEQUAL", "MULTEQUAL", "DIVEQUAL",
+  "LSHIFTEQUAL", "RSHIFTEQUAL", "URSHIFTEQUAL", "ANDEQUAL", "MODEQUAL",
+  "XOREQUAL", "OREQUAL", "IDENT", "AUTOPLUSPLUS", "AUTOMINUSMINUS", "'/'",
+  "'('", "')'", "'{'", "'}'", "','", "'['", "']'", "':'", "'.'", "'+'",
+  "'-'", "'~'", "'!'", "'*'", "'%'", "'<'", "'>'", "'&'", "'^'", "'|'",
+  "'?'", "'='", "';'", "$accept", "Literal", "PrimaryExpr", "ArrayLiteral",
+  "ElementList", "ElisionOpt", "Elision", "PropertyNameAndValueList",
+  "PropertyName", "MemberExpr", "NewExpr", "CallExpr", "Arguments",
+  "ArgumentList", "LeftHandSideExpr", "PostfixExpr", "UnaryExpr",
+  "MultiplicativeExpr", "AdditiveExpr", "ShiftExpr", "RelationalExpr",
+  "EqualityExpr", "BitwiseANDExpr", "BitwiseXORExpr", "BitwiseORExpr",
+  "LogicalANDExpr", "LogicalORExpr", "ConditionalExpr", "AssignmentExpr",
+  "AssignmentOperator", "Expr", "Statement", "Block", "StatementList",
+  "VariableStatement", "VariableDeclarationList", "VariableDeclaration",
+  "ConstStatement", "ConstDeclarationList", "ConstDeclaration",
+  "Initializer", "EmptyStatement", "ExprStatement", "IfStatement",
+  "IterationStatement", "ExprOpt", "ContinueStatement", "BreakStatement",
+  "ReturnStatement", "WithStatement", "SwitchStatement", "CaseBlock",
+  "CaseClausesOpt", "CaseClauses", "CaseClause", "DefaultClause",
+  "LabelledStatement", "ThrowStatement", "TryStatement",
+  "DebuggerStatement", "Catch", "Finally", "FunctionDeclaration",
+  "FunctionDeclarationInternal", "FunctionExpr", "FormalParameterList",
+  "FunctionBody", "Program", "SourceElements", "SourceElement", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,    47,    40,    41,   123,   125,    44,    91,
-      93,    58,    46,    43,    45,   126,    33,    42,    37,    60,
-      62,    38,    94,   124,    63,    61,    59
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint8 yyr1[] =
-{
-       0,    87,    88,    88,    88,    88,    88,    88,    88,    89,
-      89,    89,    89,    89,    89,    89,    89,    90,    90,    90,
-      91,    91,    92,    92,    93,    93,    94,    94,    95,    95,
-      95,    96,    96,    96,    96,    96,    97,    97,    98,    98,
-      98,    98,    99,    99,   100,   100,   101,   101,   102,   102,
-     102,   103,   103,   103,   103,   103,   103,   103,   103,   103,
-     103,   103,   103,   104,   104,   104,   104,   105,   105,   105,
-     106,   106,   106,   106,   107,   107,   107,   107,   107,   107,
-     107,   108,   108,   108,   108,   108,   109,   109,   110,   110,
-     111,   111,   112,   112,   113,   113,   114,   114,   115,   115,
-     116,   116,   116,   116,   116,   116,   116,   116,   116,   116,
-     116,   116,   117,   117,   118,   118,   118,   118,   118,   118,
-     118,   118,   118,   118,   118,   118,   118,   118,   118,   118,
-     119,   119,   120,   120,   121,   121,   122,   122,   123,   123,
-     124,   124,   125,   125,   126,   126,   127,   128,   129,   129,
-     130,   130,   131,   131,   131,   131,   131,   131,   131,   132,
-     132,   133,   133,   133,   133,   134,   134,   134,   134,   135,
-     135,   135,   135,   136,   137,   138,   138,   139,   139,   140,
-     140,   141,   141,   142,   142,   143,   144,   144,   145,   145,
-     145,   146,   146,   147,   148,   149,   149,   150,   150,   151,
-     151,   152,   152,   153,   153,   154,   154,   155,   155,   156,
-     156
-};
+#define YYPACT_NINF (-271)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
-{
-       0,     2,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     3,     2,     3,     4,     3,     3,     5,
-       2,     4,     0,     1,     1,     2,     3,     5,     1,     1,
-       1,     1,     1,     4,     3,     3,     1,     2,     2,     2,
-       4,     3,     2,     3,     1,     3,     1,     1,     1,     2,
-       2,     1,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     1,     3,     3,     3,     1,     3,     3,
-       1,     3,     3,     3,     1,     3,     3,     3,     3,     3,
-       3,     1,     3,     3,     3,     3,     1,     3,     1,     3,
-       1,     3,     1,     3,     1,     3,     1,     5,     1,     3,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       2,     3,     1,     2,     3,     3,     1,     3,     1,     2,
-       3,     3,     1,     3,     1,     2,     2,     1,     2,     2,
-       5,     7,     6,     5,     9,    10,     7,     8,     9,     0,
-       1,     2,     2,     3,     3,     2,     2,     3,     3,     2,
-       2,     3,     3,     5,     5,     3,     5,     0,     1,     1,
-       2,     3,     4,     2,     3,     3,     3,     3,     3,     3,
-       4,     2,     2,     5,     2,     1,     2,     5,     6,     4,
-       5,     1,     3,     2,     3,     0,     1,     1,     2,     1,
-       1
-};
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-/* YYDEFACT[STATE-NAME] -- Default rule to reduce with in state
-   STATE-NUM when YYTABLE doesn't specify something else to do.  Zero
-   means the default is an error.  */
-static const yytype_uint8 yydefact[] =
-{
-     205,     2,     3,     4,     6,     5,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     9,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     8,    10,
-       0,     0,     7,     0,     0,    22,     0,     0,     0,     0,
-     147,    11,    31,    12,    36,    46,    47,    48,    51,    63,
-      67,    70,    74,    81,    86,    88,    90,    92,    94,    96,
-      98,   112,     0,   209,   114,   115,   116,   117,   118,   119,
-     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
-     210,   195,    32,     0,   206,   207,   166,     0,   165,   159,
-       0,    10,     0,    36,    37,   138,     0,   136,   144,     0,
-     142,   162,     0,   161,     0,     0,   170,     0,   169,     0,
-      48,    53,   196,    52,     0,     0,     0,    54,     0,     0,
-       0,     0,     0,   192,   191,    55,    57,     0,    56,    58,
-       0,     6,     5,    10,    14,     0,     0,     0,    24,     0,
-       0,    23,    59,    60,    61,    62,     0,     0,     0,    38,
-       0,     0,    39,    49,    50,   101,   102,   103,   104,   105,
-     106,   107,   108,   111,   109,   110,   100,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   149,     0,   148,     1,   208,   168,   167,     0,
-      48,   160,     0,    29,    30,    28,    14,    35,     0,   139,
-     135,     0,   134,   145,   141,     0,   140,   164,   163,     0,
-     201,     0,     0,   172,   171,     0,     0,     0,     0,     0,
-     187,   186,   130,     0,     0,   188,   189,   185,    13,    15,
-       0,     0,   131,    22,    18,    17,    20,    25,    42,     0,
-      44,     0,    34,     0,    41,    99,    65,    64,    66,    68,
-      69,    71,    72,    73,    80,    79,    77,    78,    75,    76,
-      82,    83,    84,    85,    87,    89,    91,    93,    95,     0,
-     113,   138,     0,     0,   159,   146,   137,   143,     0,     0,
-       0,   199,     0,     0,     0,     0,     0,     0,     0,     0,
-     194,   190,    16,     0,    26,     0,    43,     0,    33,    40,
-       0,     0,   139,   159,     0,     0,   197,     0,   203,     0,
-     200,   202,   150,     0,   153,   177,   174,   173,     0,     0,
-      19,    21,    45,    97,     0,     0,     0,     0,   159,   198,
-     204,     0,   152,     0,     0,   178,   179,     0,    27,     0,
-       0,   159,   156,     0,   151,     0,     0,   175,   177,   180,
-     193,   157,     0,     0,     0,   181,   183,     0,   158,     0,
-     154,   132,   182,   184,   176,   155,   133
-};
+#define YYTABLE_NINF (-131)
 
-/* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int16 yydefgoto[] =
-{
-      -1,    41,    42,    43,   139,   140,   141,   135,   136,    44,
-      45,    46,   149,   249,    47,    48,    49,    50,    51,    52,
-      53,    54,    55,    56,    57,    58,    59,    60,    61,   167,
-      62,    63,    64,   372,    65,    96,    97,    66,    99,   100,
-     209,    67,    68,    69,    70,   202,    71,    72,    73,    74,
-      75,   326,   344,   345,   346,   358,    76,    77,    78,    79,
-     235,   236,    80,    81,    82,   222,   291,    83,   137,    85
-};
+#define yytable_value_is_error(Yyn) \
+  0
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -271
 static const yytype_int16 yypact[] =
 {
      756,  -271,  -271,  -271,  -271,  -271,     6,    21,   180,   -19,
@@ -944,6 +832,51 @@ static const yytype_int16 yypact[] =
     -271,  -271,   832,   832,  -271,  -271,  -271
 };
 
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_uint8 yydefact[] =
+{
+     205,     2,     3,     4,     6,     5,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     9,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     8,    10,
+       0,     0,     7,     0,     0,    22,     0,     0,     0,     0,
+     147,    11,    31,    12,    36,    46,    47,    48,    51,    63,
+      67,    70,    74,    81,    86,    88,    90,    92,    94,    96,
+      98,   112,     0,   209,   114,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     210,   195,    32,     0,   206,   207,   166,     0,   165,   159,
+       0,    10,     0,    36,    37,   138,     0,   136,   144,     0,
+     142,   162,     0,   161,     0,     0,   170,     0,   169,     0,
+      48,    53,   196,    52,     0,     0,     0,    54,     0,     0,
+       0,     0,     0,   192,   191,    55,    57,     0,    56,    58,
+       0,     6,     5,    10,    14,     0,     0,     0,    24,     0,
+       0,    23,    59,    60,    61,    62,     0,     0,     0,    38,
+       0,     0,    39,    49,    50,   101,   102,   103,   104,   105,
+     106,   107,   108,   111,   109,   110,   100,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   149,     0,   148,     1,   208,   168,   167,     0,
+      48,   160,     0,    29,    30,    28,    14,    35,     0,   139,
+     135,     0,   134,   145,   141,     0,   140,   164,   163,     0,
+     201,     0,     0,   172,   171,     0,     0,     0,     0,     0,
+     187,   186,   130,     0,     0,   188,   189,   185,    13,    15,
+       0,     0,   131,    22,    18,    17,    20,    25,    42,     0,
+      44,     0,    34,     0,    41,    99,    65,    64,    66,    68,
+      69,    71,    72,    73,    80,    79,    77,    78,    75,    76,
+      82,    83,    84,    85,    87,    89,    91,    93,    95,     0,
+     113,   138,     0,     0,   159,   146,   137,   143,     0,     0,
+       0,   199,     0,     0,     0,     0,     0,     0,     0,     0,
+     194,   190,    16,     0,    26,     0,    43,     0,    33,    40,
+       0,     0,   139,   159,     0,     0,   197,     0,   203,     0,
+     200,   202,   150,     0,   153,   177,   174,   173,     0,     0,
+      19,    21,    45,    97,     0,     0,     0,     0,   159,   198,
+     204,     0,   152,     0,     0,   178,   179,     0,    27,     0,
+       0,   159,   156,     0,   151,     0,     0,   175,   177,   180,
+     193,   157,     0,     0,     0,   181,   183,     0,   158,     0,
+     154,   132,   182,   184,   176,   155,   133
+};
+
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
@@ -956,11 +889,21 @@ static const yytype_int16 yypgoto[] =
     -271,   114,  -271,   329,  -271,   131,  -267,  -271,     1,   -80
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
-   number is the opposite.  If zero, do what YYDEFACT says.
-   If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -131
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,    41,    42,    43,   139,   140,   141,   135,   136,    44,
+      45,    46,   149,   249,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,   167,
+      62,    63,    64,   372,    65,    96,    97,    66,    99,   100,
+     209,    67,    68,    69,    70,   202,    71,    72,    73,    74,
+      75,   326,   344,   345,   346,   358,    76,    77,    78,    79,
+     235,   236,    80,    81,    82,   222,   291,    83,   137,    85
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
      115,    84,   109,   122,   196,   246,   213,    86,   101,   192,
@@ -1249,8 +1192,8 @@ static const yytype_int16 yycheck[] =
       -1,    69,    -1,    -1,    -1,    73,    74,    75,    76
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_uint8 yystos[] =
 {
        0,     3,     4,     5,     6,     7,     8,    11,    12,    13,
@@ -1293,95 +1236,121 @@ static const yytype_uint8 yystos[] =
      118,   118,   120,   120,    67,   118,   118
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,    87,    88,    88,    88,    88,    88,    88,    88,    89,
+      89,    89,    89,    89,    89,    89,    89,    90,    90,    90,
+      91,    91,    92,    92,    93,    93,    94,    94,    95,    95,
+      95,    96,    96,    96,    96,    96,    97,    97,    98,    98,
+      98,    98,    99,    99,   100,   100,   101,   101,   102,   102,
+     102,   103,   103,   103,   103,   103,   103,   103,   103,   103,
+     103,   103,   103,   104,   104,   104,   104,   105,   105,   105,
+     106,   106,   106,   106,   107,   107,   107,   107,   107,   107,
+     107,   108,   108,   108,   108,   108,   109,   109,   110,   110,
+     111,   111,   112,   112,   113,   113,   114,   114,   115,   115,
+     116,   116,   116,   116,   116,   116,   116,   116,   116,   116,
+     116,   116,   117,   117,   118,   118,   118,   118,   118,   118,
+     118,   118,   118,   118,   118,   118,   118,   118,   118,   118,
+     119,   119,   120,   120,   121,   121,   122,   122,   123,   123,
+     124,   124,   125,   125,   126,   126,   127,   128,   129,   129,
+     130,   130,   131,   131,   131,   131,   131,   131,   131,   132,
+     132,   133,   133,   133,   133,   134,   134,   134,   134,   135,
+     135,   135,   135,   136,   137,   138,   138,   139,   139,   140,
+     140,   141,   141,   142,   142,   143,   144,   144,   145,   145,
+     145,   146,   146,   147,   148,   149,   149,   150,   150,   151,
+     151,   152,   152,   153,   153,   154,   154,   155,   155,   156,
+     156
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     3,     2,     3,     4,     3,     3,     5,
+       2,     4,     0,     1,     1,     2,     3,     5,     1,     1,
+       1,     1,     1,     4,     3,     3,     1,     2,     2,     2,
+       4,     3,     2,     3,     1,     3,     1,     1,     1,     2,
+       2,     1,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     1,     3,     3,     3,     1,     3,     3,
+       1,     3,     3,     3,     1,     3,     3,     3,     3,     3,
+       3,     1,     3,     3,     3,     3,     1,     3,     1,     3,
+       1,     3,     1,     3,     1,     3,     1,     5,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     3,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       2,     3,     1,     2,     3,     3,     1,     3,     1,     2,
+       3,     3,     1,     3,     1,     2,     2,     1,     2,     2,
+       5,     7,     6,     5,     9,    10,     7,     8,     9,     0,
+       1,     2,     2,     3,     3,     2,     2,     3,     3,     2,
+       2,     3,     3,     5,     5,     3,     5,     0,     1,     1,
+       2,     3,     4,     2,     3,     3,     3,     3,     3,     3,
+       4,     2,     2,     5,     2,     1,     2,     5,     6,     4,
+       5,     1,     3,     2,     3,     0,     1,     1,     2,     1,
+       1
+};
+
 
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
+enum { YYENOMEM = -2 };
 
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
 
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  */
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
-#define YYFAIL		goto yyerrlab
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      yytoken = YYTRANSLATE (yychar);				\
-      YYPOPSTACK (1);						\
-      goto yybackup;						\
-    }								\
-  else								\
-    {								\
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (&yylloc, parser, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
    the previous symbol: RHS[0] (always defined).  */
 
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
 #ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)				\
-    do									\
-      if (YYID (N))                                                    \
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	}								\
-    while (YYID (0))
-#endif
-
-
-/* YY_LOCATION_PRINT -- Print the location on the stream.
-   This macro was not mandated originally: define only if we know
-   we won't break user code: when these are the locations we know.  */
-
-#ifndef YY_LOCATION_PRINT
-# if YYLTYPE_IS_TRIVIAL
-#  define YY_LOCATION_PRINT(File, Loc)			\
-     fprintf (File, "%d.%d-%d.%d",			\
-	      (Loc).first_line, (Loc).first_column,	\
-	      (Loc).last_line,  (Loc).last_column)
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
+# define YYLLOC_DEFAULT(Current, Rhs, N)                                \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
+          (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
+          (Current).last_line    = YYRHSLOC (Rhs, N).last_line;         \
+          (Current).last_column  = YYRHSLOC (Rhs, N).last_column;       \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).first_line   = (Current).last_line   =              \
+            YYRHSLOC (Rhs, 0).last_line;                                \
+          (Current).first_column = (Current).last_column =              \
+            YYRHSLOC (Rhs, 0).last_column;                              \
+        }                                                               \
+    while (0)
 #endif
 
+#define YYRHSLOC(Rhs, K) ((Rhs)[K])
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
-
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (YYLEX_PARAM)
-#else
-# define YYLEX yylex ()
-#endif
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -1391,85 +1360,119 @@ while (YYID (0))
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value, Location); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, const YYSTYPE * const yyvaluep, const YYLTYPE * const yylocationp)
-#else
-static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep, yylocationp)
-    FILE *yyoutput;
-    int yytype;
-    const YYSTYPE * const yyvaluep;
-    const YYLTYPE * const yylocationp;
-#endif
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+/* YYLOCATION_PRINT -- Print the location on the stream.
+   This macro was not mandated originally: define only if we know
+   we won't break user code: when these are the locations we know.  */
+
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+
+/* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
+
+YY_ATTRIBUTE_UNUSED
+static int
+yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
 {
-  if (!yyvaluep)
-    return;
-  YYUSE (yylocationp);
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
+  int res = 0;
+  int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
+  if (0 <= yylocp->first_line)
+    {
+      res += YYFPRINTF (yyo, "%d", yylocp->first_line);
+      if (0 <= yylocp->first_column)
+        res += YYFPRINTF (yyo, ".%d", yylocp->first_column);
+    }
+  if (0 <= yylocp->last_line)
     {
-      default:
-	break;
+      if (yylocp->first_line < yylocp->last_line)
+        {
+          res += YYFPRINTF (yyo, "-%d", yylocp->last_line);
+          if (0 <= end_col)
+            res += YYFPRINTF (yyo, ".%d", end_col);
+        }
+      else if (0 <= end_col && yylocp->first_column < end_col)
+        res += YYFPRINTF (yyo, "-%d", end_col);
     }
+  return res;
 }
 
+#   define YYLOCATION_PRINT  yy_location_print_
+
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, Location, parser); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, const YYSTYPE * const yyvaluep, const YYLTYPE * const yylocationp)
-#else
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, KJS::Parser *parser)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  YY_USE (parser);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
 static void
-yy_symbol_print (yyoutput, yytype, yyvaluep, yylocationp)
-    FILE *yyoutput;
-    int yytype;
-    const YYSTYPE * const yyvaluep;
-    const YYLTYPE * const yylocationp;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp, KJS::Parser *parser)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  YY_LOCATION_PRINT (yyoutput, *yylocationp);
-  YYFPRINTF (yyoutput, ": ");
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep, yylocationp);
-  YYFPRINTF (yyoutput, ")");
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp, parser);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1477,82 +1480,69 @@ yy_symbol_print (yyoutput, yytype, yyvaluep, yylocationp)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_stack_print (yytype_int16 *bottom, yytype_int16 *top)
-#else
 static void
-yy_stack_print (bottom, top)
-    yytype_int16 *bottom;
-    yytype_int16 *top;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
-  for (; bottom <= top; ++bottom)
-    YYFPRINTF (stderr, " %d", *bottom);
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_reduce_print (YYSTYPE *yyvsp, YYLTYPE *yylsp, int yyrule)
-#else
 static void
-yy_reduce_print (yyvsp, yylsp, yyrule
-		   )
-    YYSTYPE *yyvsp;
-    YYLTYPE *yylsp;
-    int yyrule;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule, KJS::Parser *parser)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
-      fprintf (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       , &(yylsp[(yyi + 1) - (yynrhs)])		       );
-      fprintf (stderr, "\n");
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]), parser);
+      YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, yylsp, Rule); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule, parser); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -1567,281 +1557,33 @@ int yydebug;
 # define YYMAXDEPTH 10000
 #endif
 
-
-
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
-    do_not_strip_quotes: ;
-    }
 
-  if (! yyres)
-    return yystrlen (yystr);
 
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
 
-/* Copy into YYRESULT an error message about the unexpected token
-   YYCHAR while in state YYSTATE.  Return the number of bytes copied,
-   including the terminating null byte.  If YYRESULT is null, do not
-   copy anything; just return the number of bytes that would be
-   copied.  As a special case, return 0 if an ordinary "syntax error"
-   message will do.  Return YYSIZE_MAXIMUM if overflow occurs during
-   size calculation.  */
-static YYSIZE_T
-yysyntax_error (char *yyresult, int yystate, int yychar)
-{
-  int yyn = yypact[yystate];
 
-  if (! (YYPACT_NINF < yyn && yyn <= YYLAST))
-    return 0;
-  else
-    {
-      int yytype = YYTRANSLATE (yychar);
-      YYSIZE_T yysize0 = yytnamerr (0, yytname[yytype]);
-      YYSIZE_T yysize = yysize0;
-      YYSIZE_T yysize1;
-      int yysize_overflow = 0;
-      enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-      char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-      int yyx;
-
-# if 0
-      /* This is so xgettext sees the translatable formats that are
-	 constructed on the fly.  */
-      YY_("syntax error, unexpected %s");
-      YY_("syntax error, unexpected %s, expecting %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s");
-# endif
-      char *yyfmt;
-      char const *yyf;
-      static char const yyunexpected[] = "syntax error, unexpected %s";
-      static char const yyexpecting[] = ", expecting %s";
-      static char const yyor[] = " or %s";
-      char yyformat[sizeof yyunexpected
-		    + sizeof yyexpecting - 1
-		    + ((YYERROR_VERBOSE_ARGS_MAXIMUM - 2)
-		       * (sizeof yyor - 1))];
-      char const *yyprefix = yyexpecting;
-
-      /* Start YYX at -YYN if negative to avoid negative indexes in
-	 YYCHECK.  */
-      int yyxbegin = yyn < 0 ? -yyn : 0;
-
-      /* Stay within bounds of both yycheck and yytname.  */
-      int yychecklim = YYLAST - yyn + 1;
-      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-      int yycount = 1;
-
-      yyarg[0] = yytname[yytype];
-      yyfmt = yystpcpy (yyformat, yyunexpected);
-
-      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-	if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR)
-	  {
-	    if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-	      {
-		yycount = 1;
-		yysize = yysize0;
-		yyformat[sizeof yyunexpected - 1] = '\0';
-		break;
-	      }
-	    yyarg[yycount++] = yytname[yyx];
-	    yysize1 = yysize + yytnamerr (0, yytname[yyx]);
-	    yysize_overflow |= (yysize1 < yysize);
-	    yysize = yysize1;
-	    yyfmt = yystpcpy (yyfmt, yyprefix);
-	    yyprefix = yyor;
-	  }
-
-      yyf = YY_(yyformat);
-      yysize1 = yysize + yystrlen (yyf);
-      yysize_overflow |= (yysize1 < yysize);
-      yysize = yysize1;
-
-      if (yysize_overflow)
-	return YYSIZE_MAXIMUM;
-
-      if (yyresult)
-	{
-	  /* Avoid sprintf, as that infringes on the user's name space.
-	     Don't have undefined behavior even if the translation
-	     produced a string with the wrong number of "%s"s.  */
-	  char *yyp = yyresult;
-	  int yyi = 0;
-	  while ((*yyp = *yyf) != '\0')
-	    {
-	      if (*yyp == '%' && yyf[1] == 's' && yyi < yycount)
-		{
-		  yyp += yytnamerr (yyp, yyarg[yyi++]);
-		  yyf += 2;
-		}
-	      else
-		{
-		  yyp++;
-		  yyf++;
-		}
-	    }
-	}
-      return yysize;
-    }
-}
-#endif /* YYERROR_VERBOSE */
-
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
-#else
-static void
-yydestruct (yymsg, yytype, yyvaluep, yylocationp)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-    YYLTYPE *yylocationp;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp, KJS::Parser *parser)
 {
-  YYUSE (yyvaluep);
-  YYUSE (yylocationp);
-
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  YY_USE (parser);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-  switch (yytype)
-    {
-
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
-
-
-/* Prevent warnings from -Wmissing-prototypes.  */
-
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
-
 
 
-/* The look-ahead symbol.  */
-int yychar;
-
-/* The semantic value of the look-ahead symbol.  */
-YYSTYPE yylval;
 
-/* Number of syntax errors so far.  */
-int yynerrs;
-/* Location data for the look-ahead symbol.  */
-YYLTYPE yylloc;
 
 
 
@@ -1849,211 +1591,217 @@ YYLTYPE yylloc;
 | yyparse.  |
 `----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 int
-yyparse (void)
-#else
-int
-yyparse ()
-
-#endif
-#endif
+yyparse (KJS::Parser *parser)
 {
-  
-  int yystate;
-  int yyn;
-  int yyresult;
-  /* Number of tokens to shift before error messages enabled.  */
-  int yyerrstatus;
-  /* Look-ahead token as an internal (translated) token number.  */
-  int yytoken = 0;
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+/* Lookahead token kind.  */
+int yychar;
 
-  /* Three stacks and their tools:
-     `yyss': related to states,
-     `yyvs': related to semantic values,
-     `yyls': related to locations.
 
-     Refer to the stacks thru separate pointers, to allow yyoverflow
-     to reallocate them elsewhere.  */
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
 
-  /* The state stack.  */
-  yytype_int16 yyssa[YYINITDEPTH];
-  yytype_int16 *yyss = yyssa;
-  yytype_int16 *yyssp;
+/* Location data for the lookahead symbol.  */
+static YYLTYPE yyloc_default
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+YYLTYPE yylloc = yyloc_default;
 
-  /* The semantic value stack.  */
-  YYSTYPE yyvsa[YYINITDEPTH];
-  YYSTYPE *yyvs = yyvsa;
-  YYSTYPE *yyvsp;
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
 
-  /* The location stack.  */
-  YYLTYPE yylsa[YYINITDEPTH];
-  YYLTYPE *yyls = yylsa;
-  YYLTYPE *yylsp;
-  /* The locations where the error started and ended.  */
-  YYLTYPE yyerror_range[2];
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
 
-#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
 
-  YYSIZE_T yystacksize = YYINITDEPTH;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+    /* The location stack: array, bottom, top.  */
+    YYLTYPE yylsa[YYINITDEPTH];
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
   YYLTYPE yyloc;
 
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
+
   /* The number of symbols on the RHS of the reduced rule.
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY;		/* Cause a token to be read.  */
-
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
-
-  yyssp = yyss;
-  yyvsp = yyvs;
-  yylsp = yyls;
-#if YYLTYPE_IS_TRIVIAL
-  /* Initialize the default location before parsing starts.  */
-  yylloc.first_line   = yylloc.last_line   = 1;
-  yylloc.first_column = yylloc.last_column = 0;
-#endif
+  yychar = YYEMPTY; /* Cause a token to be read.  */
 
+  yylsp[0] = yylloc;
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-	YYLTYPE *yyls1 = yyls;
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-		    &yyls1, yysize * sizeof (*yylsp),
-		    &yystacksize);
-	yyls = yyls1;
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+        YYLTYPE *yyls1 = yyls;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+        yyls = yyls1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss);
-	YYSTACK_RELOCATE (yyvs);
-	YYSTACK_RELOCATE (yyls);
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        YYSTACK_RELOCATE (yyls_alloc, yyls);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
       yylsp = yyls + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
-     look-ahead token if we need one and don't already have one.  */
+     lookahead token if we need one and don't already have one.  */
 
-  /* First try to decide what to do without reference to look-ahead token.  */
+  /* First try to decide what to do without reference to lookahead token.  */
   yyn = yypact[yystate];
-  if (yyn == YYPACT_NINF)
+  if (yypact_value_is_default (yyn))
     goto yydefault;
 
-  /* Not known => get a look-ahead token if don't already have one.  */
+  /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid look-ahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, &yylloc, parser);
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2068,30 +1816,27 @@ yybackup:
   yyn = yytable[yyn];
   if (yyn <= 0)
     {
-      if (yyn == 0 || yyn == YYTABLE_NINF)
-	goto yyerrlab;
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
       yyn = -yyn;
       goto yyreduce;
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
   /* Count tokens shifted since error; after three, turn off error
      status.  */
   if (yyerrstatus)
     yyerrstatus--;
 
-  /* Shift the look-ahead token.  */
+  /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token unless it is eof.  */
-  if (yychar != YYEOF)
-    yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
   *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -2106,14 +1851,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -2122,1006 +1867,1151 @@ yyreduce:
      GCC warning that YYVAL may be used uninitialized.  */
   yyval = yyvsp[1-yylen];
 
-  /* Default location.  */
+  /* Default location. */
   YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-#line 169 "grammar.y"
-    { (yyval.node) = new NullNode(); ;}
-    break;
-
-  case 3:
-#line 170 "grammar.y"
-    { (yyval.node) = new BooleanNode(true); ;}
+  case 2: /* Literal: NULLTOKEN  */
+#line 173 "grammar.y"
+                                   { (yyval.node) = new NullNode(); }
+#line 1880 "grammar.cpp"
     break;
 
-  case 4:
-#line 171 "grammar.y"
-    { (yyval.node) = new BooleanNode(false); ;}
+  case 3: /* Literal: TRUETOKEN  */
+#line 174 "grammar.y"
+                                   { (yyval.node) = new BooleanNode(true); }
+#line 1886 "grammar.cpp"
     break;
 
-  case 5:
-#line 172 "grammar.y"
-    { (yyval.node) = new NumberNode((yyvsp[(1) - (1)].dval)); ;}
+  case 4: /* Literal: FALSETOKEN  */
+#line 175 "grammar.y"
+                                   { (yyval.node) = new BooleanNode(false); }
+#line 1892 "grammar.cpp"
     break;
 
-  case 6:
-#line 173 "grammar.y"
-    { (yyval.node) = new StringNode((yyvsp[(1) - (1)].ustr)); ;}
+  case 5: /* Literal: NUMBER  */
+#line 176 "grammar.y"
+                                   { (yyval.node) = new NumberNode((yyvsp[0].dval)); }
+#line 1898 "grammar.cpp"
     break;
 
-  case 7:
-#line 174 "grammar.y"
-    { Lexer *l = Lexer::curr();
-                                     if (!l->scanRegExp()) YYABORT;
-                                     (yyval.node) = new RegExpNode(l->pattern,l->flags);;}
+  case 6: /* Literal: STRING  */
+#line 177 "grammar.y"
+                                   { (yyval.node) = new StringNode((yyvsp[0].text).ustring()); }
+#line 1904 "grammar.cpp"
     break;
 
-  case 8:
+  case 7: /* Literal: '/'  */
 #line 178 "grammar.y"
-    { Lexer *l = Lexer::curr();
+                                   { Lexer *l = parser->lexer;
                                      if (!l->scanRegExp()) YYABORT;
-                                     (yyval.node) = new RegExpNode(UString('=')+l->pattern,l->flags);;}
-    break;
-
-  case 9:
-#line 184 "grammar.y"
-    { (yyval.node) = new ThisNode(); ;}
+                                     (yyval.node) = new RegExpNode(l->pattern,l->flags);}
+#line 1912 "grammar.cpp"
     break;
 
-  case 10:
-#line 185 "grammar.y"
-    { (yyval.node) = new ResolveNode(*(yyvsp[(1) - (1)].ident)); ;}
+  case 8: /* Literal: DIVEQUAL  */
+#line 182 "grammar.y"
+                                   { Lexer *l = parser->lexer;
+                                     if (!l->scanRegExp()) YYABORT;
+                                     (yyval.node) = new RegExpNode(UString('=')+l->pattern,l->flags);}
+#line 1920 "grammar.cpp"
     break;
 
-  case 13:
+  case 9: /* PrimaryExpr: THIS  */
 #line 188 "grammar.y"
-    { (yyval.node) = new GroupNode((yyvsp[(2) - (3)].node)); ;}
+                                   { (yyval.node) = new ThisNode(); }
+#line 1926 "grammar.cpp"
     break;
 
-  case 14:
+  case 10: /* PrimaryExpr: IDENT  */
 #line 189 "grammar.y"
-    { (yyval.node) = new ObjectLiteralNode(); ;}
+                                   { (yyval.node) = new ResolveNode((yyvsp[0].text).ident()); }
+#line 1932 "grammar.cpp"
     break;
 
-  case 15:
-#line 190 "grammar.y"
-    { (yyval.node) = new ObjectLiteralNode((yyvsp[(2) - (3)].plist)); ;}
+  case 13: /* PrimaryExpr: '(' Expr ')'  */
+#line 192 "grammar.y"
+                                   { (yyval.node) = new GroupNode((yyvsp[-1].node)); }
+#line 1938 "grammar.cpp"
     break;
 
-  case 16:
-#line 191 "grammar.y"
-    { (yyval.node) = new ObjectLiteralNode((yyvsp[(2) - (4)].plist)); ;}
+  case 14: /* PrimaryExpr: '{' '}'  */
+#line 193 "grammar.y"
+                                   { (yyval.node) = new ObjectLiteralNode(); }
+#line 1944 "grammar.cpp"
     break;
 
-  case 17:
+  case 15: /* PrimaryExpr: '{' PropertyNameAndValueList '}'  */
+#line 194 "grammar.y"
+                                       { (yyval.node) = new ObjectLiteralNode((yyvsp[-1].plist)); }
+#line 1950 "grammar.cpp"
+    break;
+
+  case 16: /* PrimaryExpr: '{' PropertyNameAndValueList ',' '}'  */
 #line 195 "grammar.y"
-    { (yyval.node) = new ArrayNode((yyvsp[(2) - (3)].ival)); ;}
+                                           { (yyval.node) = new ObjectLiteralNode((yyvsp[-2].plist)); }
+#line 1956 "grammar.cpp"
     break;
 
-  case 18:
-#line 196 "grammar.y"
-    { (yyval.node) = new ArrayNode((yyvsp[(2) - (3)].elm)); ;}
+  case 17: /* ArrayLiteral: '[' ElisionOpt ']'  */
+#line 199 "grammar.y"
+                                       { (yyval.node) = new ArrayNode((yyvsp[-1].ival)); }
+#line 1962 "grammar.cpp"
     break;
 
-  case 19:
-#line 197 "grammar.y"
-    { (yyval.node) = new ArrayNode((yyvsp[(4) - (5)].ival), (yyvsp[(2) - (5)].elm)); ;}
+  case 18: /* ArrayLiteral: '[' ElementList ']'  */
+#line 200 "grammar.y"
+                                       { (yyval.node) = new ArrayNode((yyvsp[-1].elm)); }
+#line 1968 "grammar.cpp"
     break;
 
-  case 20:
+  case 19: /* ArrayLiteral: '[' ElementList ',' ElisionOpt ']'  */
 #line 201 "grammar.y"
-    { (yyval.elm) = new ElementNode((yyvsp[(1) - (2)].ival), (yyvsp[(2) - (2)].node)); ;}
+                                       { (yyval.node) = new ArrayNode((yyvsp[-1].ival), (yyvsp[-3].elm)); }
+#line 1974 "grammar.cpp"
     break;
 
-  case 21:
-#line 203 "grammar.y"
-    { (yyval.elm) = new ElementNode((yyvsp[(1) - (4)].elm), (yyvsp[(3) - (4)].ival), (yyvsp[(4) - (4)].node)); ;}
+  case 20: /* ElementList: ElisionOpt AssignmentExpr  */
+#line 205 "grammar.y"
+                                   { (yyval.elm) = new ElementNode((yyvsp[-1].ival), (yyvsp[0].node)); }
+#line 1980 "grammar.cpp"
     break;
 
-  case 22:
+  case 21: /* ElementList: ElementList ',' ElisionOpt AssignmentExpr  */
 #line 207 "grammar.y"
-    { (yyval.ival) = 0; ;}
+                                   { (yyval.elm) = new ElementNode((yyvsp[-3].elm), (yyvsp[-1].ival), (yyvsp[0].node)); }
+#line 1986 "grammar.cpp"
     break;
 
-  case 24:
-#line 212 "grammar.y"
-    { (yyval.ival) = 1; ;}
+  case 22: /* ElisionOpt: %empty  */
+#line 211 "grammar.y"
+                                   { (yyval.ival) = 0; }
+#line 1992 "grammar.cpp"
     break;
 
-  case 25:
-#line 213 "grammar.y"
-    { (yyval.ival) = (yyvsp[(1) - (2)].ival) + 1; ;}
+  case 24: /* Elision: ','  */
+#line 216 "grammar.y"
+                                   { (yyval.ival) = 1; }
+#line 1998 "grammar.cpp"
     break;
 
-  case 26:
+  case 25: /* Elision: Elision ','  */
 #line 217 "grammar.y"
-    { (yyval.plist) = new PropertyValueNode((yyvsp[(1) - (3)].pnode), (yyvsp[(3) - (3)].node)); ;}
+                                   { (yyval.ival) = (yyvsp[-1].ival) + 1; }
+#line 2004 "grammar.cpp"
     break;
 
-  case 27:
-#line 219 "grammar.y"
-    { (yyval.plist) = new PropertyValueNode((yyvsp[(3) - (5)].pnode), (yyvsp[(5) - (5)].node), (yyvsp[(1) - (5)].plist)); ;}
+  case 26: /* PropertyNameAndValueList: PropertyName ':' AssignmentExpr  */
+#line 221 "grammar.y"
+                                        { (yyval.plist) = new PropertyValueNode((yyvsp[-2].pnode), (yyvsp[0].node)); }
+#line 2010 "grammar.cpp"
     break;
 
-  case 28:
+  case 27: /* PropertyNameAndValueList: PropertyNameAndValueList ',' PropertyName ':' AssignmentExpr  */
 #line 223 "grammar.y"
-    { (yyval.pnode) = new PropertyNode(*(yyvsp[(1) - (1)].ident)); ;}
+                                   { (yyval.plist) = new PropertyValueNode((yyvsp[-2].pnode), (yyvsp[0].node), (yyvsp[-4].plist)); }
+#line 2016 "grammar.cpp"
     break;
 
-  case 29:
-#line 224 "grammar.y"
-    { (yyval.pnode) = new PropertyNode(Identifier(*(yyvsp[(1) - (1)].ustr))); ;}
+  case 28: /* PropertyName: IDENT  */
+#line 227 "grammar.y"
+                                   { (yyval.pnode) = new PropertyNode((yyvsp[0].text).ident()); }
+#line 2022 "grammar.cpp"
     break;
 
-  case 30:
-#line 225 "grammar.y"
-    { (yyval.pnode) = new PropertyNode((yyvsp[(1) - (1)].dval)); ;}
+  case 29: /* PropertyName: STRING  */
+#line 228 "grammar.y"
+                                   { (yyval.pnode) = new PropertyNode((yyvsp[0].text).ident()); }
+#line 2028 "grammar.cpp"
     break;
 
-  case 33:
-#line 231 "grammar.y"
-    { (yyval.node) = new AccessorNode1((yyvsp[(1) - (4)].node), (yyvsp[(3) - (4)].node)); ;}
+  case 30: /* PropertyName: NUMBER  */
+#line 229 "grammar.y"
+                                   { (yyval.pnode) = new PropertyNode((yyvsp[0].dval)); }
+#line 2034 "grammar.cpp"
     break;
 
-  case 34:
-#line 232 "grammar.y"
-    { (yyval.node) = new AccessorNode2((yyvsp[(1) - (3)].node), *(yyvsp[(3) - (3)].ident)); ;}
+  case 33: /* MemberExpr: MemberExpr '[' Expr ']'  */
+#line 235 "grammar.y"
+                                   { (yyval.node) = new AccessorNode1((yyvsp[-3].node), (yyvsp[-1].node)); }
+#line 2040 "grammar.cpp"
     break;
 
-  case 35:
-#line 233 "grammar.y"
-    { (yyval.node) = new NewExprNode((yyvsp[(2) - (3)].node), (yyvsp[(3) - (3)].args)); ;}
+  case 34: /* MemberExpr: MemberExpr '.' IDENT  */
+#line 236 "grammar.y"
+                                   { (yyval.node) = new AccessorNode2((yyvsp[-2].node), (yyvsp[0].text).ident()); }
+#line 2046 "grammar.cpp"
     break;
 
-  case 37:
-#line 238 "grammar.y"
-    { (yyval.node) = new NewExprNode((yyvsp[(2) - (2)].node)); ;}
+  case 35: /* MemberExpr: NEW MemberExpr Arguments  */
+#line 237 "grammar.y"
+                                   { (yyval.node) = new NewExprNode((yyvsp[-1].node), (yyvsp[0].args)); }
+#line 2052 "grammar.cpp"
     break;
 
-  case 38:
+  case 37: /* NewExpr: NEW NewExpr  */
 #line 242 "grammar.y"
-    { (yyval.node) = new FunctionCallNode((yyvsp[(1) - (2)].node), (yyvsp[(2) - (2)].args)); ;}
+                                   { (yyval.node) = new NewExprNode((yyvsp[0].node)); }
+#line 2058 "grammar.cpp"
     break;
 
-  case 39:
-#line 243 "grammar.y"
-    { (yyval.node) = new FunctionCallNode((yyvsp[(1) - (2)].node), (yyvsp[(2) - (2)].args)); ;}
+  case 38: /* CallExpr: MemberExpr Arguments  */
+#line 246 "grammar.y"
+                                   { (yyval.node) = new FunctionCallNode((yyvsp[-1].node), (yyvsp[0].args)); }
+#line 2064 "grammar.cpp"
     break;
 
-  case 40:
-#line 244 "grammar.y"
-    { (yyval.node) = new AccessorNode1((yyvsp[(1) - (4)].node), (yyvsp[(3) - (4)].node)); ;}
+  case 39: /* CallExpr: CallExpr Arguments  */
+#line 247 "grammar.y"
+                                   { (yyval.node) = new FunctionCallNode((yyvsp[-1].node), (yyvsp[0].args)); }
+#line 2070 "grammar.cpp"
     break;
 
-  case 41:
-#line 245 "grammar.y"
-    { (yyval.node) = new AccessorNode2((yyvsp[(1) - (3)].node), *(yyvsp[(3) - (3)].ident)); ;}
+  case 40: /* CallExpr: CallExpr '[' Expr ']'  */
+#line 248 "grammar.y"
+                                   { (yyval.node) = new AccessorNode1((yyvsp[-3].node), (yyvsp[-1].node)); }
+#line 2076 "grammar.cpp"
     break;
 
-  case 42:
+  case 41: /* CallExpr: CallExpr '.' IDENT  */
 #line 249 "grammar.y"
-    { (yyval.args) = new ArgumentsNode(); ;}
+                                   { (yyval.node) = new AccessorNode2((yyvsp[-2].node), (yyvsp[0].text).ident()); }
+#line 2082 "grammar.cpp"
     break;
 
-  case 43:
-#line 250 "grammar.y"
-    { (yyval.args) = new ArgumentsNode((yyvsp[(2) - (3)].alist)); ;}
+  case 42: /* Arguments: '(' ')'  */
+#line 253 "grammar.y"
+                                   { (yyval.args) = new ArgumentsNode(); }
+#line 2088 "grammar.cpp"
     break;
 
-  case 44:
+  case 43: /* Arguments: '(' ArgumentList ')'  */
 #line 254 "grammar.y"
-    { (yyval.alist) = new ArgumentListNode((yyvsp[(1) - (1)].node)); ;}
-    break;
-
-  case 45:
-#line 255 "grammar.y"
-    { (yyval.alist) = new ArgumentListNode((yyvsp[(1) - (3)].alist), (yyvsp[(3) - (3)].node)); ;}
+                                   { (yyval.args) = new ArgumentsNode((yyvsp[-1].alist)); }
+#line 2094 "grammar.cpp"
     break;
 
-  case 49:
-#line 265 "grammar.y"
-    { (yyval.node) = new PostfixNode((yyvsp[(1) - (2)].node), OpPlusPlus); ;}
+  case 44: /* ArgumentList: AssignmentExpr  */
+#line 258 "grammar.y"
+                                    { (yyval.alist) = new ArgumentListNode((yyvsp[0].node)); }
+#line 2100 "grammar.cpp"
     break;
 
-  case 50:
-#line 266 "grammar.y"
-    { (yyval.node) = new PostfixNode((yyvsp[(1) - (2)].node), OpMinusMinus); ;}
+  case 45: /* ArgumentList: ArgumentList ',' AssignmentExpr  */
+#line 259 "grammar.y"
+                                    { (yyval.alist) = new ArgumentListNode((yyvsp[-2].alist), (yyvsp[0].node)); }
+#line 2106 "grammar.cpp"
     break;
 
-  case 52:
-#line 271 "grammar.y"
-    { (yyval.node) = new DeleteNode((yyvsp[(2) - (2)].node)); ;}
+  case 49: /* PostfixExpr: LeftHandSideExpr PLUSPLUS  */
+#line 269 "grammar.y"
+                                   { (yyval.node) = new PostfixNode((yyvsp[-1].node), OpPlusPlus); }
+#line 2112 "grammar.cpp"
     break;
 
-  case 53:
-#line 272 "grammar.y"
-    { (yyval.node) = new VoidNode((yyvsp[(2) - (2)].node)); ;}
+  case 50: /* PostfixExpr: LeftHandSideExpr MINUSMINUS  */
+#line 270 "grammar.y"
+                                   { (yyval.node) = new PostfixNode((yyvsp[-1].node), OpMinusMinus); }
+#line 2118 "grammar.cpp"
     break;
 
-  case 54:
-#line 273 "grammar.y"
-    { (yyval.node) = new TypeOfNode((yyvsp[(2) - (2)].node)); ;}
-    break;
-
-  case 55:
-#line 274 "grammar.y"
-    { (yyval.node) = new PrefixNode(OpPlusPlus, (yyvsp[(2) - (2)].node)); ;}
-    break;
-
-  case 56:
+  case 52: /* UnaryExpr: DELETE UnaryExpr  */
 #line 275 "grammar.y"
-    { (yyval.node) = new PrefixNode(OpPlusPlus, (yyvsp[(2) - (2)].node)); ;}
+                                   { (yyval.node) = new DeleteNode((yyvsp[0].node)); }
+#line 2124 "grammar.cpp"
     break;
 
-  case 57:
+  case 53: /* UnaryExpr: VOID UnaryExpr  */
 #line 276 "grammar.y"
-    { (yyval.node) = new PrefixNode(OpMinusMinus, (yyvsp[(2) - (2)].node)); ;}
+                                   { (yyval.node) = new VoidNode((yyvsp[0].node)); }
+#line 2130 "grammar.cpp"
     break;
 
-  case 58:
+  case 54: /* UnaryExpr: TYPEOF UnaryExpr  */
 #line 277 "grammar.y"
-    { (yyval.node) = new PrefixNode(OpMinusMinus, (yyvsp[(2) - (2)].node)); ;}
+                                   { (yyval.node) = new TypeOfNode((yyvsp[0].node)); }
+#line 2136 "grammar.cpp"
     break;
 
-  case 59:
+  case 55: /* UnaryExpr: PLUSPLUS UnaryExpr  */
 #line 278 "grammar.y"
-    { (yyval.node) = new UnaryPlusNode((yyvsp[(2) - (2)].node)); ;}
+                                   { (yyval.node) = new PrefixNode(OpPlusPlus, (yyvsp[0].node)); }
+#line 2142 "grammar.cpp"
     break;
 
-  case 60:
+  case 56: /* UnaryExpr: AUTOPLUSPLUS UnaryExpr  */
 #line 279 "grammar.y"
-    { (yyval.node) = new NegateNode((yyvsp[(2) - (2)].node)); ;}
+                                   { (yyval.node) = new PrefixNode(OpPlusPlus, (yyvsp[0].node)); }
+#line 2148 "grammar.cpp"
     break;
 
-  case 61:
+  case 57: /* UnaryExpr: MINUSMINUS UnaryExpr  */
 #line 280 "grammar.y"
-    { (yyval.node) = new BitwiseNotNode((yyvsp[(2) - (2)].node)); ;}
+                                   { (yyval.node) = new PrefixNode(OpMinusMinus, (yyvsp[0].node)); }
+#line 2154 "grammar.cpp"
     break;
 
-  case 62:
+  case 58: /* UnaryExpr: AUTOMINUSMINUS UnaryExpr  */
 #line 281 "grammar.y"
-    { (yyval.node) = new LogicalNotNode((yyvsp[(2) - (2)].node)); ;}
+                                   { (yyval.node) = new PrefixNode(OpMinusMinus, (yyvsp[0].node)); }
+#line 2160 "grammar.cpp"
     break;
 
-  case 64:
-#line 286 "grammar.y"
-    { (yyval.node) = new MultNode((yyvsp[(1) - (3)].node), (yyvsp[(3) - (3)].node), '*'); ;}
+  case 59: /* UnaryExpr: '+' UnaryExpr  */
+#line 282 "grammar.y"
+                                   { (yyval.node) = new UnaryPlusNode((yyvsp[0].node)); }
+#line 2166 "grammar.cpp"
     break;
 
-  case 65:
-#line 287 "grammar.y"
-    { (yyval.node) = new MultNode((yyvsp[(1) - (3)].node), (yyvsp[(3) - (3)].node), '/'); ;}
+  case 60: /* UnaryExpr: '-' UnaryExpr  */
+#line 283 "grammar.y"
+                                   { (yyval.node) = new NegateNode((yyvsp[0].node)); }
+#line 2172 "grammar.cpp"
     break;
 
-  case 66:
-#line 288 "grammar.y"
-    { (yyval.node) = new MultNode((yyvsp[(1) - (3)].node),(yyvsp[(3) - (3)].node),'%'); ;}
+  case 61: /* UnaryExpr: '~' UnaryExpr  */
+#line 284 "grammar.y"
+                                   { (yyval.node) = new BitwiseNotNode((yyvsp[0].node)); }
+#line 2178 "grammar.cpp"
     break;
 
-  case 68:
-#line 293 "grammar.y"
-    { (yyval.node) = AddNode::create((yyvsp[(1) - (3)].node), (yyvsp[(3) - (3)].node), '+'); ;}
+  case 62: /* UnaryExpr: '!' UnaryExpr  */
+#line 285 "grammar.y"
+                                   { (yyval.node) = new LogicalNotNode((yyvsp[0].node)); }
+#line 2184 "grammar.cpp"
     break;
 
-  case 69:
-#line 294 "grammar.y"
-    { (yyval.node) = AddNode::create((yyvsp[(1) - (3)].node), (yyvsp[(3) - (3)].node), '-'); ;}
+  case 64: /* MultiplicativeExpr: MultiplicativeExpr '*' UnaryExpr  */
+#line 290 "grammar.y"
+                                     { (yyval.node) = new MultNode((yyvsp[-2].node), (yyvsp[0].node), '*'); }
+#line 2190 "grammar.cpp"
     break;
 
-  case 71:
-#line 299 "grammar.y"
-    { (yyval.node) = new ShiftNode((yyvsp[(1) - (3)].node), OpLShift, (yyvsp[(3) - (3)].node)); ;}
+  case 65: /* MultiplicativeExpr: MultiplicativeExpr '/' UnaryExpr  */
+#line 291 "grammar.y"
+                                     { (yyval.node) = new MultNode((yyvsp[-2].node), (yyvsp[0].node), '/'); }
+#line 2196 "grammar.cpp"
     break;
 
-  case 72:
-#line 300 "grammar.y"
-    { (yyval.node) = new ShiftNode((yyvsp[(1) - (3)].node), OpRShift, (yyvsp[(3) - (3)].node)); ;}
+  case 66: /* MultiplicativeExpr: MultiplicativeExpr '%' UnaryExpr  */
+#line 292 "grammar.y"
+                                     { (yyval.node) = new MultNode((yyvsp[-2].node),(yyvsp[0].node),'%'); }
+#line 2202 "grammar.cpp"
     break;
 
-  case 73:
-#line 301 "grammar.y"
-    { (yyval.node) = new ShiftNode((yyvsp[(1) - (3)].node), OpURShift, (yyvsp[(3) - (3)].node)); ;}
+  case 68: /* AdditiveExpr: AdditiveExpr '+' MultiplicativeExpr  */
+#line 297 "grammar.y"
+                                        { (yyval.node) = AddNode::create((yyvsp[-2].node), (yyvsp[0].node), '+'); }
+#line 2208 "grammar.cpp"
     break;
 
-  case 75:
-#line 307 "grammar.y"
-    { (yyval.node) = new RelationalNode((yyvsp[(1) - (3)].node), OpLess, (yyvsp[(3) - (3)].node)); ;}
+  case 69: /* AdditiveExpr: AdditiveExpr '-' MultiplicativeExpr  */
+#line 298 "grammar.y"
+                                        { (yyval.node) = AddNode::create((yyvsp[-2].node), (yyvsp[0].node), '-'); }
+#line 2214 "grammar.cpp"
     break;
 
-  case 76:
-#line 309 "grammar.y"
-    { (yyval.node) = new RelationalNode((yyvsp[(1) - (3)].node), OpGreater, (yyvsp[(3) - (3)].node)); ;}
+  case 71: /* ShiftExpr: ShiftExpr LSHIFT AdditiveExpr  */
+#line 303 "grammar.y"
+                                   { (yyval.node) = new ShiftNode((yyvsp[-2].node), OpLShift, (yyvsp[0].node)); }
+#line 2220 "grammar.cpp"
     break;
 
-  case 77:
-#line 311 "grammar.y"
-    { (yyval.node) = new RelationalNode((yyvsp[(1) - (3)].node), OpLessEq, (yyvsp[(3) - (3)].node)); ;}
+  case 72: /* ShiftExpr: ShiftExpr RSHIFT AdditiveExpr  */
+#line 304 "grammar.y"
+                                   { (yyval.node) = new ShiftNode((yyvsp[-2].node), OpRShift, (yyvsp[0].node)); }
+#line 2226 "grammar.cpp"
     break;
 
-  case 78:
-#line 313 "grammar.y"
-    { (yyval.node) = new RelationalNode((yyvsp[(1) - (3)].node), OpGreaterEq, (yyvsp[(3) - (3)].node)); ;}
+  case 73: /* ShiftExpr: ShiftExpr URSHIFT AdditiveExpr  */
+#line 305 "grammar.y"
+                                   { (yyval.node) = new ShiftNode((yyvsp[-2].node), OpURShift, (yyvsp[0].node)); }
+#line 2232 "grammar.cpp"
     break;
 
-  case 79:
-#line 315 "grammar.y"
-    { (yyval.node) = new RelationalNode((yyvsp[(1) - (3)].node), OpInstanceOf, (yyvsp[(3) - (3)].node)); ;}
+  case 75: /* RelationalExpr: RelationalExpr '<' ShiftExpr  */
+#line 311 "grammar.y"
+                           { (yyval.node) = new RelationalNode((yyvsp[-2].node), OpLess, (yyvsp[0].node)); }
+#line 2238 "grammar.cpp"
     break;
 
-  case 80:
-#line 317 "grammar.y"
-    { (yyval.node) = new RelationalNode((yyvsp[(1) - (3)].node), OpIn, (yyvsp[(3) - (3)].node)); ;}
+  case 76: /* RelationalExpr: RelationalExpr '>' ShiftExpr  */
+#line 313 "grammar.y"
+                           { (yyval.node) = new RelationalNode((yyvsp[-2].node), OpGreater, (yyvsp[0].node)); }
+#line 2244 "grammar.cpp"
     break;
 
-  case 82:
-#line 322 "grammar.y"
-    { (yyval.node) = new EqualNode((yyvsp[(1) - (3)].node), OpEqEq, (yyvsp[(3) - (3)].node)); ;}
+  case 77: /* RelationalExpr: RelationalExpr LE ShiftExpr  */
+#line 315 "grammar.y"
+                           { (yyval.node) = new RelationalNode((yyvsp[-2].node), OpLessEq, (yyvsp[0].node)); }
+#line 2250 "grammar.cpp"
     break;
 
-  case 83:
-#line 323 "grammar.y"
-    { (yyval.node) = new EqualNode((yyvsp[(1) - (3)].node), OpNotEq, (yyvsp[(3) - (3)].node)); ;}
+  case 78: /* RelationalExpr: RelationalExpr GE ShiftExpr  */
+#line 317 "grammar.y"
+                           { (yyval.node) = new RelationalNode((yyvsp[-2].node), OpGreaterEq, (yyvsp[0].node)); }
+#line 2256 "grammar.cpp"
     break;
 
-  case 84:
-#line 324 "grammar.y"
-    { (yyval.node) = new EqualNode((yyvsp[(1) - (3)].node), OpStrEq, (yyvsp[(3) - (3)].node)); ;}
+  case 79: /* RelationalExpr: RelationalExpr INSTANCEOF ShiftExpr  */
+#line 319 "grammar.y"
+                           { (yyval.node) = new RelationalNode((yyvsp[-2].node), OpInstanceOf, (yyvsp[0].node)); }
+#line 2262 "grammar.cpp"
     break;
 
-  case 85:
-#line 325 "grammar.y"
-    { (yyval.node) = new EqualNode((yyvsp[(1) - (3)].node), OpStrNEq, (yyvsp[(3) - (3)].node));;}
+  case 80: /* RelationalExpr: RelationalExpr IN ShiftExpr  */
+#line 321 "grammar.y"
+                           { (yyval.node) = new RelationalNode((yyvsp[-2].node), OpIn, (yyvsp[0].node)); }
+#line 2268 "grammar.cpp"
     break;
 
-  case 87:
-#line 330 "grammar.y"
-    { (yyval.node) = new BitOperNode((yyvsp[(1) - (3)].node), OpBitAnd, (yyvsp[(3) - (3)].node)); ;}
+  case 82: /* EqualityExpr: EqualityExpr EQEQ RelationalExpr  */
+#line 326 "grammar.y"
+                                       { (yyval.node) = new EqualNode((yyvsp[-2].node), OpEqEq, (yyvsp[0].node)); }
+#line 2274 "grammar.cpp"
     break;
 
-  case 89:
-#line 335 "grammar.y"
-    { (yyval.node) = new BitOperNode((yyvsp[(1) - (3)].node), OpBitXOr, (yyvsp[(3) - (3)].node)); ;}
+  case 83: /* EqualityExpr: EqualityExpr NE RelationalExpr  */
+#line 327 "grammar.y"
+                                       { (yyval.node) = new EqualNode((yyvsp[-2].node), OpNotEq, (yyvsp[0].node)); }
+#line 2280 "grammar.cpp"
     break;
 
-  case 91:
-#line 340 "grammar.y"
-    { (yyval.node) = new BitOperNode((yyvsp[(1) - (3)].node), OpBitOr, (yyvsp[(3) - (3)].node)); ;}
+  case 84: /* EqualityExpr: EqualityExpr STREQ RelationalExpr  */
+#line 328 "grammar.y"
+                                       { (yyval.node) = new EqualNode((yyvsp[-2].node), OpStrEq, (yyvsp[0].node)); }
+#line 2286 "grammar.cpp"
     break;
 
-  case 93:
-#line 346 "grammar.y"
-    { (yyval.node) = new BinaryLogicalNode((yyvsp[(1) - (3)].node), OpAnd, (yyvsp[(3) - (3)].node)); ;}
+  case 85: /* EqualityExpr: EqualityExpr STRNEQ RelationalExpr  */
+#line 329 "grammar.y"
+                                       { (yyval.node) = new EqualNode((yyvsp[-2].node), OpStrNEq, (yyvsp[0].node));}
+#line 2292 "grammar.cpp"
     break;
 
-  case 95:
-#line 352 "grammar.y"
-    { (yyval.node) = new BinaryLogicalNode((yyvsp[(1) - (3)].node), OpOr, (yyvsp[(3) - (3)].node)); ;}
+  case 87: /* BitwiseANDExpr: BitwiseANDExpr '&' EqualityExpr  */
+#line 334 "grammar.y"
+                                    { (yyval.node) = new BitOperNode((yyvsp[-2].node), OpBitAnd, (yyvsp[0].node)); }
+#line 2298 "grammar.cpp"
     break;
 
-  case 97:
-#line 358 "grammar.y"
-    { (yyval.node) = new ConditionalNode((yyvsp[(1) - (5)].node), (yyvsp[(3) - (5)].node), (yyvsp[(5) - (5)].node)); ;}
+  case 89: /* BitwiseXORExpr: BitwiseXORExpr '^' BitwiseANDExpr  */
+#line 339 "grammar.y"
+                                      { (yyval.node) = new BitOperNode((yyvsp[-2].node), OpBitXOr, (yyvsp[0].node)); }
+#line 2304 "grammar.cpp"
     break;
 
-  case 99:
-#line 364 "grammar.y"
-    { (yyval.node) = new AssignNode((yyvsp[(1) - (3)].node), (yyvsp[(2) - (3)].op), (yyvsp[(3) - (3)].node));;}
+  case 91: /* BitwiseORExpr: BitwiseORExpr '|' BitwiseXORExpr  */
+#line 344 "grammar.y"
+                                     { (yyval.node) = new BitOperNode((yyvsp[-2].node), OpBitOr, (yyvsp[0].node)); }
+#line 2310 "grammar.cpp"
     break;
 
-  case 100:
-#line 368 "grammar.y"
-    { (yyval.op) = OpEqual; ;}
+  case 93: /* LogicalANDExpr: LogicalANDExpr AND BitwiseORExpr  */
+#line 350 "grammar.y"
+                           { (yyval.node) = new BinaryLogicalNode((yyvsp[-2].node), OpAnd, (yyvsp[0].node)); }
+#line 2316 "grammar.cpp"
     break;
 
-  case 101:
-#line 369 "grammar.y"
-    { (yyval.op) = OpPlusEq; ;}
+  case 95: /* LogicalORExpr: LogicalORExpr OR LogicalANDExpr  */
+#line 356 "grammar.y"
+                           { (yyval.node) = new BinaryLogicalNode((yyvsp[-2].node), OpOr, (yyvsp[0].node)); }
+#line 2322 "grammar.cpp"
     break;
 
-  case 102:
-#line 370 "grammar.y"
-    { (yyval.op) = OpMinusEq; ;}
+  case 97: /* ConditionalExpr: LogicalORExpr '?' AssignmentExpr ':' AssignmentExpr  */
+#line 362 "grammar.y"
+                           { (yyval.node) = new ConditionalNode((yyvsp[-4].node), (yyvsp[-2].node), (yyvsp[0].node)); }
+#line 2328 "grammar.cpp"
     break;
 
-  case 103:
-#line 371 "grammar.y"
-    { (yyval.op) = OpMultEq; ;}
+  case 99: /* AssignmentExpr: LeftHandSideExpr AssignmentOperator AssignmentExpr  */
+#line 368 "grammar.y"
+                           { (yyval.node) = new AssignNode((yyvsp[-2].node), (yyvsp[-1].op), (yyvsp[0].node));}
+#line 2334 "grammar.cpp"
     break;
 
-  case 104:
+  case 100: /* AssignmentOperator: '='  */
 #line 372 "grammar.y"
-    { (yyval.op) = OpDivEq; ;}
+                                   { (yyval.op) = OpEqual; }
+#line 2340 "grammar.cpp"
     break;
 
-  case 105:
+  case 101: /* AssignmentOperator: PLUSEQUAL  */
 #line 373 "grammar.y"
-    { (yyval.op) = OpLShift; ;}
+                                   { (yyval.op) = OpPlusEq; }
+#line 2346 "grammar.cpp"
     break;
 
-  case 106:
+  case 102: /* AssignmentOperator: MINUSEQUAL  */
 #line 374 "grammar.y"
-    { (yyval.op) = OpRShift; ;}
+                                   { (yyval.op) = OpMinusEq; }
+#line 2352 "grammar.cpp"
     break;
 
-  case 107:
+  case 103: /* AssignmentOperator: MULTEQUAL  */
 #line 375 "grammar.y"
-    { (yyval.op) = OpURShift; ;}
+                                   { (yyval.op) = OpMultEq; }
+#line 2358 "grammar.cpp"
     break;
 
-  case 108:
+  case 104: /* AssignmentOperator: DIVEQUAL  */
 #line 376 "grammar.y"
-    { (yyval.op) = OpAndEq; ;}
+                                   { (yyval.op) = OpDivEq; }
+#line 2364 "grammar.cpp"
     break;
 
-  case 109:
+  case 105: /* AssignmentOperator: LSHIFTEQUAL  */
 #line 377 "grammar.y"
-    { (yyval.op) = OpXOrEq; ;}
+                                   { (yyval.op) = OpLShift; }
+#line 2370 "grammar.cpp"
     break;
 
-  case 110:
+  case 106: /* AssignmentOperator: RSHIFTEQUAL  */
 #line 378 "grammar.y"
-    { (yyval.op) = OpOrEq; ;}
+                                   { (yyval.op) = OpRShift; }
+#line 2376 "grammar.cpp"
     break;
 
-  case 111:
+  case 107: /* AssignmentOperator: URSHIFTEQUAL  */
 #line 379 "grammar.y"
-    { (yyval.op) = OpModEq; ;}
+                                   { (yyval.op) = OpURShift; }
+#line 2382 "grammar.cpp"
+    break;
+
+  case 108: /* AssignmentOperator: ANDEQUAL  */
+#line 380 "grammar.y"
+                                   { (yyval.op) = OpAndEq; }
+#line 2388 "grammar.cpp"
     break;
 
-  case 113:
-#line 384 "grammar.y"
-    { (yyval.node) = new CommaNode((yyvsp[(1) - (3)].node), (yyvsp[(3) - (3)].node)); ;}
+  case 109: /* AssignmentOperator: XOREQUAL  */
+#line 381 "grammar.y"
+                                   { (yyval.op) = OpXOrEq; }
+#line 2394 "grammar.cpp"
     break;
 
-  case 130:
-#line 407 "grammar.y"
-    { (yyval.stat) = new BlockNode(0); DBG((yyval.stat), (yylsp[(2) - (2)]), (yylsp[(2) - (2)])); ;}
+  case 110: /* AssignmentOperator: OREQUAL  */
+#line 382 "grammar.y"
+                                   { (yyval.op) = OpOrEq; }
+#line 2400 "grammar.cpp"
     break;
 
-  case 131:
-#line 408 "grammar.y"
-    { (yyval.stat) = new BlockNode((yyvsp[(2) - (3)].srcs)); DBG((yyval.stat), (yylsp[(3) - (3)]), (yylsp[(3) - (3)])); ;}
+  case 111: /* AssignmentOperator: MODEQUAL  */
+#line 383 "grammar.y"
+                                   { (yyval.op) = OpModEq; }
+#line 2406 "grammar.cpp"
     break;
 
-  case 132:
+  case 113: /* Expr: Expr ',' AssignmentExpr  */
+#line 388 "grammar.y"
+                                   { (yyval.node) = new CommaNode((yyvsp[-2].node), (yyvsp[0].node)); }
+#line 2412 "grammar.cpp"
+    break;
+
+  case 130: /* Block: '{' '}'  */
+#line 411 "grammar.y"
+                                   { (yyval.stat) = new BlockNode(0); DBG((yyval.stat), (yylsp[0]), (yylsp[0])); }
+#line 2418 "grammar.cpp"
+    break;
+
+  case 131: /* Block: '{' SourceElements '}'  */
 #line 412 "grammar.y"
-    { (yyval.slist) = new StatListNode((yyvsp[(1) - (1)].stat)); ;}
+                                    { (yyval.stat) = new BlockNode((yyvsp[-1].srcs)); DBG((yyval.stat), (yylsp[0]), (yylsp[0])); }
+#line 2424 "grammar.cpp"
     break;
 
-  case 133:
-#line 413 "grammar.y"
-    { (yyval.slist) = new StatListNode((yyvsp[(1) - (2)].slist), (yyvsp[(2) - (2)].stat)); ;}
+  case 132: /* StatementList: Statement  */
+#line 416 "grammar.y"
+                                   { (yyval.slist) = new StatListNode((yyvsp[0].stat)); }
+#line 2430 "grammar.cpp"
     break;
 
-  case 134:
+  case 133: /* StatementList: StatementList Statement  */
 #line 417 "grammar.y"
-    { (yyval.stat) = new VarStatementNode((yyvsp[(2) - (3)].vlist));
-                                      DBG((yyval.stat), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); ;}
+                                   { (yyval.slist) = new StatListNode((yyvsp[-1].slist), (yyvsp[0].stat)); }
+#line 2436 "grammar.cpp"
     break;
 
-  case 135:
-#line 419 "grammar.y"
-    { if (automatic()) {
-                                          (yyval.stat) = new VarStatementNode((yyvsp[(2) - (3)].vlist));
-					  DBG((yyval.stat), (yylsp[(1) - (3)]), (yylsp[(2) - (3)]));
+  case 134: /* VariableStatement: VAR VariableDeclarationList ';'  */
+#line 421 "grammar.y"
+                                    { (yyval.stat) = new VarStatementNode((yyvsp[-1].vlist));
+                                      DBG((yyval.stat), (yylsp[-2]), (yylsp[0])); }
+#line 2443 "grammar.cpp"
+    break;
+
+  case 135: /* VariableStatement: VAR VariableDeclarationList error  */
+#line 423 "grammar.y"
+                                      { if (automatic(parser, yychar)) {
+                                          (yyval.stat) = new VarStatementNode((yyvsp[-1].vlist));
+					  DBG((yyval.stat), (yylsp[-2]), (yylsp[-1]));
                                         } else {
 					  YYABORT;
 					}
-                                      ;}
-    break;
-
-  case 136:
-#line 429 "grammar.y"
-    { (yyval.vlist) = new VarDeclListNode((yyvsp[(1) - (1)].decl)); ;}
+                                      }
+#line 2455 "grammar.cpp"
     break;
 
-  case 137:
-#line 431 "grammar.y"
-    { (yyval.vlist) = new VarDeclListNode((yyvsp[(1) - (3)].vlist), (yyvsp[(3) - (3)].decl)); ;}
+  case 136: /* VariableDeclarationList: VariableDeclaration  */
+#line 433 "grammar.y"
+                                   { (yyval.vlist) = new VarDeclListNode((yyvsp[0].decl)); }
+#line 2461 "grammar.cpp"
     break;
 
-  case 138:
+  case 137: /* VariableDeclarationList: VariableDeclarationList ',' VariableDeclaration  */
 #line 435 "grammar.y"
-    { (yyval.decl) = new VarDeclNode(*(yyvsp[(1) - (1)].ident), 0, VarDeclNode::Variable); ;}
+                                   { (yyval.vlist) = new VarDeclListNode((yyvsp[-2].vlist), (yyvsp[0].decl)); }
+#line 2467 "grammar.cpp"
     break;
 
-  case 139:
-#line 436 "grammar.y"
-    { (yyval.decl) = new VarDeclNode(*(yyvsp[(1) - (2)].ident), (yyvsp[(2) - (2)].init), VarDeclNode::Variable); ;}
+  case 138: /* VariableDeclaration: IDENT  */
+#line 439 "grammar.y"
+                                   { (yyval.decl) = new VarDeclNode((yyvsp[0].text).ident(), 0, VarDeclNode::Variable); }
+#line 2473 "grammar.cpp"
     break;
 
-  case 140:
+  case 139: /* VariableDeclaration: IDENT Initializer  */
 #line 440 "grammar.y"
-    { (yyval.stat) = new VarStatementNode((yyvsp[(2) - (3)].vlist));
-                                      DBG((yyval.stat), (yylsp[(1) - (3)]), (yylsp[(3) - (3)])); ;}
+                                   { (yyval.decl) = new VarDeclNode((yyvsp[-1].text).ident(), (yyvsp[0].init), VarDeclNode::Variable); }
+#line 2479 "grammar.cpp"
     break;
 
-  case 141:
-#line 442 "grammar.y"
-    { if (automatic()) {
-                                          (yyval.stat) = new VarStatementNode((yyvsp[(2) - (3)].vlist));
-					  DBG((yyval.stat), (yylsp[(1) - (3)]), (yylsp[(2) - (3)]));
+  case 140: /* ConstStatement: CONST ConstDeclarationList ';'  */
+#line 444 "grammar.y"
+                                   { (yyval.stat) = new VarStatementNode((yyvsp[-1].vlist));
+                                      DBG((yyval.stat), (yylsp[-2]), (yylsp[0])); }
+#line 2486 "grammar.cpp"
+    break;
+
+  case 141: /* ConstStatement: CONST ConstDeclarationList error  */
+#line 446 "grammar.y"
+                                     { if (automatic(parser, yychar)) {
+                                          (yyval.stat) = new VarStatementNode((yyvsp[-1].vlist));
+					  DBG((yyval.stat), (yylsp[-2]), (yylsp[-1]));
                                         } else {
 					  YYABORT;
 					}
-                                      ;}
-    break;
-
-  case 142:
-#line 452 "grammar.y"
-    { (yyval.vlist) = new VarDeclListNode((yyvsp[(1) - (1)].decl)); ;}
+                                      }
+#line 2498 "grammar.cpp"
     break;
 
-  case 143:
-#line 454 "grammar.y"
-    { (yyval.vlist) = new VarDeclListNode((yyvsp[(1) - (3)].vlist), (yyvsp[(3) - (3)].decl)); ;}
+  case 142: /* ConstDeclarationList: ConstDeclaration  */
+#line 456 "grammar.y"
+                                { (yyval.vlist) = new VarDeclListNode((yyvsp[0].decl)); }
+#line 2504 "grammar.cpp"
     break;
 
-  case 144:
+  case 143: /* ConstDeclarationList: ConstDeclarationList ',' VariableDeclaration  */
 #line 458 "grammar.y"
-    { (yyval.decl) = new VarDeclNode(*(yyvsp[(1) - (1)].ident), 0, VarDeclNode::Constant); ;}
+                                   { (yyval.vlist) = new VarDeclListNode((yyvsp[-2].vlist), (yyvsp[0].decl)); }
+#line 2510 "grammar.cpp"
     break;
 
-  case 145:
-#line 459 "grammar.y"
-    { (yyval.decl) = new VarDeclNode(*(yyvsp[(1) - (2)].ident), (yyvsp[(2) - (2)].init), VarDeclNode::Constant); ;}
+  case 144: /* ConstDeclaration: IDENT  */
+#line 462 "grammar.y"
+                                   { (yyval.decl) = new VarDeclNode((yyvsp[0].text).ident(), 0, VarDeclNode::Constant); }
+#line 2516 "grammar.cpp"
     break;
 
-  case 146:
+  case 145: /* ConstDeclaration: IDENT Initializer  */
 #line 463 "grammar.y"
-    { (yyval.init) = new AssignExprNode((yyvsp[(2) - (2)].node)); ;}
+                                   { (yyval.decl) = new VarDeclNode((yyvsp[-1].text).ident(), (yyvsp[0].init), VarDeclNode::Constant); }
+#line 2522 "grammar.cpp"
     break;
 
-  case 147:
+  case 146: /* Initializer: '=' AssignmentExpr  */
 #line 467 "grammar.y"
-    { (yyval.stat) = new EmptyStatementNode(); DBG((yyval.stat), (yylsp[(1) - (1)]), (yylsp[(1) - (1)])); ;}
+                                   { (yyval.init) = new AssignExprNode((yyvsp[0].node)); }
+#line 2528 "grammar.cpp"
     break;
 
-  case 148:
+  case 147: /* EmptyStatement: ';'  */
 #line 471 "grammar.y"
-    { (yyval.stat) = new ExprStatementNode((yyvsp[(1) - (2)].node));
-                                     DBG((yyval.stat), (yylsp[(1) - (2)]), (yylsp[(2) - (2)])); ;}
+                                   { (yyval.stat) = new EmptyStatementNode(); DBG((yyval.stat), (yylsp[0]), (yylsp[0])); }
+#line 2534 "grammar.cpp"
     break;
 
-  case 149:
-#line 473 "grammar.y"
-    { if (automatic()) {
-                                       (yyval.stat) = new ExprStatementNode((yyvsp[(1) - (2)].node));
-				       DBG((yyval.stat), (yylsp[(1) - (2)]), (yylsp[(1) - (2)]));
-                                     } else
-				       YYABORT; ;}
+  case 148: /* ExprStatement: Expr ';'  */
+#line 475 "grammar.y"
+                                   { (yyval.stat) = new ExprStatementNode((yyvsp[-1].node));
+                                     DBG((yyval.stat), (yylsp[-1]), (yylsp[0])); }
+#line 2541 "grammar.cpp"
     break;
 
-  case 150:
-#line 481 "grammar.y"
-    { (yyval.stat) = new IfNode((yyvsp[(3) - (5)].node),(yyvsp[(5) - (5)].stat),0);DBG((yyval.stat),(yylsp[(1) - (5)]),(yylsp[(4) - (5)])); ;}
+  case 149: /* ExprStatement: Expr error  */
+#line 477 "grammar.y"
+                                   { if (automatic(parser, yychar)) {
+                                       (yyval.stat) = new ExprStatementNode((yyvsp[-1].node));
+				       DBG((yyval.stat), (yylsp[-1]), (yylsp[-1]));
+                                     } else
+				       YYABORT; }
+#line 2551 "grammar.cpp"
     break;
 
-  case 151:
-#line 483 "grammar.y"
-    { (yyval.stat) = new IfNode((yyvsp[(3) - (7)].node),(yyvsp[(5) - (7)].stat),(yyvsp[(7) - (7)].stat));DBG((yyval.stat),(yylsp[(1) - (7)]),(yylsp[(4) - (7)])); ;}
+  case 150: /* IfStatement: IF '(' Expr ')' Statement  */
+#line 485 "grammar.y"
+                                   { (yyval.stat) = new IfNode((yyvsp[-2].node),(yyvsp[0].stat),0);DBG((yyval.stat),(yylsp[-4]),(yylsp[-1])); }
+#line 2557 "grammar.cpp"
     break;
 
-  case 152:
+  case 151: /* IfStatement: IF '(' Expr ')' Statement ELSE Statement  */
 #line 487 "grammar.y"
-    { (yyval.stat)=new DoWhileNode((yyvsp[(2) - (6)].stat),(yyvsp[(5) - (6)].node));DBG((yyval.stat),(yylsp[(1) - (6)]),(yylsp[(3) - (6)]));;}
+                                   { (yyval.stat) = new IfNode((yyvsp[-4].node),(yyvsp[-2].stat),(yyvsp[0].stat));DBG((yyval.stat),(yylsp[-6]),(yylsp[-3])); }
+#line 2563 "grammar.cpp"
     break;
 
-  case 153:
-#line 488 "grammar.y"
-    { (yyval.stat) = new WhileNode((yyvsp[(3) - (5)].node),(yyvsp[(5) - (5)].stat));DBG((yyval.stat),(yylsp[(1) - (5)]),(yylsp[(4) - (5)])); ;}
+  case 152: /* IterationStatement: DO Statement WHILE '(' Expr ')'  */
+#line 491 "grammar.y"
+                                    { (yyval.stat)=new DoWhileNode((yyvsp[-4].stat),(yyvsp[-1].node));DBG((yyval.stat),(yylsp[-5]),(yylsp[-3]));}
+#line 2569 "grammar.cpp"
     break;
 
-  case 154:
-#line 490 "grammar.y"
-    { (yyval.stat) = new ForNode((yyvsp[(3) - (9)].node),(yyvsp[(5) - (9)].node),(yyvsp[(7) - (9)].node),(yyvsp[(9) - (9)].stat));
-	                             DBG((yyval.stat),(yylsp[(1) - (9)]),(yylsp[(8) - (9)])); ;}
+  case 153: /* IterationStatement: WHILE '(' Expr ')' Statement  */
+#line 492 "grammar.y"
+                                   { (yyval.stat) = new WhileNode((yyvsp[-2].node),(yyvsp[0].stat));DBG((yyval.stat),(yylsp[-4]),(yylsp[-1])); }
+#line 2575 "grammar.cpp"
     break;
 
-  case 155:
-#line 493 "grammar.y"
-    { (yyval.stat) = new ForNode((yyvsp[(4) - (10)].vlist),(yyvsp[(6) - (10)].node),(yyvsp[(8) - (10)].node),(yyvsp[(10) - (10)].stat));
-	                             DBG((yyval.stat),(yylsp[(1) - (10)]),(yylsp[(9) - (10)])); ;}
+  case 154: /* IterationStatement: FOR '(' ExprOpt ';' ExprOpt ';' ExprOpt ')' Statement  */
+#line 494 "grammar.y"
+                                   { (yyval.stat) = new ForNode((yyvsp[-6].node),(yyvsp[-4].node),(yyvsp[-2].node),(yyvsp[0].stat));
+	                             DBG((yyval.stat),(yylsp[-8]),(yylsp[-1])); }
+#line 2582 "grammar.cpp"
     break;
 
-  case 156:
-#line 496 "grammar.y"
-    { (yyval.stat) = new ForInNode((yyvsp[(3) - (7)].node), (yyvsp[(5) - (7)].node), (yyvsp[(7) - (7)].stat));
-	                             DBG((yyval.stat),(yylsp[(1) - (7)]),(yylsp[(6) - (7)])); ;}
+  case 155: /* IterationStatement: FOR '(' VAR VariableDeclarationList ';' ExprOpt ';' ExprOpt ')' Statement  */
+#line 497 "grammar.y"
+                                   { (yyval.stat) = new ForNode((yyvsp[-6].vlist),(yyvsp[-4].node),(yyvsp[-2].node),(yyvsp[0].stat));
+	                             DBG((yyval.stat),(yylsp[-9]),(yylsp[-1])); }
+#line 2589 "grammar.cpp"
     break;
 
-  case 157:
-#line 499 "grammar.y"
-    { (yyval.stat) = new ForInNode(*(yyvsp[(4) - (8)].ident),0,(yyvsp[(6) - (8)].node),(yyvsp[(8) - (8)].stat));
-	                             DBG((yyval.stat),(yylsp[(1) - (8)]),(yylsp[(7) - (8)])); ;}
+  case 156: /* IterationStatement: FOR '(' LeftHandSideExpr IN Expr ')' Statement  */
+#line 500 "grammar.y"
+                                   { (yyval.stat) = new ForInNode((yyvsp[-4].node), (yyvsp[-2].node), (yyvsp[0].stat));
+	                             DBG((yyval.stat),(yylsp[-6]),(yylsp[-1])); }
+#line 2596 "grammar.cpp"
     break;
 
-  case 158:
-#line 502 "grammar.y"
-    { (yyval.stat) = new ForInNode(*(yyvsp[(4) - (9)].ident),(yyvsp[(5) - (9)].init),(yyvsp[(7) - (9)].node),(yyvsp[(9) - (9)].stat));
-	                             DBG((yyval.stat),(yylsp[(1) - (9)]),(yylsp[(8) - (9)])); ;}
+  case 157: /* IterationStatement: FOR '(' VAR IDENT IN Expr ')' Statement  */
+#line 503 "grammar.y"
+                                   { (yyval.stat) = new ForInNode((yyvsp[-4].text).ident(),0,(yyvsp[-2].node),(yyvsp[0].stat));
+	                             DBG((yyval.stat),(yylsp[-7]),(yylsp[-1])); }
+#line 2603 "grammar.cpp"
     break;
 
-  case 159:
-#line 507 "grammar.y"
-    { (yyval.node) = 0; ;}
+  case 158: /* IterationStatement: FOR '(' VAR IDENT Initializer IN Expr ')' Statement  */
+#line 506 "grammar.y"
+                                   { (yyval.stat) = new ForInNode((yyvsp[-5].text).ident(),(yyvsp[-4].init),(yyvsp[-2].node),(yyvsp[0].stat));
+	                             DBG((yyval.stat),(yylsp[-8]),(yylsp[-1])); }
+#line 2610 "grammar.cpp"
     break;
 
-  case 161:
-#line 512 "grammar.y"
-    { (yyval.stat) = new ContinueNode(); DBG((yyval.stat),(yylsp[(1) - (2)]),(yylsp[(2) - (2)])); ;}
+  case 159: /* ExprOpt: %empty  */
+#line 511 "grammar.y"
+                                   { (yyval.node) = 0; }
+#line 2616 "grammar.cpp"
     break;
 
-  case 162:
-#line 513 "grammar.y"
-    { if (automatic()) {
-                                       (yyval.stat) = new ContinueNode(); DBG((yyval.stat),(yylsp[(1) - (2)]),(yylsp[(2) - (2)]));
-                                     } else
-				       YYABORT; ;}
+  case 161: /* ContinueStatement: CONTINUE ';'  */
+#line 516 "grammar.y"
+                                   { (yyval.stat) = new ContinueNode(); DBG((yyval.stat),(yylsp[-1]),(yylsp[0])); }
+#line 2622 "grammar.cpp"
     break;
 
-  case 163:
+  case 162: /* ContinueStatement: CONTINUE error  */
 #line 517 "grammar.y"
-    { (yyval.stat) = new ContinueNode(*(yyvsp[(2) - (3)].ident)); DBG((yyval.stat),(yylsp[(1) - (3)]),(yylsp[(3) - (3)])); ;}
+                                   { if (automatic(parser, yychar)) {
+                                       (yyval.stat) = new ContinueNode(); DBG((yyval.stat),(yylsp[-1]),(yylsp[0]));
+                                     } else
+				       YYABORT; }
+#line 2631 "grammar.cpp"
     break;
 
-  case 164:
-#line 518 "grammar.y"
-    { if (automatic()) {
-                                       (yyval.stat) = new ContinueNode(*(yyvsp[(2) - (3)].ident));DBG((yyval.stat),(yylsp[(1) - (3)]),(yylsp[(2) - (3)]));
+  case 163: /* ContinueStatement: CONTINUE IDENT ';'  */
+#line 521 "grammar.y"
+                                   { (yyval.stat) = new ContinueNode((yyvsp[-1].text).ident()); DBG((yyval.stat),(yylsp[-2]),(yylsp[0])); }
+#line 2637 "grammar.cpp"
+    break;
+
+  case 164: /* ContinueStatement: CONTINUE IDENT error  */
+#line 522 "grammar.y"
+                                   { if (automatic(parser, yychar)) {
+                                       (yyval.stat) = new ContinueNode((yyvsp[-1].text).ident());DBG((yyval.stat),(yylsp[-2]),(yylsp[-1]));
                                      } else
-				       YYABORT; ;}
+				       YYABORT; }
+#line 2646 "grammar.cpp"
     break;
 
-  case 165:
-#line 525 "grammar.y"
-    { (yyval.stat) = new BreakNode();DBG((yyval.stat),(yylsp[(1) - (2)]),(yylsp[(2) - (2)])); ;}
+  case 165: /* BreakStatement: BREAK ';'  */
+#line 529 "grammar.y"
+                                   { (yyval.stat) = new BreakNode();DBG((yyval.stat),(yylsp[-1]),(yylsp[0])); }
+#line 2652 "grammar.cpp"
     break;
 
-  case 166:
-#line 526 "grammar.y"
-    { if (automatic()) {
-                                       (yyval.stat) = new BreakNode(); DBG((yyval.stat),(yylsp[(1) - (2)]),(yylsp[(1) - (2)]));
+  case 166: /* BreakStatement: BREAK error  */
+#line 530 "grammar.y"
+                                   { if (automatic(parser, yychar)) {
+                                       (yyval.stat) = new BreakNode(); DBG((yyval.stat),(yylsp[-1]),(yylsp[-1]));
                                      } else
-				       YYABORT; ;}
+				       YYABORT; }
+#line 2661 "grammar.cpp"
     break;
 
-  case 167:
-#line 530 "grammar.y"
-    { (yyval.stat) = new BreakNode(*(yyvsp[(2) - (3)].ident)); DBG((yyval.stat),(yylsp[(1) - (3)]),(yylsp[(3) - (3)])); ;}
+  case 167: /* BreakStatement: BREAK IDENT ';'  */
+#line 534 "grammar.y"
+                                   { (yyval.stat) = new BreakNode((yyvsp[-1].text).ident()); DBG((yyval.stat),(yylsp[-2]),(yylsp[0])); }
+#line 2667 "grammar.cpp"
     break;
 
-  case 168:
-#line 531 "grammar.y"
-    { if (automatic()) {
-                                       (yyval.stat) = new BreakNode(*(yyvsp[(2) - (3)].ident)); DBG((yyval.stat),(yylsp[(1) - (3)]),(yylsp[(2) - (3)]));
+  case 168: /* BreakStatement: BREAK IDENT error  */
+#line 535 "grammar.y"
+                                   { if (automatic(parser, yychar)) {
+                                       (yyval.stat) = new BreakNode((yyvsp[-1].text).ident()); DBG((yyval.stat),(yylsp[-2]),(yylsp[-1]));
                                      } else
 				       YYABORT;
-                                   ;}
+                                   }
+#line 2677 "grammar.cpp"
     break;
 
-  case 169:
-#line 539 "grammar.y"
-    { (yyval.stat) = new ReturnNode(0); DBG((yyval.stat),(yylsp[(1) - (2)]),(yylsp[(2) - (2)])); ;}
+  case 169: /* ReturnStatement: RETURN ';'  */
+#line 543 "grammar.y"
+                                   { (yyval.stat) = new ReturnNode(0); DBG((yyval.stat),(yylsp[-1]),(yylsp[0])); }
+#line 2683 "grammar.cpp"
     break;
 
-  case 170:
-#line 540 "grammar.y"
-    { if (automatic()) {
-                                       (yyval.stat) = new ReturnNode(0); DBG((yyval.stat),(yylsp[(1) - (2)]),(yylsp[(1) - (2)]));
+  case 170: /* ReturnStatement: RETURN error  */
+#line 544 "grammar.y"
+                                   { if (automatic(parser, yychar)) {
+                                       (yyval.stat) = new ReturnNode(0); DBG((yyval.stat),(yylsp[-1]),(yylsp[-1]));
                                      } else
-				       YYABORT; ;}
+				       YYABORT; }
+#line 2692 "grammar.cpp"
     break;
 
-  case 171:
-#line 544 "grammar.y"
-    { (yyval.stat) = new ReturnNode((yyvsp[(2) - (3)].node)); DBG((yyval.stat),(yylsp[(1) - (3)]),(yylsp[(3) - (3)])); ;}
+  case 171: /* ReturnStatement: RETURN Expr ';'  */
+#line 548 "grammar.y"
+                                   { (yyval.stat) = new ReturnNode((yyvsp[-1].node)); DBG((yyval.stat),(yylsp[-2]),(yylsp[0])); }
+#line 2698 "grammar.cpp"
     break;
 
-  case 172:
-#line 545 "grammar.y"
-    { if (automatic()) {
-                                       (yyval.stat) = new ReturnNode((yyvsp[(2) - (3)].node)); DBG((yyval.stat),(yylsp[(1) - (3)]),(yylsp[(1) - (3)]));
+  case 172: /* ReturnStatement: RETURN Expr error  */
+#line 549 "grammar.y"
+                                   { if (automatic(parser, yychar)) {
+                                       (yyval.stat) = new ReturnNode((yyvsp[-1].node)); DBG((yyval.stat),(yylsp[-2]),(yylsp[-2]));
                                      }
                                      else
-				       YYABORT; ;}
-    break;
-
-  case 173:
-#line 553 "grammar.y"
-    { (yyval.stat) = new WithNode((yyvsp[(3) - (5)].node),(yyvsp[(5) - (5)].stat));
-                                     DBG((yyval.stat), (yylsp[(1) - (5)]), (yylsp[(4) - (5)])); ;}
+				       YYABORT; }
+#line 2708 "grammar.cpp"
     break;
 
-  case 174:
-#line 558 "grammar.y"
-    { (yyval.stat) = new SwitchNode((yyvsp[(3) - (5)].node), (yyvsp[(5) - (5)].cblk));
-                                     DBG((yyval.stat), (yylsp[(1) - (5)]), (yylsp[(4) - (5)])); ;}
+  case 173: /* WithStatement: WITH '(' Expr ')' Statement  */
+#line 557 "grammar.y"
+                                   { (yyval.stat) = new WithNode((yyvsp[-2].node),(yyvsp[0].stat));
+                                     DBG((yyval.stat), (yylsp[-4]), (yylsp[-1])); }
+#line 2715 "grammar.cpp"
     break;
 
-  case 175:
-#line 563 "grammar.y"
-    { (yyval.cblk) = new CaseBlockNode((yyvsp[(2) - (3)].clist), 0, 0); ;}
+  case 174: /* SwitchStatement: SWITCH '(' Expr ')' CaseBlock  */
+#line 562 "grammar.y"
+                                   { (yyval.stat) = new SwitchNode((yyvsp[-2].node), (yyvsp[0].cblk));
+                                     DBG((yyval.stat), (yylsp[-4]), (yylsp[-1])); }
+#line 2722 "grammar.cpp"
     break;
 
-  case 176:
-#line 565 "grammar.y"
-    { (yyval.cblk) = new CaseBlockNode((yyvsp[(2) - (5)].clist), (yyvsp[(3) - (5)].ccl), (yyvsp[(4) - (5)].clist)); ;}
+  case 175: /* CaseBlock: '{' CaseClausesOpt '}'  */
+#line 567 "grammar.y"
+                                   { (yyval.cblk) = new CaseBlockNode((yyvsp[-1].clist), 0, 0); }
+#line 2728 "grammar.cpp"
     break;
 
-  case 177:
+  case 176: /* CaseBlock: '{' CaseClausesOpt DefaultClause CaseClausesOpt '}'  */
 #line 569 "grammar.y"
-    { (yyval.clist) = 0; ;}
+                                   { (yyval.cblk) = new CaseBlockNode((yyvsp[-3].clist), (yyvsp[-2].ccl), (yyvsp[-1].clist)); }
+#line 2734 "grammar.cpp"
     break;
 
-  case 179:
-#line 574 "grammar.y"
-    { (yyval.clist) = new ClauseListNode((yyvsp[(1) - (1)].ccl)); ;}
+  case 177: /* CaseClausesOpt: %empty  */
+#line 573 "grammar.y"
+                                   { (yyval.clist) = 0; }
+#line 2740 "grammar.cpp"
     break;
 
-  case 180:
-#line 575 "grammar.y"
-    { (yyval.clist) = new ClauseListNode((yyvsp[(1) - (2)].clist), (yyvsp[(2) - (2)].ccl)); ;}
+  case 179: /* CaseClauses: CaseClause  */
+#line 578 "grammar.y"
+                                   { (yyval.clist) = new ClauseListNode((yyvsp[0].ccl)); }
+#line 2746 "grammar.cpp"
     break;
 
-  case 181:
+  case 180: /* CaseClauses: CaseClauses CaseClause  */
 #line 579 "grammar.y"
-    { (yyval.ccl) = new CaseClauseNode((yyvsp[(2) - (3)].node)); ;}
+                                   { (yyval.clist) = new ClauseListNode((yyvsp[-1].clist), (yyvsp[0].ccl)); }
+#line 2752 "grammar.cpp"
     break;
 
-  case 182:
-#line 580 "grammar.y"
-    { (yyval.ccl) = new CaseClauseNode((yyvsp[(2) - (4)].node), (yyvsp[(4) - (4)].slist)); ;}
+  case 181: /* CaseClause: CASE Expr ':'  */
+#line 583 "grammar.y"
+                                   { (yyval.ccl) = new CaseClauseNode((yyvsp[-1].node)); }
+#line 2758 "grammar.cpp"
     break;
 
-  case 183:
+  case 182: /* CaseClause: CASE Expr ':' StatementList  */
 #line 584 "grammar.y"
-    { (yyval.ccl) = new CaseClauseNode(0); ;}
+                                   { (yyval.ccl) = new CaseClauseNode((yyvsp[-2].node), (yyvsp[0].slist)); }
+#line 2764 "grammar.cpp"
     break;
 
-  case 184:
-#line 585 "grammar.y"
-    { (yyval.ccl) = new CaseClauseNode(0, (yyvsp[(3) - (3)].slist)); ;}
+  case 183: /* DefaultClause: DEFAULT ':'  */
+#line 588 "grammar.y"
+                                   { (yyval.ccl) = new CaseClauseNode(0); }
+#line 2770 "grammar.cpp"
     break;
 
-  case 185:
+  case 184: /* DefaultClause: DEFAULT ':' StatementList  */
 #line 589 "grammar.y"
-    { (yyvsp[(3) - (3)].stat)->pushLabel(*(yyvsp[(1) - (3)].ident));
-                                     (yyval.stat) = new LabelNode(*(yyvsp[(1) - (3)].ident), (yyvsp[(3) - (3)].stat)); DBG((yyval.stat),(yylsp[(1) - (3)]),(yylsp[(2) - (3)])); ;}
+                                   { (yyval.ccl) = new CaseClauseNode(0, (yyvsp[0].slist)); }
+#line 2776 "grammar.cpp"
     break;
 
-  case 186:
-#line 594 "grammar.y"
-    { (yyval.stat) = new ThrowNode((yyvsp[(2) - (3)].node)); DBG((yyval.stat),(yylsp[(1) - (3)]),(yylsp[(3) - (3)])); ;}
+  case 185: /* LabelledStatement: IDENT ':' Statement  */
+#line 593 "grammar.y"
+                                   { (yyvsp[0].stat)->pushLabel((yyvsp[-2].text).ident());
+                                     (yyval.stat) = new LabelNode((yyvsp[-2].text).ident(), (yyvsp[0].stat)); DBG((yyval.stat),(yylsp[-2]),(yylsp[-1])); }
+#line 2783 "grammar.cpp"
     break;
 
-  case 187:
-#line 595 "grammar.y"
-    { if (automatic()) {
-                                       (yyval.stat) = new ThrowNode((yyvsp[(2) - (3)].node)); DBG((yyval.stat),(yylsp[(1) - (3)]),(yylsp[(1) - (3)]));
-                                     } else {
-				       YYABORT; } ;}
+  case 186: /* ThrowStatement: THROW Expr ';'  */
+#line 598 "grammar.y"
+                                   { (yyval.stat) = new ThrowNode((yyvsp[-1].node)); DBG((yyval.stat),(yylsp[-2]),(yylsp[0])); }
+#line 2789 "grammar.cpp"
     break;
 
-  case 188:
-#line 602 "grammar.y"
-    { (yyval.stat) = new TryNode((yyvsp[(2) - (3)].stat), (yyvsp[(3) - (3)].cnode)); DBG((yyval.stat),(yylsp[(1) - (3)]),(yylsp[(1) - (3)])); ;}
+  case 187: /* ThrowStatement: THROW Expr error  */
+#line 599 "grammar.y"
+                                   { if (automatic(parser, yychar)) {
+                                       (yyval.stat) = new ThrowNode((yyvsp[-1].node)); DBG((yyval.stat),(yylsp[-2]),(yylsp[-2]));
+                                     } else {
+				       YYABORT; } }
+#line 2798 "grammar.cpp"
     break;
 
-  case 189:
-#line 603 "grammar.y"
-    { (yyval.stat) = new TryNode((yyvsp[(2) - (3)].stat), (yyvsp[(3) - (3)].fnode)); DBG((yyval.stat),(yylsp[(1) - (3)]),(yylsp[(1) - (3)])); ;}
+  case 188: /* TryStatement: TRY Block Catch  */
+#line 606 "grammar.y"
+                                   { (yyval.stat) = new TryNode((yyvsp[-1].stat), (yyvsp[0].cnode)); DBG((yyval.stat),(yylsp[-2]),(yylsp[-2])); }
+#line 2804 "grammar.cpp"
     break;
 
-  case 190:
-#line 604 "grammar.y"
-    { (yyval.stat) = new TryNode((yyvsp[(2) - (4)].stat), (yyvsp[(3) - (4)].cnode), (yyvsp[(4) - (4)].fnode)); DBG((yyval.stat),(yylsp[(1) - (4)]),(yylsp[(1) - (4)])); ;}
+  case 189: /* TryStatement: TRY Block Finally  */
+#line 607 "grammar.y"
+                                   { (yyval.stat) = new TryNode((yyvsp[-1].stat), (yyvsp[0].fnode)); DBG((yyval.stat),(yylsp[-2]),(yylsp[-2])); }
+#line 2810 "grammar.cpp"
     break;
 
-  case 191:
+  case 190: /* TryStatement: TRY Block Catch Finally  */
 #line 608 "grammar.y"
-    { (yyval.stat) = new EmptyStatementNode(); DBG((yyval.stat), (yylsp[(1) - (2)]), (yylsp[(2) - (2)])); ;}
+                                   { (yyval.stat) = new TryNode((yyvsp[-2].stat), (yyvsp[-1].cnode), (yyvsp[0].fnode)); DBG((yyval.stat),(yylsp[-3]),(yylsp[-3])); }
+#line 2816 "grammar.cpp"
     break;
 
-  case 192:
-#line 609 "grammar.y"
-    { if (automatic()) {
-                                                (yyval.stat) = new EmptyStatementNode(); 
-                                                DBG((yyval.stat), (yylsp[(1) - (2)]), (yylsp[(1) - (2)])); 
-                                             } else {
-                                                YYABORT; } ;}
+  case 191: /* DebuggerStatement: DEBUGGER ';'  */
+#line 612 "grammar.y"
+                                           { (yyval.stat) = new EmptyStatementNode(); DBG((yyval.stat), (yylsp[-1]), (yylsp[0])); }
+#line 2822 "grammar.cpp"
     break;
 
-  case 193:
-#line 618 "grammar.y"
-    { CatchNode *c; (yyval.cnode) = c = new CatchNode(*(yyvsp[(3) - (5)].ident), (yyvsp[(5) - (5)].stat));
-				     DBG(c,(yylsp[(1) - (5)]),(yylsp[(4) - (5)])); ;}
+  case 192: /* DebuggerStatement: DEBUGGER error  */
+#line 613 "grammar.y"
+                                           { if (automatic(parser, yychar)) {
+                                                (yyval.stat) = new EmptyStatementNode(); 
+                                                DBG((yyval.stat), (yylsp[-1]), (yylsp[-1])); 
+                                             } else {
+                                                YYABORT; } }
+#line 2832 "grammar.cpp"
     break;
 
-  case 194:
-#line 623 "grammar.y"
-    { FinallyNode *f; (yyval.fnode) = f = new FinallyNode((yyvsp[(2) - (2)].stat)); DBG(f,(yylsp[(1) - (2)]),(yylsp[(1) - (2)])); ;}
+  case 193: /* Catch: CATCH '(' IDENT ')' Block  */
+#line 622 "grammar.y"
+                                   { CatchNode *c; (yyval.cnode) = c = new CatchNode((yyvsp[-2].text).ident(), (yyvsp[0].stat));
+				     DBG(c,(yylsp[-4]),(yylsp[-1])); }
+#line 2839 "grammar.cpp"
     break;
 
-  case 196:
-#line 629 "grammar.y"
-    { (yyval.func) = (yyvsp[(2) - (2)].func); ;}
+  case 194: /* Finally: FINALLY Block  */
+#line 627 "grammar.y"
+                                   { FinallyNode *f; (yyval.fnode) = f = new FinallyNode((yyvsp[0].stat)); DBG(f,(yylsp[-1]),(yylsp[-1])); }
+#line 2845 "grammar.cpp"
     break;
 
-  case 197:
+  case 196: /* FunctionDeclaration: VOID FunctionDeclarationInternal  */
 #line 633 "grammar.y"
-    { (yyval.func) = new FuncDeclNode(*(yyvsp[(2) - (5)].ident), (yyvsp[(5) - (5)].body)); DBG((yyval.func),(yylsp[(1) - (5)]),(yylsp[(4) - (5)])); ;}
+                                     { (yyval.func) = (yyvsp[0].func); }
+#line 2851 "grammar.cpp"
     break;
 
-  case 198:
-#line 635 "grammar.y"
-    { (yyval.func) = new FuncDeclNode(*(yyvsp[(2) - (6)].ident), (yyvsp[(4) - (6)].param), (yyvsp[(6) - (6)].body)); DBG((yyval.func),(yylsp[(1) - (6)]),(yylsp[(5) - (6)])); ;}
+  case 197: /* FunctionDeclarationInternal: FUNCTION IDENT '(' ')' FunctionBody  */
+#line 637 "grammar.y"
+                                           { (yyval.func) = new FuncDeclNode((yyvsp[-3].text).ident(), (yyvsp[0].body)); DBG((yyval.func),(yylsp[-4]),(yylsp[-1])); }
+#line 2857 "grammar.cpp"
     break;
 
-  case 199:
+  case 198: /* FunctionDeclarationInternal: FUNCTION IDENT '(' FormalParameterList ')' FunctionBody  */
 #line 639 "grammar.y"
-    { (yyval.node) = new FuncExprNode((yyvsp[(4) - (4)].body)); ;}
+                                   { (yyval.func) = new FuncDeclNode((yyvsp[-4].text).ident(), (yyvsp[-2].param), (yyvsp[0].body)); DBG((yyval.func),(yylsp[-5]),(yylsp[-1])); }
+#line 2863 "grammar.cpp"
     break;
 
-  case 200:
-#line 641 "grammar.y"
-    { (yyval.node) = new FuncExprNode((yyvsp[(3) - (5)].param), (yyvsp[(5) - (5)].body)); ;}
+  case 199: /* FunctionExpr: FUNCTION '(' ')' FunctionBody  */
+#line 643 "grammar.y"
+                                   { (yyval.node) = new FuncExprNode((yyvsp[0].body)); }
+#line 2869 "grammar.cpp"
     break;
 
-  case 201:
-#line 646 "grammar.y"
-    { (yyval.param) = new ParameterNode(*(yyvsp[(1) - (1)].ident)); ;}
+  case 200: /* FunctionExpr: FUNCTION '(' FormalParameterList ')' FunctionBody  */
+#line 645 "grammar.y"
+                                   { (yyval.node) = new FuncExprNode((yyvsp[-2].param), (yyvsp[0].body)); }
+#line 2875 "grammar.cpp"
     break;
 
-  case 202:
-#line 647 "grammar.y"
-    { (yyval.param) = new ParameterNode((yyvsp[(1) - (3)].param), *(yyvsp[(3) - (3)].ident)); ;}
+  case 201: /* FormalParameterList: IDENT  */
+#line 650 "grammar.y"
+                                   { (yyval.param) = new ParameterNode((yyvsp[0].text).ident()); }
+#line 2881 "grammar.cpp"
     break;
 
-  case 203:
+  case 202: /* FormalParameterList: FormalParameterList ',' IDENT  */
 #line 651 "grammar.y"
-    { (yyval.body) = new FunctionBodyNode(0);
-	                             DBG((yyval.body), (yylsp[(1) - (2)]), (yylsp[(2) - (2)]));;}
+                                   { (yyval.param) = new ParameterNode((yyvsp[-2].param), (yyvsp[0].text).ident()); }
+#line 2887 "grammar.cpp"
     break;
 
-  case 204:
-#line 653 "grammar.y"
-    { (yyval.body) = new FunctionBodyNode((yyvsp[(2) - (3)].srcs));
-	                             DBG((yyval.body), (yylsp[(1) - (3)]), (yylsp[(3) - (3)]));;}
+  case 203: /* FunctionBody: '{' '}'  */
+#line 655 "grammar.y"
+                                   { (yyval.body) = new FunctionBodyNode(0);
+	                             DBG((yyval.body), (yylsp[-1]), (yylsp[0]));}
+#line 2894 "grammar.cpp"
     break;
 
-  case 205:
-#line 658 "grammar.y"
-    { (yyval.prog) = new FunctionBodyNode(0);
-                                     (yyval.prog)->setLoc(0, 0, Parser::source);
-                                     Parser::progNode = (yyval.prog); ;}
+  case 204: /* FunctionBody: '{' SourceElements '}'  */
+#line 657 "grammar.y"
+                                   { (yyval.body) = new FunctionBodyNode((yyvsp[-1].srcs));
+	                             DBG((yyval.body), (yylsp[-2]), (yylsp[0]));}
+#line 2901 "grammar.cpp"
     break;
 
-  case 206:
-#line 661 "grammar.y"
-    { (yyval.prog) = new FunctionBodyNode((yyvsp[(1) - (1)].srcs));
-                                     Parser::progNode = (yyval.prog); ;}
+  case 205: /* Program: %empty  */
+#line 662 "grammar.y"
+                                     { (yyval.prog) = new FunctionBodyNode(0);
+                                     (yyval.prog)->setLoc(0, 0, parser->source);
+                                     parser->progNode = (yyval.prog); }
+#line 2909 "grammar.cpp"
     break;
 
-  case 207:
-#line 666 "grammar.y"
-    { (yyval.srcs) = new SourceElementsNode((yyvsp[(1) - (1)].stat)); ;}
+  case 206: /* Program: SourceElements  */
+#line 665 "grammar.y"
+                                     { (yyval.prog) = new FunctionBodyNode((yyvsp[0].srcs));
+                                     parser->progNode = (yyval.prog); }
+#line 2916 "grammar.cpp"
     break;
 
-  case 208:
-#line 667 "grammar.y"
-    { (yyval.srcs) = new SourceElementsNode((yyvsp[(1) - (2)].srcs), (yyvsp[(2) - (2)].stat)); ;}
+  case 207: /* SourceElements: SourceElement  */
+#line 670 "grammar.y"
+                                   { (yyval.srcs) = new SourceElementsNode((yyvsp[0].stat)); }
+#line 2922 "grammar.cpp"
     break;
 
-  case 209:
+  case 208: /* SourceElements: SourceElements SourceElement  */
 #line 671 "grammar.y"
-    { (yyval.stat) = (yyvsp[(1) - (1)].stat); ;}
+                                   { (yyval.srcs) = new SourceElementsNode((yyvsp[-1].srcs), (yyvsp[0].stat)); }
+#line 2928 "grammar.cpp"
+    break;
+
+  case 209: /* SourceElement: Statement  */
+#line 675 "grammar.y"
+                                   { (yyval.stat) = (yyvsp[0].stat); }
+#line 2934 "grammar.cpp"
     break;
 
-  case 210:
-#line 672 "grammar.y"
-    { (yyval.stat) = (yyvsp[(1) - (1)].func); ;}
+  case 210: /* SourceElement: FunctionDeclaration  */
+#line 676 "grammar.y"
+                                   { (yyval.stat) = (yyvsp[0].func); }
+#line 2940 "grammar.cpp"
     break;
 
 
-/* Line 1267 of yacc.c.  */
-#line 3032 "grammar.tab.c"
+#line 2944 "grammar.cpp"
+
       default: break;
     }
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
   *++yylsp = yyloc;
 
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (YY_("syntax error"));
-#else
-      {
-	YYSIZE_T yysize = yysyntax_error (0, yystate, yychar);
-	if (yymsg_alloc < yysize && yymsg_alloc < YYSTACK_ALLOC_MAXIMUM)
-	  {
-	    YYSIZE_T yyalloc = 2 * yysize;
-	    if (! (yysize <= yyalloc && yyalloc <= YYSTACK_ALLOC_MAXIMUM))
-	      yyalloc = YYSTACK_ALLOC_MAXIMUM;
-	    if (yymsg != yymsgbuf)
-	      YYSTACK_FREE (yymsg);
-	    yymsg = (char *) YYSTACK_ALLOC (yyalloc);
-	    if (yymsg)
-	      yymsg_alloc = yyalloc;
-	    else
-	      {
-		yymsg = yymsgbuf;
-		yymsg_alloc = sizeof yymsgbuf;
-	      }
-	  }
-
-	if (0 < yysize && yysize <= yymsg_alloc)
-	  {
-	    (void) yysyntax_error (yymsg, yystate, yychar);
-	    yyerror (yymsg);
-	  }
-	else
-	  {
-	    yyerror (YY_("syntax error"));
-	    if (yysize != 0)
-	      goto yyexhaustedlab;
-	  }
-      }
-#endif
+      yyerror (&yylloc, parser, YY_("syntax error"));
     }
 
-  yyerror_range[0] = yylloc;
-
+  yyerror_range[1] = yylloc;
   if (yyerrstatus == 3)
     {
-      /* If just tried and failed to reuse look-ahead token after an
-	 error, discard it.  */
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
 
       if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval, &yylloc);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, &yylloc, parser);
+          yychar = YYEMPTY;
+        }
     }
 
-  /* Else will try to reuse look-ahead token after shifting the error
+  /* Else will try to reuse lookahead token after shifting the error
      token.  */
   goto yyerrlab1;
 
@@ -3130,15 +3020,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  yyerror_range[0] = yylsp[1-yylen];
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -3151,47 +3039,45 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
-      if (yyn != YYPACT_NINF)
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
-      yyerror_range[0] = *yylsp;
+      yyerror_range[1] = *yylsp;
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp, yylsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp, parser);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
-  yyerror_range[1] = yylloc;
-  /* Using YYLLOC is tempting, but would change the location of
-     the look-ahead.  YYLOC is available though.  */
-  YYLLOC_DEFAULT (yyloc, (yyerror_range - 1), 2);
-  *++yylsp = yyloc;
+  yyerror_range[2] = yylloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -3202,71 +3088,75 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#ifndef yyoverflow
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
-  yyerror (YY_("memory exhausted"));
+  yyerror (&yylloc, parser, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
+
 
-yyreturn:
-  if (yychar != YYEOF && yychar != YYEMPTY)
-     yydestruct ("Cleanup: discarding lookahead",
-		 yytoken, &yylval, &yylloc);
-  /* Do not reclaim the symbols of the rule which action triggered
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, &yylloc, parser);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp, yylsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp, parser);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+
   return yyresult;
 }
 
-
-#line 675 "grammar.y"
+#line 679 "grammar.y"
 
 
-int yyerror (const char * /* s */)  /* Called by yyparse on error */
+int yyerror(void * /* llocp */, Parser * /* parser */, const char * /* s */)  /* Called by yyparse on error */
 {
   //  fprintf(stderr, "ERROR: %s at line %d\n",
-  //	  s, KJS::Lexer::curr()->lineNo());
+  //	  s, parser->lexer->lineNo());
   return 1;
 }
 
 /* may we automatically insert a semicolon ? */
-bool automatic()
+bool automatic(Parser *parser, int yychar)
 {
-  if (Lexer::curr()->hadError())
+  if (parser->lexer->hadError())
     return false;
   if (yychar == '}' || yychar == 0)
     return true;
-  else if (Lexer::curr()->prevTerminator())
+  else if (parser->lexer->prevTerminator())
     return true;
 
   return false;
 }
-
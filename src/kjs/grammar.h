@@ -1,14 +1,14 @@
-/* A Bison parser, made by GNU Bison 2.2.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* Skeleton interface for Bison's Yacc-like parsers in C
+/* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003, 2004, 2005, 2006
-   Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
-   This program is free software; you can redistribute it and/or modify
+   This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
 
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
@@ -16,9 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 51 Franklin Street, Fifth Floor,
-   Boston, MA 02110-1301, USA.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,147 +31,102 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
-/* Tokens.  */
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_KJSYY_GRAMMAR_H_INCLUDED
+# define YY_KJSYY_GRAMMAR_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int kjsyydebug;
+#endif
+
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     NULLTOKEN = 258,
-     TRUETOKEN = 259,
-     FALSETOKEN = 260,
-     STRING = 261,
-     NUMBER = 262,
-     BREAK = 263,
-     CASE = 264,
-     DEFAULT = 265,
-     FOR = 266,
-     NEW = 267,
-     VAR = 268,
-     CONST = 269,
-     CONTINUE = 270,
-     FUNCTION = 271,
-     RETURN = 272,
-     VOID = 273,
-     DELETE = 274,
-     IF = 275,
-     THIS = 276,
-     DO = 277,
-     WHILE = 278,
-     ELSE = 279,
-     IN = 280,
-     INSTANCEOF = 281,
-     TYPEOF = 282,
-     SWITCH = 283,
-     WITH = 284,
-     RESERVED = 285,
-     THROW = 286,
-     TRY = 287,
-     CATCH = 288,
-     FINALLY = 289,
-     DEBUGGER = 290,
-     EQEQ = 291,
-     NE = 292,
-     STREQ = 293,
-     STRNEQ = 294,
-     LE = 295,
-     GE = 296,
-     OR = 297,
-     AND = 298,
-     PLUSPLUS = 299,
-     MINUSMINUS = 300,
-     LSHIFT = 301,
-     RSHIFT = 302,
-     URSHIFT = 303,
-     PLUSEQUAL = 304,
-     MINUSEQUAL = 305,
-     MULTEQUAL = 306,
-     DIVEQUAL = 307,
-     LSHIFTEQUAL = 308,
-     RSHIFTEQUAL = 309,
-     URSHIFTEQUAL = 310,
-     ANDEQUAL = 311,
-     MODEQUAL = 312,
-     XOREQUAL = 313,
-     OREQUAL = 314,
-     IDENT = 315,
-     AUTOPLUSPLUS = 316,
-     AUTOMINUSMINUS = 317
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    NULLTOKEN = 258,               /* NULLTOKEN  */
+    TRUETOKEN = 259,               /* TRUETOKEN  */
+    FALSETOKEN = 260,              /* FALSETOKEN  */
+    STRING = 261,                  /* STRING  */
+    NUMBER = 262,                  /* NUMBER  */
+    BREAK = 263,                   /* BREAK  */
+    CASE = 264,                    /* CASE  */
+    DEFAULT = 265,                 /* DEFAULT  */
+    FOR = 266,                     /* FOR  */
+    NEW = 267,                     /* NEW  */
+    VAR = 268,                     /* VAR  */
+    CONST = 269,                   /* CONST  */
+    CONTINUE = 270,                /* CONTINUE  */
+    FUNCTION = 271,                /* FUNCTION  */
+    RETURN = 272,                  /* RETURN  */
+    VOID = 273,                    /* VOID  */
+    DELETE = 274,                  /* DELETE  */
+    IF = 275,                      /* IF  */
+    THIS = 276,                    /* THIS  */
+    DO = 277,                      /* DO  */
+    WHILE = 278,                   /* WHILE  */
+    ELSE = 279,                    /* ELSE  */
+    IN = 280,                      /* IN  */
+    INSTANCEOF = 281,              /* INSTANCEOF  */
+    TYPEOF = 282,                  /* TYPEOF  */
+    SWITCH = 283,                  /* SWITCH  */
+    WITH = 284,                    /* WITH  */
+    RESERVED = 285,                /* RESERVED  */
+    THROW = 286,                   /* THROW  */
+    TRY = 287,                     /* TRY  */
+    CATCH = 288,                   /* CATCH  */
+    FINALLY = 289,                 /* FINALLY  */
+    DEBUGGER = 290,                /* DEBUGGER  */
+    EQEQ = 291,                    /* EQEQ  */
+    NE = 292,                      /* NE  */
+    STREQ = 293,                   /* STREQ  */
+    STRNEQ = 294,                  /* STRNEQ  */
+    LE = 295,                      /* LE  */
+    GE = 296,                      /* GE  */
+    OR = 297,                      /* OR  */
+    AND = 298,                     /* AND  */
+    PLUSPLUS = 299,                /* PLUSPLUS  */
+    MINUSMINUS = 300,              /* MINUSMINUS  */
+    LSHIFT = 301,                  /* LSHIFT  */
+    RSHIFT = 302,                  /* RSHIFT  */
+    URSHIFT = 303,                 /* URSHIFT  */
+    PLUSEQUAL = 304,               /* PLUSEQUAL  */
+    MINUSEQUAL = 305,              /* MINUSEQUAL  */
+    MULTEQUAL = 306,               /* MULTEQUAL  */
+    DIVEQUAL = 307,                /* DIVEQUAL  */
+    LSHIFTEQUAL = 308,             /* LSHIFTEQUAL  */
+    RSHIFTEQUAL = 309,             /* RSHIFTEQUAL  */
+    URSHIFTEQUAL = 310,            /* URSHIFTEQUAL  */
+    ANDEQUAL = 311,                /* ANDEQUAL  */
+    MODEQUAL = 312,                /* MODEQUAL  */
+    XOREQUAL = 313,                /* XOREQUAL  */
+    OREQUAL = 314,                 /* OREQUAL  */
+    IDENT = 315,                   /* IDENT  */
+    AUTOPLUSPLUS = 316,            /* AUTOPLUSPLUS  */
+    AUTOMINUSMINUS = 317           /* AUTOMINUSMINUS  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
-#define NULLTOKEN 258
-#define TRUETOKEN 259
-#define FALSETOKEN 260
-#define STRING 261
-#define NUMBER 262
-#define BREAK 263
-#define CASE 264
-#define DEFAULT 265
-#define FOR 266
-#define NEW 267
-#define VAR 268
-#define CONST 269
-#define CONTINUE 270
-#define FUNCTION 271
-#define RETURN 272
-#define VOID 273
-#define DELETE 274
-#define IF 275
-#define THIS 276
-#define DO 277
-#define WHILE 278
-#define ELSE 279
-#define IN 280
-#define INSTANCEOF 281
-#define TYPEOF 282
-#define SWITCH 283
-#define WITH 284
-#define RESERVED 285
-#define THROW 286
-#define TRY 287
-#define CATCH 288
-#define FINALLY 289
-#define DEBUGGER 290
-#define EQEQ 291
-#define NE 292
-#define STREQ 293
-#define STRNEQ 294
-#define LE 295
-#define GE 296
-#define OR 297
-#define AND 298
-#define PLUSPLUS 299
-#define MINUSMINUS 300
-#define LSHIFT 301
-#define RSHIFT 302
-#define URSHIFT 303
-#define PLUSEQUAL 304
-#define MINUSEQUAL 305
-#define MULTEQUAL 306
-#define DIVEQUAL 307
-#define LSHIFTEQUAL 308
-#define RSHIFTEQUAL 309
-#define URSHIFTEQUAL 310
-#define ANDEQUAL 311
-#define MODEQUAL 312
-#define XOREQUAL 313
-#define OREQUAL 314
-#define IDENT 315
-#define AUTOPLUSPLUS 316
-#define AUTOMINUSMINUS 317
-
-
-
 
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
-#line 52 "grammar.y"
+union YYSTYPE
 {
+#line 57 "grammar.y"
+
   int                 ival;
   double              dval;
-  UString             *ustr;
-  Identifier          *ident;
+  TokenText           text;
   Node                *node;
   StatementNode       *stat;
   ParameterNode       *param;
@@ -196,28 +149,33 @@ typedef union YYSTYPE
   PropertyNode        *pnode;
   CatchNode           *cnode;
   FinallyNode         *fnode;
-}
-/* Line 1528 of yacc.c.  */
-#line 202 "grammar.tab.h"
-	YYSTYPE;
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
+
+#line 154 "grammar.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
 #endif
 
-extern YYSTYPE kjsyylval;
-
+/* Location type.  */
 #if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
-typedef struct YYLTYPE
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
 {
   int first_line;
   int first_column;
   int last_line;
   int last_column;
-} YYLTYPE;
-# define yyltype YYLTYPE /* obsolescent; will be withdrawn */
+};
 # define YYLTYPE_IS_DECLARED 1
 # define YYLTYPE_IS_TRIVIAL 1
 #endif
 
-extern YYLTYPE kjsyylloc;
+
+
+
+int kjsyyparse (KJS::Parser *parser);
+
+
+#endif /* !YY_KJSYY_GRAMMAR_H_INCLUDED  */
@@ -39,21 +39,25 @@
 #undef YYMAXDEPTH
 #endif
 #define YYERROR_VERBOSE
-#define DBG(l, s, e) { l->setLoc(s.first_line, e.last_line, Parser::source); } // location
-
-extern int yylex();
-static int yyerror (const char *);
-static bool automatic();
+#define DBG(l, s, e) { l->setLoc(s.first_line, e.last_line, parser->source); } // location
 
 using namespace KJS;
 
+extern int yylex(void *lvalp, void *llocp, Parser *parser);
+static int yyerror(void *llocp, Parser *parser, const char *);
+static bool automatic(Parser *parser, int yychar);
+
 %}
 
+/* reentrant parser, all state lives in Parser object of current parse */
+%define api.pure
+%parse-param { KJS::Parser *parser }
+%lex-param { KJS::Parser *parser }
+
 %union {
   int                 ival;
   double              dval;
-  UString             *ustr;
-  Identifier          *ident;
+  TokenText           text;
   Node                *node;
   StatementNode       *stat;
   ParameterNode       *param;
@@ -113,8 +117,8 @@ using namespace KJS;
 
 /* terminal types */
 %token <dval> NUMBER
-%token <ustr> STRING
-%token <ident> IDENT
+%token <text> STRING
+%token <text> IDENT
 
 /* automatically inserted semicolon */
 %token AUTOPLUSPLUS AUTOMINUSMINUS
@@ -170,19 +174,19 @@ Literal:
   | TRUETOKEN                      { $$ = new BooleanNode(true); }
   | FALSETOKEN                     { $$ = new BooleanNode(false); }
   | NUMBER                         { $$ = new NumberNode($1); }
-  | STRING                         { $$ = new StringNode($1); }
-  | '/'       /* a RegExp ? */     { Lexer *l = Lexer::curr();
+  | STRING                         { $$ = new StringNode($1.ustring()); }
+  | '/'       /* a RegExp ? */     { Lexer *l = parser->lexer;
                                      if (!l->scanRegExp()) YYABORT;
                                      $$ = new RegExpNode(l->pattern,l->flags);}
   | DIVEQUAL /* a RegExp starting with /= ! */
-                                   { Lexer *l = Lexer::curr();
+                                   { Lexer *l = parser->lexer;
                                      if (!l->scanRegExp()) YYABORT;
                                      $$ = new RegExpNode(UString('=')+l->pattern,l->flags);}
 ;
 
 PrimaryExpr:
     THIS                           { $$ = new ThisNode(); }
-  | IDENT                          { $$ = new ResolveNode(*$1); }
+  | IDENT                          { $$ = new ResolveNode($1.ident()); }
   | Literal
   | ArrayLiteral
   | '(' Expr ')'                   { $$ = new GroupNode($2); }
@@ -220,8 +224,8 @@ PropertyNameAndValueList:
 ;
 
 PropertyName:
-    IDENT                          { $$ = new PropertyNode(*$1); }
-  | STRING                         { $$ = new PropertyNode(Identifier(*$1)); }
+    IDENT                          { $$ = new PropertyNode($1.ident()); }
+  | STRING                         { $$ = new PropertyNode($1.ident()); }
   | NUMBER                         { $$ = new PropertyNode($1); }
 ;
 
@@ -229,7 +233,7 @@ MemberExpr:
     PrimaryExpr
   | FunctionExpr
   | MemberExpr '[' Expr ']'        { $$ = new AccessorNode1($1, $3); }
-  | MemberExpr '.' IDENT           { $$ = new AccessorNode2($1, *$3); }
+  | MemberExpr '.' IDENT           { $$ = new AccessorNode2($1, $3.ident()); }
   | NEW MemberExpr Arguments       { $$ = new NewExprNode($2, $3); }
 ;
 
@@ -242,7 +246,7 @@ CallExpr:
     MemberExpr Arguments           { $$ = new FunctionCallNode($1, $2); }
   | CallExpr Arguments             { $$ = new FunctionCallNode($1, $2); }
   | CallExpr '[' Expr ']'          { $$ = new AccessorNode1($1, $3); }
-  | CallExpr '.' IDENT             { $$ = new AccessorNode2($1, *$3); }
+  | CallExpr '.' IDENT             { $$ = new AccessorNode2($1, $3.ident()); }
 ;
 
 Arguments:
@@ -416,7 +420,7 @@ StatementList:
 VariableStatement:
     VAR VariableDeclarationList ';' { $$ = new VarStatementNode($2);
                                       DBG($$, @1, @3); }
-  | VAR VariableDeclarationList error { if (automatic()) {
+  | VAR VariableDeclarationList error { if (automatic(parser, yychar)) {
                                           $$ = new VarStatementNode($2);
 					  DBG($$, @1, @2);
                                         } else {
@@ -432,14 +436,14 @@ VariableDeclarationList:
 ;
 
 VariableDeclaration:
-    IDENT                          { $$ = new VarDeclNode(*$1, 0, VarDeclNode::Variable); }
-  | IDENT Initializer              { $$ = new VarDeclNode(*$1, $2, VarDeclNode::Variable); }
+    IDENT                          { $$ = new VarDeclNode($1.ident(), 0, VarDeclNode::Variable); }
+  | IDENT Initializer              { $$ = new VarDeclNode($1.ident(), $2, VarDeclNode::Variable); }
 ;
 
 ConstStatement:
     CONST ConstDeclarationList ';' { $$ = new VarStatementNode($2);
                                       DBG($$, @1, @3); }
-  | CONST ConstDeclarationList error { if (automatic()) {
+  | CONST ConstDeclarationList error { if (automatic(parser, yychar)) {
                                           $$ = new VarStatementNode($2);
 					  DBG($$, @1, @2);
                                         } else {
@@ -455,8 +459,8 @@ ConstDeclarationList:
 ;
 
 ConstDeclaration:
-    IDENT                          { $$ = new VarDeclNode(*$1, 0, VarDeclNode::Constant); }
-  | IDENT Initializer              { $$ = new VarDeclNode(*$1, $2, VarDeclNode::Constant); }
+    IDENT                          { $$ = new VarDeclNode($1.ident(), 0, VarDeclNode::Constant); }
+  | IDENT Initializer              { $$ = new VarDeclNode($1.ident(), $2, VarDeclNode::Constant); }
 ;
 
 Initializer:
@@ -470,7 +474,7 @@ EmptyStatement:
 ExprStatement:
     Expr ';'                       { $$ = new ExprStatementNode($1);
                                      DBG($$, @1, @2); }
-  | Expr error                     { if (automatic()) {
+  | Expr error                     { if (automatic(parser, yychar)) {
                                        $$ = new ExprStatementNode($1);
 				       DBG($$, @1, @1);
                                      } else
@@ -496,10 +500,10 @@ IterationStatement:
             Statement              { $$ = new ForInNode($3, $5, $7);
 	                             DBG($$,@1,@6); }
   | FOR '(' VAR IDENT IN Expr ')'
-            Statement              { $$ = new ForInNode(*$4,0,$6,$8);
+            Statement              { $$ = new ForInNode($4.ident(),0,$6,$8);
 	                             DBG($$,@1,@7); }
   | FOR '(' VAR IDENT Initializer IN Expr ')'
-            Statement              { $$ = new ForInNode(*$4,$5,$7,$9);
+            Statement              { $$ = new ForInNode($4.ident(),$5,$7,$9);
 	                             DBG($$,@1,@8); }
 ;
 
@@ -510,26 +514,26 @@ ExprOpt:
 
 ContinueStatement:
     CONTINUE ';'                   { $$ = new ContinueNode(); DBG($$,@1,@2); }
-  | CONTINUE error                 { if (automatic()) {
+  | CONTINUE error                 { if (automatic(parser, yychar)) {
                                        $$ = new ContinueNode(); DBG($$,@1,@2);
                                      } else
 				       YYABORT; }
-  | CONTINUE IDENT ';'             { $$ = new ContinueNode(*$2); DBG($$,@1,@3); }
-  | CONTINUE IDENT error           { if (automatic()) {
-                                       $$ = new ContinueNode(*$2);DBG($$,@1,@2);
+  | CONTINUE IDENT ';'             { $$ = new ContinueNode($2.ident()); DBG($$,@1,@3); }
+  | CONTINUE IDENT error           { if (automatic(parser, yychar)) {
+                                       $$ = new ContinueNode($2.ident());DBG($$,@1,@2);
                                      } else
 				       YYABORT; }
 ;
 
 BreakStatement:
     BREAK ';'                      { $$ = new BreakNode();DBG($$,@1,@2); }
-  | BREAK error                    { if (automatic()) {
+  | BREAK error                    { if (automatic(parser, yychar)) {
                                        $$ = new BreakNode(); DBG($$,@1,@1);
                                      } else
 				       YYABORT; }
-  | BREAK IDENT ';'                { $$ = new BreakNode(*$2); DBG($$,@1,@3); }
-  | BREAK IDENT error              { if (automatic()) {
-                                       $$ = new BreakNode(*$2); DBG($$,@1,@2);
+  | BREAK IDENT ';'                { $$ = new BreakNode($2.ident()); DBG($$,@1,@3); }
+  | BREAK IDENT error              { if (automatic(parser, yychar)) {
+                                       $$ = new BreakNode($2.ident()); DBG($$,@1,@2);
                                      } else
 				       YYABORT;
                                    }
@@ -537,12 +541,12 @@ BreakStatement:
 
 ReturnStatement:
     RETURN ';'                     { $$ = new ReturnNode(0); DBG($$,@1,@2); }
-  | RETURN error                   { if (automatic()) {
+  | RETURN error                   { if (automatic(parser, yychar)) {
                                        $$ = new ReturnNode(0); DBG($$,@1,@1);
                                      } else
 				       YYABORT; }
   | RETURN Expr ';'                { $$ = new ReturnNode($2); DBG($$,@1,@3); }
-  | RETURN Expr error              { if (automatic()) {
+  | RETURN Expr error              { if (automatic(parser, yychar)) {
                                        $$ = new ReturnNode($2); DBG($$,@1,@1);
                                      }
                                      else
@@ -586,13 +590,13 @@ DefaultClause:
 ;
 
 LabelledStatement:
-    IDENT ':' Statement            { $3->pushLabel(*$1);
-                                     $$ = new LabelNode(*$1, $3); DBG($$,@1,@2); }
+    IDENT ':' Statement            { $3->pushLabel($1.ident());
+                                     $$ = new LabelNode($1.ident(), $3); DBG($$,@1,@2); }
 ;
 
 ThrowStatement:
     THROW Expr ';'                 { $$ = new ThrowNode($2); DBG($$,@1,@3); }
-  | THROW Expr error               { if (automatic()) {
+  | THROW Expr error               { if (automatic(parser, yychar)) {
                                        $$ = new ThrowNode($2); DBG($$,@1,@1);
                                      } else {
 				       YYABORT; } }
@@ -606,7 +610,7 @@ TryStatement:
 
 DebuggerStatement:
     DEBUGGER ';'                           { $$ = new EmptyStatementNode(); DBG($$, @1, @2); }
-  | DEBUGGER error                         { if (automatic()) {
+  | DEBUGGER error                         { if (automatic(parser, yychar)) {
                                                 $$ = new EmptyStatementNode(); 
                                                 DBG($$, @1, @1); 
                                              } else {
@@ -615,7 +619,7 @@ DebuggerStatement:
 
 
 Catch:
-    CATCH '(' IDENT ')' Block      { CatchNode *c; $$ = c = new CatchNode(*$3, $5);
+    CATCH '(' IDENT ')' Block      { CatchNode *c; $$ = c = new CatchNode($3.ident(), $5);
 				     DBG(c,@1,@4); }
 ;
 
@@ -630,9 +634,9 @@ FunctionDeclaration:
 ;
 
 FunctionDeclarationInternal:
-    FUNCTION IDENT '(' ')' FunctionBody    { $$ = new FuncDeclNode(*$2, $5); DBG($$,@1,@4); }
+    FUNCTION IDENT '(' ')' FunctionBody    { $$ = new FuncDeclNode($2.ident(), $5); DBG($$,@1,@4); }
   | FUNCTION IDENT '(' FormalParameterList ')' FunctionBody
-                                   { $$ = new FuncDeclNode(*$2, $4, $6); DBG($$,@1,@5); }
+                                   { $$ = new FuncDeclNode($2.ident(), $4, $6); DBG($$,@1,@5); }
 ;
 
 FunctionExpr:
@@ -643,8 +647,8 @@ FunctionExpr:
 ;
 
 FormalParameterList:
-    IDENT                          { $$ = new ParameterNode(*$1); }
-  | FormalParameterList ',' IDENT  { $$ = new ParameterNode($1, *$3); }
+    IDENT                          { $$ = new ParameterNode($1.ident()); }
+  | FormalParameterList ',' IDENT  { $$ = new ParameterNode($1, $3.ident()); }
 ;
 
 FunctionBody:
@@ -656,10 +660,10 @@ FunctionBody:
 
 Program:
     /* nothing, empty script */      { $$ = new FunctionBodyNode(0);
-                                     $$->setLoc(0, 0, Parser::source);
-                                     Parser::progNode = $$; }
+                                     $$->setLoc(0, 0, parser->source);
+                                     parser->progNode = $$; }
     | SourceElements                 { $$ = new FunctionBodyNode($1);
-                                     Parser::progNode = $$; }
+                                     parser->progNode = $$; }
 ;
 
 SourceElements:
@@ -674,21 +678,21 @@ SourceElement:
 
 %%
 
-int yyerror (const char * /* s */)  /* Called by yyparse on error */
+int yyerror(void * /* llocp */, Parser * /* parser */, const char * /* s */)  /* Called by yyparse on error */
 {
   //  fprintf(stderr, "ERROR: %s at line %d\n",
-  //	  s, KJS::Lexer::curr()->lineNo());
+  //	  s, parser->lexer->lineNo());
   return 1;
 }
 
 /* may we automatically insert a semicolon ? */
-bool automatic()
+bool automatic(Parser *parser, int yychar)
 {
-  if (Lexer::curr()->hadError())
+  if (parser->lexer->hadError())
     return false;
   if (yychar == '}' || yychar == 0)
     return true;
-  else if (Lexer::curr()->prevTerminator())
+  else if (parser->lexer->prevTerminator())
     return true;
 
   return false;
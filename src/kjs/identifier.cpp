@@ -24,6 +24,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <assert.h>
+#include <pthread.h>
 
 #define DUMP_STATISTICS 0
 
@@ -47,24 +49,33 @@ IdentifierStatisticsExitLogger::~IdentifierStatisticsExitLogger()
 
 #endif
 
-extern const Identifier argumentsPropertyName("arguments");
-extern const Identifier calleePropertyName("callee");
-extern const Identifier constructorPropertyName("constructor");
-extern const Identifier lengthPropertyName("length");
-extern const Identifier messagePropertyName("message");
-extern const Identifier namePropertyName("name");
-extern const Identifier prototypePropertyName("prototype");
-extern const Identifier specialPrototypePropertyName("__proto__");
-extern const Identifier toLocaleStringPropertyName("toLocaleString");
-extern const Identifier toStringPropertyName("toString");
-extern const Identifier valueOfPropertyName("valueOf");
+extern const Identifier argumentsPropertyName(Identifier::shared("arguments"));
+extern const Identifier calleePropertyName(Identifier::shared("callee"));
+extern const Identifier constructorPropertyName(Identifier::shared("constructor"));
+extern const Identifier lengthPropertyName(Identifier::shared("length"));
+extern const Identifier messagePropertyName(Identifier::shared("message"));
+extern const Identifier namePropertyName(Identifier::shared("name"));
+extern const Identifier prototypePropertyName(Identifier::shared("prototype"));
+extern const Identifier specialPrototypePropertyName(Identifier::shared("__proto__"));
+extern const Identifier toLocaleStringPropertyName(Identifier::shared("toLocaleString"));
+extern const Identifier toStringPropertyName(Identifier::shared("toString"));
+extern const Identifier valueOfPropertyName(Identifier::shared("valueOf"));
 
 static const int _minTableSize = 64;
 
-UString::Rep **Identifier::_table;
-int Identifier::_tableSize;
-int Identifier::_tableSizeMask;
-int Identifier::_keyCount;
+// identifiers shared by all threads, see Identifier::shared()
+static const int _maxSharedCount = 16;
+UString::Rep *Identifier::_shared[_maxSharedCount];
+int Identifier::_sharedCount;
+
+// frees the table of exiting thread
+static pthread_key_t _tableKey;
+static pthread_once_t _tableKeyOnce = PTHREAD_ONCE_INIT;
+
+__thread UString::Rep **Identifier::_table;
+__thread int Identifier::_tableSize;
+__thread int Identifier::_tableSizeMask;
+__thread int Identifier::_keyCount;
 
 bool Identifier::equal(UString::Rep *r, const char *s)
 {
@@ -236,6 +247,11 @@ inline void Identifier::insert(UString::Rep *key)
 
 void Identifier::remove(UString::Rep *r)
 {
+    // identifier may come from table of another thread, so look for
+    // the rep itself not for equal string
+    if (!_table)
+        return;
+
     unsigned hash = r->hash();
 
     UString::Rep *key;
@@ -246,7 +262,7 @@ void Identifier::remove(UString::Rep *r)
     numCollisions += _table[i] && equal(_table[i], r);
 #endif
     while ((key = _table[i])) {
-        if (equal(key, r))
+        if (key == r)
             break;
         i = (i + 1) & _tableSizeMask;
     }
@@ -272,6 +288,47 @@ void Identifier::remove(UString::Rep *r)
     }
 }
 
+Identifier Identifier::shared(const char *c)
+{
+    int length = strlen(c);
+    UChar *d = new UChar[length];
+    for (int j = 0; j != length; j++)
+        d[j] = c[j];
+
+    UString::Rep *r = new UString::Rep;
+    r->dat = d;
+    r->len = length;
+    r->capacity = UString::Rep::capacityForIdentifier;
+    r->rc = UString::Rep::immortal;
+    r->_hash = UString::Rep::computeHash(c);
+
+    assert(_sharedCount < _maxSharedCount);
+    _shared[_sharedCount++] = r;
+
+    // tables created later get it in rehash()
+    if (_table) {
+        insert(r);
+        ++_keyCount;
+        if (_keyCount * 2 >= _tableSize)
+            expand();
+    }
+    return Identifier(r);
+}
+
+void Identifier::createTableKey()
+{
+    pthread_key_create(&_tableKey, freeTable);
+}
+
+void Identifier::freeTable(void *)
+{
+    free(_table);
+    _table = 0;
+    _tableSize = 0;
+    _tableSizeMask = 0;
+    _keyCount = 0;
+}
+
 void Identifier::expand()
 {
     rehash(_tableSize == 0 ? _minTableSize : _tableSize * 2);
@@ -295,6 +352,16 @@ void Identifier::rehash(int newTableSize)
         if (UString::Rep *key = oldTable[i])
             insert(key);
 
+    // first table of this thread, add the shared identifiers and free the
+    // table when the thread exits
+    if (!oldTable) {
+        for (int i = 0; i != _sharedCount; ++i)
+            insert(_shared[i]);
+        _keyCount = _sharedCount;
+        pthread_once(&_tableKeyOnce, createTableKey);
+        pthread_setspecific(_tableKey, _table);
+    }
+
     free(oldTable);
 }
 
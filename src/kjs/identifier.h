@@ -68,6 +68,17 @@ namespace KJS {
 
         static Identifier from(unsigned y) { return Identifier(UString::from(y)); }
 
+	/**
+	* Returns the interned representation of the identifier. Equal
+	* identifiers have equal keys, so it may be used as hash table key.
+	*/
+        const void *key() const { return _ustring.rep; }
+
+	/**
+	* Returns hash of the identifier (computed when it was interned).
+	*/
+        unsigned hash() const { return _ustring.rep->hash(); }
+
 	/**
 	* Returns the identfiers state of being unset.
 	*/
@@ -88,6 +99,13 @@ namespace KJS {
 	*/
         static const Identifier &null();
 
+	/**
+	* Creates an identifier shared by all threads. It is put to the table
+	* of every thread and it is never counted nor freed. It has to be
+	* created before other threads start, i.e. as static data.
+	*/
+        static Identifier shared(const char *s);
+
         friend bool operator==(const Identifier &, const Identifier &);
         friend bool operator!=(const Identifier &, const Identifier &);
 
@@ -96,6 +114,8 @@ namespace KJS {
         static void remove(UString::Rep *);
 
     private:
+        Identifier(UString::Rep *r) : _ustring(r) { }
+
         UString _ustring;
 
         static bool equal(UString::Rep *, const char *);
@@ -116,12 +136,21 @@ namespace KJS {
         static void rehash(int newTableSize);
         static void expand();
         static void shrink();
+        static void createTableKey();
+        static void freeTable(void *);
 
 	// TODO: move into .cpp file
-        static UString::Rep **_table;
-        static int _tableSize;
-        static int _tableSizeMask;
-        static int _keyCount;
+	// every thread has its own table, identifiers must not be shared
+	// between threads (but the shared() ones), the table is freed when
+	// its thread exits
+        static __thread UString::Rep **_table;
+        static __thread int _tableSize;
+        static __thread int _tableSizeMask;
+        static __thread int _keyCount;
+
+        // identifiers created by shared()
+        static UString::Rep *_shared[];
+        static int _sharedCount;
     };
 
     inline bool operator==(const Identifier &a, const Identifier &b)
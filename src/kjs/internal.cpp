@@ -47,7 +47,7 @@
 
 #define I18N_NOOP(s) s
 
-extern int kjsyyparse();
+extern int kjsyyparse(KJS::Parser *parser);
 
 using namespace KJS;
 
@@ -464,47 +464,57 @@ void SourceCode::cleanup()
 
 // ------------------------------ Parser ---------------------------------------
 
-FunctionBodyNode *Parser::progNode = 0;
 int Parser::sid = 0;
-SourceCode *Parser::source = 0;
+
+FunctionBodyNode *Parser::parse(const UString &code, SourceCode **src,
+                                int *errLine, UString *errMsg)
+{
+  UString padded = Lexer::padded(code);
+  return parse(padded.data(), padded.size(), src, errLine, 0, errMsg);
+}
 
 FunctionBodyNode *Parser::parse(const UChar *code, unsigned int length, SourceCode **src,
-				int *errLine, int *errChar, UString *errMsg)
+				int *errLine, int *errChar, UString *errMsg,
+				int *errColumn, Arena *nodes)
 {
   if (errLine)
     *errLine = -1;
   if (errChar)
       *errChar = -1;
+  if (errColumn)
+    *errColumn = -1;
   if (errMsg)
     *errMsg = 0;
 
-  Lexer::curr()->setCode(code, length);
-  progNode = 0;
-  sid++;
+  // every parse has its own lexer and parser state
+  Lexer lexer;
+  lexer.setCode(code, length);
+  lexer.setNodeArena(nodes);
 
-  source = new SourceCode(sid);
+  SourceCode *source = new SourceCode(__sync_add_and_fetch(&sid, 1));
   source->ref();
   *src = source;
 
+  Parser parser(&lexer, source);
+
   // Enable this (and the #define YYDEBUG in grammar.y) to debug a parse error
   //extern int kjsyydebug;
   //kjsyydebug=1;
-  int parseError = kjsyyparse();
-  if (Lexer::curr()->hadError())
+  int parseError = kjsyyparse(&parser);
+  if (lexer.hadError())
     parseError = 1;
-  Lexer::curr()->doneParsing();
-  FunctionBodyNode *prog = progNode;
-  progNode = 0;
-  //sid = -1;
-  source = 0;
+  lexer.doneParsing();
+  FunctionBodyNode *prog = parser.progNode;
 
   if (parseError) {
-    int eline = Lexer::curr()->lineNo() - 1;
-    int echar = Lexer::curr()->charNo();
+    int eline = lexer.lineNo() - 1;
+    int echar = lexer.charNo();
     if (errLine)
       *errLine = eline;
     if (errChar)
         *errChar = echar;
+    if (errColumn)
+      *errColumn = lexer.lineIndex().column(echar);
     if (errMsg)
       *errMsg = "Parse error at line " + UString::from(eline)
           + " and char " + UString::from(echar);
@@ -514,7 +524,8 @@ FunctionBodyNode *Parser::parse(const UChar *code, unsigned int length, SourceCo
 #ifndef NDEBUG
     fprintf(stderr, "KJS: JavaScript parse error at line %d.\n", eline);
 #endif
-    delete prog;
+    if (!nodes)
+      delete prog;
     return 0;
   }
 #ifdef KJS_VERBOSE
@@ -802,7 +813,7 @@ bool InterpreterImp::checkSyntax(const UString &code, int *errLine, UString *err
 {
   // Parser::parse() returns 0 in a syntax error occurs, so we just check for that
   SourceCode *source;
-  FunctionBodyNode *progNode = Parser::parse(code.data(),code.size(),&source,errLine,errMsg);
+  FunctionBodyNode *progNode = Parser::parse(code,&source,errLine,errMsg);
   source->deref();
   bool ok = (progNode != 0);
   delete progNode;
@@ -813,7 +824,7 @@ bool InterpreterImp::checkSyntax(const UString &code)
 {
   // Parser::parse() returns 0 in a syntax error occurs, so we just check for that
   SourceCode *source;
-  FunctionBodyNode *progNode = Parser::parse(code.data(),code.size(),&source,0,0);
+  FunctionBodyNode *progNode = Parser::parse(code,&source,0,0);
   source->deref();
   bool ok = (progNode != 0);
   delete progNode;
@@ -835,7 +846,7 @@ Completion InterpreterImp::evaluate(const UString &code, const Value &thisV)
   int errLine;
   UString errMsg;
   SourceCode *source;
-  FunctionBodyNode *progNode = Parser::parse(code.data(),code.size(),&source,&errLine,&errMsg);
+  FunctionBodyNode *progNode = Parser::parse(code,&source,&errLine,&errMsg);
 
   // notify debugger that source has been parsed
   if (dbg) {
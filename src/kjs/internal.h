@@ -49,6 +49,8 @@ namespace KJS {
   class FunctionImp;
   class Parameter;
   class Debugger;
+  class Lexer;
+  class Arena;
 
   // ---------------------------------------------------------------------------
   //                            Primitive impls
@@ -225,23 +227,40 @@ namespace KJS {
    * @internal
    *
    * Parses ECMAScript source code and converts into FunctionBodyNode objects, which
-   * represent the root of a parse tree. This class provides a conveniant workaround
-   * for the problem of the bison parser working in a static context.
+   * represent the root of a parse tree. Each call of parse() has its own lexer
+   * and Parser object passed to the (pure) bison parser, so different threads
+   * may parse at the same time.
+   *
+   * The code passed by pointer must be followed by Lexer::padding zero
+   * characters (see Lexer::setCode()), the UString variant makes a
+   * padded copy of any string.
+   *
+   * When an arena is given, all nodes of the tree are allocated in it. The
+   * tree must not be deleted then, it is released with the arena.
+   *
+   * The caller holds one reference of the source code returned in src.
+   * In the compressor build the tree does not keep its own references,
+   * the source may be released whenever the caller does not need it.
    */
   class Parser {
   public:
+    static FunctionBodyNode *parse(const UString &code, SourceCode **src,
+            int *errLine = 0, UString *errMsg = 0);
     static FunctionBodyNode *parse(const UChar *code, unsigned int length,
             SourceCode **src, int *errLine = 0, UString *errMsg = 0) {
         return Parser::parse(code, length, src, errLine, 0, errMsg);
     }
     static FunctionBodyNode *parse(const UChar *code, unsigned int length,
             SourceCode **src, int *errLine, int *errChar,
-            UString *errMsg);
+            UString *errMsg, int *errColumn = 0, Arena *nodes = 0);
 
-    static FunctionBodyNode *progNode;
-    static SourceCode *source;
-    static int sid;
+    // state of one parse, used by the grammar actions
+    Lexer *lexer;
+    FunctionBodyNode *progNode;
+    SourceCode *source;
   private:
+    Parser(Lexer *l, SourceCode *s) : lexer(l), progNode(0), source(s) { }
+    static int sid;
   };
 
   class InterpreterImp {
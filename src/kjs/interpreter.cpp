@@ -349,7 +349,6 @@ void Interpreter::finalCheck()
 
   Node::finalCheck();
   Collector::finalCheck();
-  Lexer::globalClear();
   UString::globalClear();
 }
 #endif
@@ -40,37 +40,144 @@
 #include "lookup.h"
 #include "internal.h"
 #include "dtoa.h"
+#include "char_scan.h"
 
 // we can't specify the namespace in yacc's C output, so do it here
 using namespace KJS;
 
-static Lexer *currLexer = 0;
+static __thread Lexer *currLexer = 0;
 
 #ifndef KDE_USE_FINAL
 #include "grammar.h"
 #endif
 
-#include "lexer.lut.h"
+namespace {
+  struct Keyword {
+    const char *name;
+    int token;
+  };
+}
+
+// keywords and words reserved for future use. All of the words reserved
+// as per ECMA-262 are not here, both of the widespread browsers permit
+// them as identifiers (abstract, boolean, byte, char, double, final,
+// float, goto, implements, int, interface, long, native, package,
+// private, protected, public, short, static, synchronized, throws,
+// transient, volatile).
+static constexpr Keyword keywords[] = {
+  { "null", NULLTOKEN },
+  { "true", TRUETOKEN },
+  { "false", FALSETOKEN },
+  { "break", BREAK },
+  { "case", CASE },
+  { "catch", CATCH },
+  { "const", CONST },
+  { "default", DEFAULT },
+  { "finally", FINALLY },
+  { "for", FOR },
+  { "instanceof", INSTANCEOF },
+  { "new", NEW },
+  { "var", VAR },
+  { "continue", CONTINUE },
+  { "function", FUNCTION },
+  { "return", RETURN },
+  { "void", VOID },
+  { "delete", DELETE },
+  { "if", IF },
+  { "this", THIS },
+  { "do", DO },
+  { "while", WHILE },
+  { "else", ELSE },
+  { "in", IN },
+  { "switch", SWITCH },
+  { "throw", THROW },
+  { "try", TRY },
+  { "typeof", TYPEOF },
+  { "with", WITH },
+  { "debugger", DEBUGGER },
+  { "class", RESERVED },
+  { "enum", RESERVED },
+  { "export", RESERVED },
+  { "extends", RESERVED },
+  { "import", RESERVED },
+  { "super", RESERVED }
+};
+
+// recognizes keywords directly on the UChar buffer
+static constexpr PerfectHash<sizeof(keywords) / sizeof(*keywords)>
+  keywordTable(keywords, &Keyword::name);
+
+// powers of ten which are exact in double
+static const double exactPowersOf10[] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Converts decimal literal without kjs_strtod if it is simple enough:
+// the digits make an integer below 2^53 and the decimal exponent is at
+// most 22 either way. Both operands of the single multiplication or
+// division are exact then, so is the correctly rounded result (Clinger's
+// fast path). Returns false for the others.
+static bool fastStrtod(const char *s, double &result)
+{
+  unsigned long long mantissa = 0;
+  int digits = 0; // significant digits, 19 of them always fit
+  int exponent = 0;
+  const char *p = s;
+  for (; *p >= '0' && *p <= '9'; ++p) {
+    if ((mantissa || *p != '0') && ++digits > 19)
+      return false;
+    mantissa = mantissa * 10 + (*p - '0');
+  }
+  if (*p == '.') {
+    for (++p; *p >= '0' && *p <= '9'; ++p) {
+      if ((mantissa || *p != '0') && ++digits > 19)
+        return false;
+      mantissa = mantissa * 10 + (*p - '0');
+      --exponent;
+    }
+  }
+  if (*p == 'e' || *p == 'E') {
+    bool negative = *++p == '-';
+    if (*p == '+' || *p == '-')
+      ++p;
+    int e = 0;
+    for (; *p >= '0' && *p <= '9'; ++p) {
+      if (e > 10000)
+        return false;
+      e = e * 10 + (*p - '0');
+    }
+    exponent += negative ? -e : e;
+  }
+  if (*p || mantissa >> 53)
+    return false;
 
-extern YYLTYPE yylloc; // global bison variable holding token info
+  if (!mantissa)
+    result = 0;
+  else if (exponent >= 0 && exponent <= 22)
+    result = double(mantissa) * exactPowersOf10[exponent];
+  else if (exponent < 0 && exponent >= -22)
+    result = double(mantissa) / exactPowersOf10[-exponent];
+  else
+    return false;
+  return true;
+}
 
 // a bridge for yacc from the C world to C++
-int kjsyylex()
+int kjsyylex(void *lvalp, void *llocp, Parser *parser)
 {
-  return Lexer::curr()->lex();
+  return parser->lexer->lex(lvalp, llocp);
 }
 
 Lexer::Lexer()
-  : yylineno(1),
-    size8(128), size16(128), restrKeyword(false),
-    eatNextIdentifier(false), stackToken(-1), lastToken(-1), pos(0),
-    code(0), length(0),
+  : size8(128), size16(128), restrKeyword(false),
+    eatNextIdentifier(false), eatFunctionNames(true),
+    stackToken(-1), lastToken(-1),
+    code(0), cur(0), end(0), length(0), tokenStart(0), tokenLine(1),
 #ifndef KJS_PURE_ECMA
     bol(true),
 #endif
-    current(0), next1(0), next2(0), next3(0),
-    strings(0), numStrings(0), stringsCapacity(0),
-    identifiers(0), numIdentifiers(0), identifiersCapacity(0)
+    nodes(0), prevLexer(currLexer)
 {
   // allocate space for read buffers
   buffer8 = new char[size8];
@@ -80,67 +187,64 @@ Lexer::Lexer()
 
 Lexer::~Lexer()
 {
+  doneParsing();
   delete [] buffer8;
   delete [] buffer16;
+  currLexer = prevLexer;
 }
 
 Lexer *Lexer::curr()
 {
-  if (!currLexer) {
-    // create singleton instance
-    currLexer = new Lexer();
-  }
   return currLexer;
 }
 
-#ifdef KJS_DEBUG_MEM
-void Lexer::globalClear()
-{
-  delete currLexer;
-  currLexer = 0L;
-}
-#endif
+// zero padding standing for empty code
+static const UChar emptyCode[Lexer::padding];
 
 void Lexer::setCode(const UChar *c, unsigned int len)
 {
-  yylineno = 1;
   restrKeyword = false;
   delimited = false;
   eatNextIdentifier = false;
   stackToken = -1;
   lastToken = -1;
   foundBad = false;
-  pos = 0;
-  code = c;
   length = len;
-  skipLF = false;
-  skipCR = false;
 #ifndef KJS_PURE_ECMA
   bol = true;
 #endif
 
-  // read first characters
-  current = (length > 0) ? code[0].uc : 0;
-  next1 = (length > 1) ? code[1].uc : 0;
-  next2 = (length > 2) ? code[2].uc : 0;
-  next3 = (length > 3) ? code[3].uc : 0;
+  // empty code (a null string has no data at all) is just padding
+  if (len == 0)
+    c = emptyCode;
+  code = c;
+  cur = c;
+  end = c + len;
+  tokenStart = cur;
+  tokenLine = 1;
+  lines.clear();
+#ifndef NDEBUG
+  for (int i = 0; i < padding; i++)
+    assert(end[i].uc == 0);
+#endif
 }
 
-void Lexer::shift(unsigned int p)
+UString Lexer::padded(const UString &s)
 {
-  while (p--) {
-    pos++;
-    current = next1;
-    next1 = next2;
-    next2 = next3;
-    next3 = (pos + 3 < length) ? code[pos+3].uc : 0;
-  }
+  if (s.isEmpty())
+    return s;
+  UChar *d = new UChar[s.size() + padding];
+  memcpy(d, s.data(), s.size() * sizeof(UChar));
+  for (int i = 0; i < padding; i++)
+    d[s.size() + i].uc = 0;
+  return UString(d, s.size(), false);
 }
 
-// called on each new line
+// called on each line terminator, CR LF is passed as CR and LF
 void Lexer::nextLine()
 {
-  yylineno++;
+  if (current() == '\n' || peek(1) != '\n')
+    lines.add(cur + 1 - code);
 #ifndef KJS_PURE_ECMA
   bol = true;
 #endif
@@ -152,16 +256,20 @@ void Lexer::setDone(State s)
   done = true;
 }
 
-int Lexer::lex()
+int Lexer::lex(void *lvalp, void *llocp)
 {
+  YYSTYPE *val = static_cast<YYSTYPE *>(lvalp);
+  YYLTYPE *loc = static_cast<YYLTYPE *>(llocp);
   int token = 0;
   state = Start;
   unsigned short stringType = 0; // either single or double quotes
+  const UChar *text = 0; // start of identifier or string
+  bool escaped = false; // string is converted in buffer16
   pos8 = pos16 = 0;
   done = false;
   terminator = false;
-  skipLF = false;
-  skipCR = false;
+  tokenStart = cur;
+  tokenLine = lines.size();
 
   // did we push a token on the stack previously ?
   // (after an automatic semicolon insertion)
@@ -172,36 +280,22 @@ int Lexer::lex()
   }
 
   while (!done) {
-    if (skipLF && current != '\n') // found \r but not \n afterwards
-        skipLF = false;
-    if (skipCR && current != '\r') // found \n but not \r afterwards
-        skipCR = false;
-    if (skipLF || skipCR) // found \r\n or \n\r -> eat the second one
-    {
-        skipLF = false;
-        skipCR = false;
-        shift(1);
-    }
-
-    bool cr = (current == '\r');
-    bool lf = (current == '\n');
-    if (cr)
-      skipLF = true;
-    else if (lf)
-      skipCR = true;
-    bool isLineTerminator = cr || lf;
-
     switch (state) {
     case Start:
-      if (isWhiteSpace(current)) {
-        // do nothing
-      } else if (current == '/' && next1 == '/') {
-        shift(1);
+      // lines are added as they are passed, the last one is current
+      tokenStart = cur;
+      tokenLine = lines.size();
+      if (isWhiteSpace(current())) {
+        // skip the whole run of blanks at once
+        cur = CharScan::skipBlanks(cur + 1, end);
+        continue;
+      } else if (current() == '/' && peek(1) == '/') {
+        cur++;
         state = InSingleLineComment;
-      } else if (current == '/' && next1 == '*') {
-        shift(1);
+      } else if (current() == '/' && peek(1) == '*') {
+        cur++;
         state = InMultiLineComment;
-      } else if (current == 0) {
+      } else if (cur == end) {
         if (!terminator && !delimited) {
           // automatic semicolon insertion if program incomplete
           token = ';';
@@ -209,41 +303,46 @@ int Lexer::lex()
           setDone(Other);
         } else
           setDone(Eof);
-      } else if (isLineTerminator) {
+      } else if (isLineTerminator(current())) {
         nextLine();
         terminator = true;
         if (restrKeyword) {
           token = ';';
           setDone(Other);
         }
-      } else if (current == '"' || current == '\'') {
+      } else if (current() == '"' || current() == '\'') {
         state = InString;
-        stringType = current;
-      } else if (isIdentLetter(current)) {
-        record16(current);
-        state = InIdentifier;
-      } else if (current == '0') {
-        record8(current);
+        stringType = current();
+        text = cur + 1;
+      } else if (isIdentLetter(current())) {
+        // consume the whole identifier at once
+        const UChar *p = skipRun(cur + 1, IdentLetterChar | DecimalDigitChar);
+        text = cur;
+        cur = p;
+        setDone(Identifier);
+      } else if (current() == '0') {
+        record8(current());
         state = InNum0;
-      } else if (isDecimalDigit(current)) {
-        record8(current);
+      } else if (isDecimalDigit(current())) {
+        record8Run(DecimalDigitChar);
         state = InNum;
-      } else if (current == '.' && isDecimalDigit(next1)) {
-        record8(current);
+        continue;
+      } else if (current() == '.' && isDecimalDigit(peek(1))) {
+        record8(current());
         state = InDecimal;
 #ifndef KJS_PURE_ECMA
         // <!-- marks the beginning of a line comment (for www usage)
-      } else if (current == '<' && next1 == '!' &&
-                 next2 == '-' && next3 == '-') {
-        shift(3);
+      } else if (current() == '<' && peek(1) == '!' &&
+                 peek(2) == '-' && peek(3) == '-') {
+        cur += 3;
         state = InSingleLineComment;
         // same for -->
-      } else if (bol && current == '-' && next1 == '-' &&  next2 == '>') {
-        shift(2);
+      } else if (bol && current() == '-' && peek(1) == '-' &&  peek(2) == '>') {
+        cur += 2;
         state = InSingleLineComment;
 #endif
       } else {
-        token = matchPunctuator(current, next1, next2, next3);
+        token = matchPunctuator();
         if (token != -1) {
           setDone(Other);
         } else {
@@ -253,111 +352,116 @@ int Lexer::lex()
       }
       break;
     case InString:
-      if (current == stringType) {
-        shift(1);
+      if (current() == stringType) {
+        cur++;
         setDone(String);
-      } else if (current == 0 || isLineTerminator) {
+      } else if (cur == end || isLineTerminator(current())) {
         setDone(Bad);
-      } else if (current == '\\') {
+      } else if (current() == '\\') {
+        // the string is no more a slice of the code, convert it from here
+        if (!escaped) {
+          record16(text, cur - text);
+          escaped = true;
+        }
         state = InEscapeSequence;
       } else {
-        record16(current);
+        // skip the whole run up to the next quote, escape or line end
+        const UChar *stop = CharScan::find(cur + 1, end,
+                                           stringType, '\\', '\r', '\n', '\n');
+        if (escaped)
+          record16(cur, stop - cur);
+        cur = stop;
+        continue;
       }
       break;
     // Escape Sequences inside of strings
     case InEscapeSequence:
-      if (isOctalDigit(current)) {
-        if (current >= '0' && current <= '3' &&
-            isOctalDigit(next1) && isOctalDigit(next2)) {
+      if (cur == end) {
+        setDone(Bad);
+      } else if (isOctalDigit(current())) {
+        if (current() >= '0' && current() <= '3' &&
+            isOctalDigit(peek(1)) && isOctalDigit(peek(2))) {
 #ifndef ORIGINAL_CODE
-          record16('\\');
-          record16(current);
-          record16(next1);
-          record16(next2);
+          record16(cur - 1, 4);
 #else
-          record16(convertOctal(current, next1, next2));
+          record16(convertOctal(current(), peek(1), peek(2)));
 #endif
-          shift(2);
+          cur += 2;
           state = InString;
-        } else if (isOctalDigit(current) && isOctalDigit(next1)) {
+        } else if (isOctalDigit(current()) && isOctalDigit(peek(1))) {
 #ifndef ORIGINAL_CODE
-          record16('\\');
-          record16(current);
-          record16(next1);
+          record16(cur - 1, 3);
 #else
-          record16(convertOctal('0', current, next1));
+          record16(convertOctal('0', current(), peek(1)));
 #endif
-          shift(1);
+          cur++;
           state = InString;
-        } else if (isOctalDigit(current)) {
+        } else if (isOctalDigit(current())) {
 #ifndef ORIGINAL_CODE
-          record16('\\');
-          record16(current);
+          record16(cur - 1, 2);
 #else
-          record16(convertOctal('0', '0', current));
+          record16(convertOctal('0', '0', current()));
 #endif
           state = InString;
         } else {
           setDone(Bad);
         }
-      } else if (current == 'x')
+      } else if (current() == 'x')
         state = InHexEscape;
-      else if (current == 'u')
+      else if (current() == 'u')
         state = InUnicodeEscape;
       else {
-	if (isLineTerminator)
-	  nextLine();
-        record16(singleEscape(current));
+        record16(singleEscape(current()));
+        if (isLineTerminator(current())) {
+          // line continuation, CR LF is one terminator
+          if (current() == '\r' && peek(1) == '\n')
+            cur++;
+          nextLine();
+        }
         state = InString;
       }
       break;
     case InHexEscape:
-      if (isHexDigit(current) && isHexDigit(next1)) {
+      if (cur == end) {
+        setDone(Bad);
+      } else if (isHexDigit(current()) && isHexDigit(peek(1))) {
         state = InString;
 #ifndef ORIGINAL_CODE
-        record16('\\');
-        record16('x');
-        record16(current);
-        record16(next1);
+        record16(cur - 2, 4);
 #else
-        record16(convertHex(current, next1));
+        record16(convertHex(current(), peek(1)));
 #endif
-        shift(1);
-      } else if (current == stringType) {
+        cur++;
+      } else if (current() == stringType) {
         record16('x');
-        shift(1);
+        cur++;
         setDone(String);
       } else {
         record16('x');
-        record16(current);
+        record16(current());
         state = InString;
       }
       break;
     case InUnicodeEscape:
-      if (isHexDigit(current) && isHexDigit(next1) &&
-          isHexDigit(next2) && isHexDigit(next3)) {
+      if (isHexDigit(current()) && isHexDigit(peek(1)) &&
+          isHexDigit(peek(2)) && isHexDigit(peek(3))) {
 #ifndef ORIGINAL_CODE
-        record16('\\');
-        record16('u');
-        record16(current);
-        record16(next1);
-        record16(next2);
-        record16(next3);
+        record16(cur - 2, 6);
 #else
-        record16(convertUnicode(current, next1, next2, next3));
+        record16(convertUnicode(current(), peek(1), peek(2), peek(3)));
 #endif
-        shift(3);
+        cur += 3;
         state = InString;
-      } else if (current == stringType) {
+      } else if (current() == stringType) {
         record16('u');
-        shift(1);
+        cur++;
         setDone(String);
       } else {
         setDone(Bad);
       }
       break;
     case InSingleLineComment:
-      if (isLineTerminator) {
+      if (isLineTerminator(current())) {
         nextLine();
         terminator = true;
         if (restrKeyword) {
@@ -365,97 +469,103 @@ int Lexer::lex()
           setDone(Other);
         } else
           state = Start;
-      } else if (current == 0) {
+      } else if (cur == end) {
         setDone(Eof);
+      } else {
+        // jump to the line terminator
+        cur = CharScan::find(cur + 1, end, '\r', '\n', '\n', '\n', '\n');
+        continue;
       }
       break;
     case InMultiLineComment:
-      if (current == 0) {
+      if (cur == end) {
         setDone(Bad);
-      } else if (isLineTerminator) {
+      } else if (isLineTerminator(current())) {
         nextLine();
-      } else if (current == '*' && next1 == '/') {
+      } else if (current() == '*' && peek(1) == '/') {
         state = Start;
-        shift(1);
-      }
-      break;
-    case InIdentifier:
-      if (isIdentLetter(current) || isDecimalDigit(current)) {
-        record16(current);
-        break;
+        cur++;
+      } else {
+        // jump to the next candidate of comment end or line terminator
+        cur = CharScan::find(cur + 1, end, '*', '\r', '\n', '\n', '\n');
+        continue;
       }
-      setDone(Identifier);
       break;
     case InNum0:
-      if (current == 'x' || current == 'X') {
-        record8(current);
+      if (current() == 'x' || current() == 'X') {
+        record8(current());
         state = InHex;
-      } else if (current == '.') {
-        record8(current);
+      } else if (current() == '.') {
+        record8(current());
         state = InDecimal;
-      } else if (current == 'e' || current == 'E') {
-        record8(current);
+      } else if (current() == 'e' || current() == 'E') {
+        record8(current());
         state = InExponentIndicator;
-      } else if (isOctalDigit(current)) {
-        record8(current);
+      } else if (isOctalDigit(current())) {
+        record8(current());
         state = InOctal;
-      } else if (isDecimalDigit(current)) {
-        record8(current);
+      } else if (isDecimalDigit(current())) {
+        record8(current());
         state = InDecimal;
       } else {
         setDone(Number);
       }
       break;
     case InHex:
-      if (isHexDigit(current)) {
-        record8(current);
+      if (isHexDigit(current())) {
+        record8Run(HexDigitChar);
+        continue;
       } else {
         setDone(Hex);
       }
       break;
     case InOctal:
-      if (isOctalDigit(current)) {
-        record8(current);
+      if (isOctalDigit(current())) {
+        record8Run(OctalDigitChar);
+        continue;
       }
-      else if (isDecimalDigit(current)) {
-        record8(current);
+      else if (isDecimalDigit(current())) {
+        record8(current());
         state = InDecimal;
       } else
         setDone(Octal);
       break;
     case InNum:
-      if (isDecimalDigit(current)) {
-        record8(current);
-      } else if (current == '.') {
-        record8(current);
+      if (isDecimalDigit(current())) {
+        record8Run(DecimalDigitChar);
+        continue;
+      } else if (current() == '.') {
+        record8(current());
         state = InDecimal;
-      } else if (current == 'e' || current == 'E') {
-        record8(current);
+      } else if (current() == 'e' || current() == 'E') {
+        record8(current());
         state = InExponentIndicator;
       } else
         setDone(Number);
       break;
     case InDecimal:
-      if (isDecimalDigit(current)) {
-        record8(current);
-      } else if (current == 'e' || current == 'E') {
-        record8(current);
+      if (isDecimalDigit(current())) {
+        record8Run(DecimalDigitChar);
+        continue;
+      } else if (current() == 'e' || current() == 'E') {
+        record8(current());
         state = InExponentIndicator;
       } else
         setDone(Number);
       break;
     case InExponentIndicator:
-      if (current == '+' || current == '-') {
-        record8(current);
-      } else if (isDecimalDigit(current)) {
-        record8(current);
+      if (current() == '+' || current() == '-') {
+        record8(current());
+      } else if (isDecimalDigit(current())) {
+        record8(current());
         state = InExponent;
       } else
         setDone(Bad);
       break;
     case InExponent:
-      if (isDecimalDigit(current)) {
-        record8(current);
+      if (isDecimalDigit(current())) {
+        record8Run(DecimalDigitChar);
+        continue;
       } else
         setDone(Number);
       break;
@@ -465,7 +575,7 @@ int Lexer::lex()
 
     // move on to the next character
     if (!done)
-      shift(1);
+      cur++;
 #ifndef KJS_PURE_ECMA
     if (state != Start && state != InSingleLineComment)
       bol = false;
@@ -474,7 +584,7 @@ int Lexer::lex()
 
   // no identifiers allowed directly after numeric literal, e.g. "3in" is bad
   if ((state == Number || state == Octal || state == Hex)
-      && isIdentLetter(current))
+      && isIdentLetter(current()))
     state = Bad;
 
   // terminate string
@@ -488,10 +598,17 @@ int Lexer::lex()
 
   long double dval = 0;
   if (state == Number) {
-    dval = kjs_strtod(buffer8, 0L);
+    double d;
+    dval = fastStrtod(buffer8, d) ? d : kjs_strtod(buffer8, 0L);
   } else if (state == Hex) { // scan hex numbers
     dval = 0;
-    if (buffer8[0] == '0' && (buffer8[1] == 'x' || buffer8[1] == 'X')) {
+    if (pos8 <= 2 + 16) {
+      // up to 64 bits are exact in an integer, rounded once at the end
+      unsigned long long value = 0;
+      for (const char *p = buffer8+2; *p; p++)
+        value = value * 16 + convertHex(*p);
+      dval = value;
+    } else if (buffer8[0] == '0' && (buffer8[1] == 'x' || buffer8[1] == 'X')) {
       for (const char *p = buffer8+2; *p; p++) {
 	if (!isHexDigit(*p)) {
 	  dval = 0;
@@ -542,8 +659,8 @@ int Lexer::lex()
 
   restrKeyword = false;
   delimited = false;
-  kjsyylloc.first_line = yylineno; // ???
-  kjsyylloc.last_line = yylineno;
+  loc->first_line = tokenLine;
+  loc->last_line = lines.size();
 
   switch (state) {
   case Eof:
@@ -555,19 +672,21 @@ int Lexer::lex()
     }
     break;
   case Identifier:
-    if ((token = Lookup::find(&mainTable, buffer16, pos16)) < 0) {
+    if ((token = keywordTable.find(text, cur - text)) >= 0)
+      token = keywords[token].token;
+    else {
       // Lookup for keyword failed, means this is an identifier
       // Apply anonymous-function hack below (eat the identifier)
       if (eatNextIdentifier) {
         eatNextIdentifier = false;
 #ifdef KJS_VERBOSE
-        UString debugstr(buffer16, pos16); fprintf(stderr,"Anonymous function hack: eating identifier %s\n",debugstr.ascii());
+        UString debugstr(text, cur - text); fprintf(stderr,"Anonymous function hack: eating identifier %s\n",debugstr.ascii());
 #endif
-        token = lex();
+        token = lex(lvalp, llocp);
         break;
       }
-      /* TODO: close leak on parse error. same holds true for String */
-      kjsyylval.ident = makeIdentifier(buffer16, pos16);
+      val->text.data = text;
+      val->text.size = cur - text;
       token = IDENT;
       break;
     }
@@ -576,7 +695,7 @@ int Lexer::lex()
     // Hack for "f = function somename() { ... }", too hard to get into the grammar
     // Same for building an array with function pointers ( 'name', func1, 'name2', func2 )
     // There are lots of other uses, we really have to get this into the grammar
-    if ( token == FUNCTION &&
+    if ( token == FUNCTION && eatFunctionNames &&
          ( lastToken == '=' || lastToken == ',' || lastToken == '(' ) )
             eatNextIdentifier = true;
 
@@ -585,11 +704,20 @@ int Lexer::lex()
       restrKeyword = true;
     break;
   case String:
-    kjsyylval.ustr = makeUString(buffer16, pos16);
+    if (escaped) {
+      // converted text has to outlive buffer16
+      UChar *data = static_cast<UChar *>(arena.allocate(pos16 * sizeof(UChar)));
+      memcpy(data, buffer16, pos16 * sizeof(UChar));
+      val->text.data = data;
+      val->text.size = pos16;
+    } else {
+      val->text.data = text;
+      val->text.size = cur - 1 - text;
+    }
     token = STRING;
     break;
   case Number:
-    kjsyylval.dval = dval;
+    val->dval = dval;
     token = NUMBER;
     break;
   case Bad:
@@ -603,130 +731,175 @@ int Lexer::lex()
   return token;
 }
 
+// bits of Lexer::CharClass for every code unit below 256
+struct CharClassTable {
+  unsigned char classes[256];
+
+  constexpr CharClassTable() : classes()
+  {
+    for (int c = 0; c < 256; c++) {
+      unsigned char bits = 0;
+      if (c == ' ' || c == '\t' || c == 0x0b || c == 0x0c || c == 0xa0)
+        bits |= Lexer::WhiteSpaceChar;
+      // Latin-1 letters are those of the Unicode categories below,
+      // except multiplication and division signs
+      if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+          (c >= 0xc0 && c != 0xd7 && c != 0xf7) || c == '$' || c == '_')
+        bits |= Lexer::IdentLetterChar;
+      if (c >= '0' && c <= '9')
+        bits |= Lexer::DecimalDigitChar | Lexer::HexDigitChar;
+      if ((c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))
+        bits |= Lexer::HexDigitChar;
+      if (c >= '0' && c <= '7')
+        bits |= Lexer::OctalDigitChar;
+      classes[c] = bits;
+    }
+  }
+};
+
+static constexpr CharClassTable charClasses;
+
+// bytes of non UTF-8 (e.g. Latin-1) input keep their Latin-1 class,
+// see decode() in util.h
+static inline unsigned short undecoded(unsigned short c)
+{
+  return (c >= 0xdc80 && c <= 0xdcff) ? (c & 0xff) : c;
+}
+
 bool Lexer::isWhiteSpace(unsigned short c)
 {
-  return (c == ' ' || c == '\t' ||
-          c == 0x0b || c == 0x0c || c == 0xa0);
+  c = undecoded(c);
+  return c < 256 && (charClasses.classes[c] & WhiteSpaceChar);
 }
 
 bool Lexer::isIdentLetter(unsigned short c)
 {
+  c = undecoded(c);
+  if (c < 256)
+    return charClasses.classes[c] & IdentLetterChar;
   // Allow any character in the Unicode categories
   // Uppercase letter (Lu), Lowercase letter (Ll),
   // Titlecase letter (Lt)", Modifier letter (Lm),
   // Other letter (Lo), or Letter number (Nl).
   // Also see: http://www.unicode.org/Public/UNIDATA/UnicodeData.txt */
-  return (c >= 'a' && c <= 'z' ||
-          c >= 'A' && c <= 'Z' ||
-          // A with grave - O with diaeresis
-          c >= 0x00c0 && c <= 0x00d6 ||
-          // O with stroke - o with diaeresis
-          c >= 0x00d8 && c <= 0x00f6 ||
-          // o with stroke - turned h with fishook and tail
-          c >= 0x00f8 && c <= 0x02af ||
+  return (// o with stroke - turned h with fishook and tail
+          c <= 0x02af ||
           // Greek etc. TODO: not precise
-          c >= 0x0388 && c <= 0x1ffc ||
-          c == '$' || c == '_');
+          (c >= 0x0388 && c <= 0x1ffc));
   /* TODO: use complete category table */
 }
 
 bool Lexer::isDecimalDigit(unsigned short c)
 {
-  return (c >= '0' && c <= '9');
+  return c < 256 && (charClasses.classes[c] & DecimalDigitChar);
 }
 
 bool Lexer::isHexDigit(unsigned short c)
 {
-  return (c >= '0' && c <= '9' ||
-          c >= 'a' && c <= 'f' ||
-          c >= 'A' && c <= 'F');
+  return c < 256 && (charClasses.classes[c] & HexDigitChar);
 }
 
 bool Lexer::isOctalDigit(unsigned short c)
 {
-  return (c >= '0' && c <= '7');
+  return c < 256 && (charClasses.classes[c] & OctalDigitChar);
 }
 
-int Lexer::matchPunctuator(unsigned short c1, unsigned short c2,
-                              unsigned short c3, unsigned short c4)
+// end of the run of characters of given classes starting at p
+const UChar *Lexer::skipRun(const UChar *p, unsigned char classes) const
 {
+  // the zero padding after the code has no class and ends any run
+  for (;; p++) {
+    unsigned short c = p->uc;
+    if (c < 256) {
+      if (!(charClasses.classes[c] & classes))
+        break;
+    } else if (!(classes & IdentLetterChar) || !isIdentLetter(c))
+      break;
+  }
+  return p;
+}
+
+int Lexer::matchPunctuator()
+{
+  unsigned short c1 = peek(0), c2 = peek(1), c3 = peek(2), c4 = peek(3);
+
   if (c1 == '>' && c2 == '>' && c3 == '>' && c4 == '=') {
-    shift(4);
+    cur += 4;
     return URSHIFTEQUAL;
   } else if (c1 == '=' && c2 == '=' && c3 == '=') {
-    shift(3);
+    cur += 3;
     return STREQ;
   } else if (c1 == '!' && c2 == '=' && c3 == '=') {
-    shift(3);
+    cur += 3;
     return STRNEQ;
    } else if (c1 == '>' && c2 == '>' && c3 == '>') {
-    shift(3);
+    cur += 3;
     return URSHIFT;
   } else if (c1 == '<' && c2 == '<' && c3 == '=') {
-    shift(3);
+    cur += 3;
     return LSHIFTEQUAL;
   } else if (c1 == '>' && c2 == '>' && c3 == '=') {
-    shift(3);
+    cur += 3;
     return RSHIFTEQUAL;
   } else if (c1 == '<' && c2 == '=') {
-    shift(2);
+    cur += 2;
     return LE;
   } else if (c1 == '>' && c2 == '=') {
-    shift(2);
+    cur += 2;
     return GE;
   } else if (c1 == '!' && c2 == '=') {
-    shift(2);
+    cur += 2;
     return NE;
   } else if (c1 == '+' && c2 == '+') {
-    shift(2);
+    cur += 2;
     if (terminator)
       return AUTOPLUSPLUS;
     else
       return PLUSPLUS;
   } else if (c1 == '-' && c2 == '-') {
-    shift(2);
+    cur += 2;
     if (terminator)
       return AUTOMINUSMINUS;
     else
       return MINUSMINUS;
   } else if (c1 == '=' && c2 == '=') {
-    shift(2);
+    cur += 2;
     return EQEQ;
   } else if (c1 == '+' && c2 == '=') {
-    shift(2);
+    cur += 2;
     return PLUSEQUAL;
   } else if (c1 == '-' && c2 == '=') {
-    shift(2);
+    cur += 2;
     return MINUSEQUAL;
   } else if (c1 == '*' && c2 == '=') {
-    shift(2);
+    cur += 2;
     return MULTEQUAL;
   } else if (c1 == '/' && c2 == '=') {
-    shift(2);
+    cur += 2;
     return DIVEQUAL;
   } else if (c1 == '&' && c2 == '=') {
-    shift(2);
+    cur += 2;
     return ANDEQUAL;
   } else if (c1 == '^' && c2 == '=') {
-    shift(2);
+    cur += 2;
     return XOREQUAL;
   } else if (c1 == '%' && c2 == '=') {
-    shift(2);
+    cur += 2;
     return MODEQUAL;
   } else if (c1 == '|' && c2 == '=') {
-    shift(2);
+    cur += 2;
     return OREQUAL;
   } else if (c1 == '<' && c2 == '<') {
-    shift(2);
+    cur += 2;
     return LSHIFT;
   } else if (c1 == '>' && c2 == '>') {
-    shift(2);
+    cur += 2;
     return RSHIFT;
   } else if (c1 == '&' && c2 == '&') {
-    shift(2);
+    cur += 2;
     return AND;
   } else if (c1 == '|' && c2 == '|') {
-    shift(2);
+    cur += 2;
     return OR;
   }
 
@@ -755,7 +928,7 @@ int Lexer::matchPunctuator(unsigned short c1, unsigned short c2,
     case '[':
     case ']':
     case ';':
-      shift(1);
+      cur++;
       return static_cast<int>(c1);
     default:
       return -1;
@@ -832,6 +1005,34 @@ void Lexer::record8(unsigned short c)
   buffer8[pos8++] = (char) c;
 }
 
+void Lexer::record8(const UChar *c, unsigned int len)
+{
+  // enlarge buffer to hold all of them
+  if (pos8 + len >= size8) {
+    unsigned int size = 2 * size8;
+    while (pos8 + len >= size)
+      size *= 2;
+    char *tmp = new char[size];
+    memcpy(tmp, buffer8, pos8 * sizeof(char));
+    delete [] buffer8;
+    buffer8 = tmp;
+    size8 = size;
+  }
+
+  for (unsigned int i = 0; i < len; i++) {
+    assert(c[i].uc <= 0xff);
+    buffer8[pos8++] = (char) c[i].uc;
+  }
+}
+
+// records the run of characters of given classes starting at cur
+void Lexer::record8Run(unsigned char classes)
+{
+  const UChar *p = skipRun(cur, classes);
+  record8(cur, p - cur);
+  cur = p;
+}
+
 void Lexer::record16(UChar c)
 {
   // enlarge buffer if full
@@ -846,6 +1047,24 @@ void Lexer::record16(UChar c)
   buffer16[pos16++] = c;
 }
 
+void Lexer::record16(const UChar *c, unsigned int len)
+{
+  // enlarge buffer to hold all of them
+  if (pos16 + len >= size16) {
+    unsigned int size = 2 * size16;
+    while (pos16 + len >= size)
+      size *= 2;
+    UChar *tmp = new UChar[size];
+    memcpy(tmp, buffer16, pos16 * sizeof(UChar));
+    delete [] buffer16;
+    buffer16 = tmp;
+    size16 = size;
+  }
+
+  memcpy(buffer16 + pos16, c, len * sizeof(UChar));
+  pos16 += len;
+}
+
 bool Lexer::scanRegExp()
 {
   pos16 = 0;
@@ -853,34 +1072,33 @@ bool Lexer::scanRegExp()
   bool inBrackets = false;
 
   while (1) {
-    if (current == '\r' || current == '\n' || current == 0)
+    if (current() == '\r' || current() == '\n' || cur == end)
       return false;
-    else if (current != '/' || lastWasEscape == true || inBrackets == true)
+    else if (current() != '/' || lastWasEscape == true || inBrackets == true)
     {
         // keep track of '[' and ']'
         if ( !lastWasEscape ) {
-          if ( current == '[' && !inBrackets )
+          if ( current() == '[' && !inBrackets )
             inBrackets = true;
-          if ( current == ']' && inBrackets )
+          if ( current() == ']' && inBrackets )
             inBrackets = false;
         }
-        record16(current);
+        record16(current());
         lastWasEscape =
-            !lastWasEscape && (current == '\\');
+            !lastWasEscape && (current() == '\\');
     }
     else { // end of regexp
       pattern = UString(buffer16, pos16);
       pos16 = 0;
-      shift(1);
+      cur++;
       break;
     }
-    shift(1);
+    cur++;
   }
 
-  while (isIdentLetter(current)) {
-    record16(current);
-    shift(1);
-  }
+  const UChar *p = skipRun(cur, IdentLetterChar);
+  record16(cur, p - cur);
+  cur = p;
   flags = UString(buffer16, pos16);
 
   return true;
@@ -889,46 +1107,5 @@ bool Lexer::scanRegExp()
 
 void Lexer::doneParsing()
 {
-  for (unsigned i = 0; i < numIdentifiers; i++) {
-    delete identifiers[i];
-  }
-  free(identifiers);
-  identifiers = 0;
-  numIdentifiers = 0;
-  identifiersCapacity = 0;
-
-  for (unsigned i = 0; i < numStrings; i++) {
-    delete strings[i];
-  }
-  free(strings);
-  strings = 0;
-  numStrings = 0;
-  stringsCapacity = 0;
-}
-
-const int initialCapacity = 64;
-const int growthFactor = 2;
-
-Identifier *Lexer::makeIdentifier(UChar *buffer, unsigned int pos)
-{
-  if (numIdentifiers == identifiersCapacity) {
-    identifiersCapacity = (identifiersCapacity == 0) ? initialCapacity : identifiersCapacity *growthFactor;
-    identifiers = (KJS::Identifier **)realloc(identifiers, sizeof(KJS::Identifier *) * identifiersCapacity);
-  }
-
-  KJS::Identifier *identifier = new KJS::Identifier(buffer, pos);
-  identifiers[numIdentifiers++] = identifier;
-  return identifier;
-}
-
-UString *Lexer::makeUString(UChar *buffer, unsigned int pos)
-{
-  if (numStrings == stringsCapacity) {
-    stringsCapacity = (stringsCapacity == 0) ? initialCapacity : stringsCapacity *growthFactor;
-    strings = (UString **)realloc(strings, sizeof(UString *) * stringsCapacity);
-  }
-
-  UString *string = new UString(buffer, pos);
-  strings[numStrings++] = string;
-  return string;
+  arena.clear();
 }
@@ -24,29 +24,94 @@
 #define _KJSLEXER_H_
 
 #include "ustring.h"
-
+#include "identifier.h"
+#include "arena.h"
+#include "line_index.h"
 
 namespace KJS {
 
-  class Identifier;
-
   class RegExp;
 
+  /**
+   * Text of identifier or string token. It points straight into the
+   * source code or, when escapes had to be converted, into the arena of
+   * the lexer. It is valid until Lexer::doneParsing(), values the AST
+   * keeps are made by ident() or ustring().
+   */
+  struct TokenText {
+    const UChar *data;
+    unsigned int size;
+
+    Identifier ident() const { return Identifier(data, size); }
+    UString ustring() const { return UString(data, size); }
+  };
+
   class Lexer {
   public:
     Lexer();
     ~Lexer();
+    /**
+     * Lexer of the parse running in this thread (the most recently
+     * constructed one that is still alive), 0 if there is none.
+     */
     static Lexer *curr();
 
+    /**
+     * Number of zero characters which must follow the code passed to
+     * setCode(), see there.
+     */
+    enum { padding = 4 };
+
+    /**
+     * Sets code of given length to lex. The code must be followed by
+     * padding zero characters: c[len] .. c[len + padding - 1] are
+     * readable and 0. The lexer reads its lookahead through them without
+     * bounds checks and never moves past c + len, so end of input is
+     * tested only where a state consumes a character.
+     */
     void setCode(const UChar *c, unsigned int len);
-    int lex();
 
-    int lineNo() const { return yylineno + 1; }
+    /**
+     * Returns a copy of s which meets the padding required by setCode().
+     */
+    static UString padded(const UString &s);
+    /**
+     * Scans next token, its value and location are stored to lvalp and
+     * llocp (pointers to YYSTYPE and YYLTYPE of the bison parser).
+     */
+    int lex(void *lvalp, void *llocp);
+
+    int lineNo() const { return lines.size() + 1; }
 
-    int charNo() const { return pos;}
+    int charNo() const { return cur - code; }
 
     bool prevTerminator() const { return terminator; }
 
+    /**
+     * Offset and line (starting with 1) of the first character of the
+     * last token returned by lex().
+     */
+    int tokenOffset() const { return tokenStart - code; }
+    int tokenLineNo() const { return tokenLine; }
+
+    /**
+     * Lines passed so far, offsets are relative to the code.
+     */
+    const LineIndex &lineIndex() const { return lines; }
+
+    /**
+     * The parser wants the name of function expressions eaten (the
+     * grammar has no place for it), token tools want to see it.
+     */
+    void setEatFunctionNames(bool eat) { eatFunctionNames = eat; }
+
+    /**
+     * Arena for the nodes created while this lexer is current, 0 means
+     * they are allocated on the heap.
+     */
+    void setNodeArena(Arena *a) { nodes = a; }
+    Arena *nodeArena() const { return nodes; }
+
     enum State { Start,
                  Identifier,
                  InIdentifier,
@@ -75,14 +140,25 @@ namespace KJS {
     UString pattern, flags;
     bool hadError() const { return foundBad; }
 
+    /**
+     * Character classes, bit flags. Classes of characters below 256
+     * are looked up in a table, only letters above have a slow path.
+     */
+    enum CharClass { WhiteSpaceChar = 1,
+                     IdentLetterChar = 2,
+                     DecimalDigitChar = 4,
+                     HexDigitChar = 8,
+                     OctalDigitChar = 16 };
+
     static bool isWhiteSpace(unsigned short c);
+    static bool isLineTerminator(unsigned short c)
+      { return c == '\r' || c == '\n'; }
     static bool isIdentLetter(unsigned short c);
     static bool isDecimalDigit(unsigned short c);
     static bool isHexDigit(unsigned short c);
     static bool isOctalDigit(unsigned short c);
 
   private:
-    int yylineno;
     bool done;
     char *buffer8;
     UChar *buffer16;
@@ -92,22 +168,17 @@ namespace KJS {
     bool restrKeyword;
     // encountered delimiter like "'" and "}" on last run
     bool delimited;
-    bool skipLF;
-    bool skipCR;
     bool eatNextIdentifier;
+    bool eatFunctionNames;
     int stackToken;
     int lastToken;
     bool foundBad;
 
     State state;
     void setDone(State s);
-    unsigned int pos;
-    void shift(unsigned int p);
     void nextLine();
-    int lookupKeyword(const char *);
 
-    int matchPunctuator(unsigned short c1, unsigned short c2,
-                        unsigned short c3, unsigned short c4);
+    int matchPunctuator();
     unsigned short singleEscape(unsigned short c) const;
     unsigned short convertOctal(unsigned short c1, unsigned short c2,
                                 unsigned short c3) const;
@@ -117,40 +188,42 @@ namespace KJS {
     static UChar convertUnicode(unsigned short c1, unsigned short c2,
                                 unsigned short c3, unsigned short c4);
 
-#ifdef KJS_DEBUG_MEM
-    /**
-     * Clear statically allocated resources
-     */
-    static void globalClear();
-#endif
-
     void doneParsing();
 
   private:
 
     void record8(unsigned short c);
+    void record8(const UChar *c, unsigned int len);
+    void record8Run(unsigned char classes);
+    const UChar *skipRun(const UChar *p, unsigned char classes) const;
     void record16(UChar c);
+    void record16(const UChar *c, unsigned int len);
 
-    KJS::Identifier *makeIdentifier(UChar *buffer, unsigned int pos);
-    UString *makeUString(UChar *buffer, unsigned int pos);
+    // cur points to the current character, lookahead is done by
+    // indexing it; cur never passes end and characters past the end are
+    // the zero padding of the code, so i must be less than padding
+    unsigned short current() const { return cur->uc; }
+    unsigned short peek(unsigned int i) const { return cur[i].uc; }
 
     const UChar *code;
+    const UChar *cur;
+    const UChar *end;
     unsigned int length;
+    const UChar *tokenStart;
+    int tokenLine;
+    LineIndex lines;
     int yycolumn;
 #ifndef KJS_PURE_ECMA
     int bol;     // begin of line
 #endif
 
-    // current and following unicode characters
-    unsigned short current, next1, next2, next3;
-
-    UString **strings;
-    unsigned int numStrings;
-    unsigned int stringsCapacity;
+    // converted strings, released by doneParsing()
+    Arena arena;
+    // nodes of the parse, owned by the caller of the parser
+    Arena *nodes;
 
-    KJS::Identifier **identifiers;
-    unsigned int numIdentifiers;
-    unsigned int identifiersCapacity;
+    // lexer which was current before this one
+    Lexer *prevLexer;
 
     // for future extensions
     class LexerPrivate;
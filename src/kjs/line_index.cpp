@@ -0,0 +1,91 @@
+// -*- c-basic-offset: 2 -*-
+/*
+ *  This file is part of the KDE libraries
+ *  Copyright (C) 2026 agent (agent@local)
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include <stdlib.h>
+#include <new>
+
+#include "line_index.h"
+#include "char_scan.h"
+
+using namespace KJS;
+
+LineIndex::LineIndex()
+  : starts(0), count(0), capacity(0), hint(0)
+{
+  clear();
+}
+
+LineIndex::~LineIndex()
+{
+  free(starts);
+}
+
+void LineIndex::clear()
+{
+  if (!capacity)
+    grow();
+  starts[0] = 0;
+  count = 1;
+  hint = 0;
+}
+
+void LineIndex::build(const UChar *code, unsigned int length)
+{
+  clear();
+  const UChar *end = code + length;
+  for (const UChar *p = CharScan::find(code, end, '\r', '\n', '\r', '\r', '\r');
+       p != end; p = CharScan::find(p, end, '\r', '\n', '\r', '\r', '\r')) {
+    if (p->uc == '\r' && p + 1 != end && p[1].uc == '\n')
+      ++p;
+    add(++p - code);
+  }
+}
+
+int LineIndex::search(unsigned int offset) const
+{
+  // the next line is the most likely one
+  if (offset >= starts[hint]
+      && (hint + 2 == count || offset < starts[hint + 2]))
+    return ++hint + 1;
+
+  unsigned int low = 0;
+  unsigned int high = count;
+  while (high - low > 1) {
+    unsigned int middle = (low + high) / 2;
+    if (starts[middle] <= offset)
+      low = middle;
+    else
+      high = middle;
+  }
+  hint = low;
+  return low + 1;
+}
+
+void LineIndex::grow()
+{
+  const unsigned int initialCapacity = 64;
+  const unsigned int growthFactor = 2;
+  capacity = capacity ? capacity * growthFactor : initialCapacity;
+  starts = static_cast<unsigned int *>(
+      realloc(starts, capacity * sizeof(unsigned int)));
+  if (!starts)
+    throw std::bad_alloc();
+}
@@ -0,0 +1,94 @@
+// -*- c-basic-offset: 2 -*-
+/*
+ *  This file is part of the KDE libraries
+ *  Copyright (C) 2026 agent (agent@local)
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifndef _KJS_LINE_INDEX_H_
+#define _KJS_LINE_INDEX_H_
+
+#include "ustring.h"
+
+namespace KJS {
+
+  /**
+   * @short Offsets of line starts in source code.
+   *
+   * Line terminators are CR, LF and CR LF. Lines are numbered from 1 and
+   * columns from 0, the line of an offset is found by binary search. The
+   * lexer adds lines as it passes them, build() indexes the whole code at
+   * once.
+   */
+  class LineIndex {
+  public:
+    LineIndex();
+    ~LineIndex();
+
+    /**
+     * Drops all lines but the first one.
+     */
+    void clear();
+
+    /**
+     * Adds line starting at given offset, offsets not past the last
+     * line start are ignored.
+     */
+    void add(unsigned int start)
+    {
+      if (start <= starts[count - 1])
+        return;
+      if (count == capacity)
+        grow();
+      starts[count++] = start;
+    }
+
+    /**
+     * Indexes all lines of code of given length.
+     */
+    void build(const UChar *code, unsigned int length);
+
+    unsigned int size() const { return count; }
+    int line(unsigned int offset) const
+    {
+      // offsets are mostly asked in order, the last line found is tried
+      if (offset >= starts[hint]
+          && (hint + 1 == count || offset < starts[hint + 1]))
+        return hint + 1;
+      return search(offset);
+    }
+    unsigned int column(unsigned int offset) const
+      { return offset - lineStart(line(offset)); }
+    unsigned int lineStart(int line) const { return starts[line - 1]; }
+
+  private:
+    int search(unsigned int offset) const;
+    void grow();
+
+    // not copyable
+    LineIndex(const LineIndex &);
+    LineIndex &operator=(const LineIndex &);
+
+    unsigned int *starts;
+    unsigned int count;
+    unsigned int capacity;
+    mutable unsigned int hint; // index of the last line found
+  };
+
+} // namespace
+
+#endif
@@ -36,9 +36,9 @@ namespace KJS {
    */
   struct HashEntry {
     /**
-     * s is the offset to the string key (e.g. a property name)
+     * s is the string key (e.g. a property name)
      */
-    unsigned short soffset;
+    const char *s;
     /**
      * value is the result value (usually an enum value)
      */
@@ -52,48 +52,27 @@ namespace KJS {
      * denote the number of argument of the function
      */
     unsigned char params;
-    /**
-     * next is the index to the next entry for the same hash value
-     */
-    short next;
   };
 
   /**
    * A hash table
-   * Usually the hashtable is generated by the create_hash_table script, from a .table file.
-   *
-   * The implementation uses an array of entries, "size" is the total size of that array.
-   * The entries between 0 and hashSize-1 are the entry points
-   * for each hash value, and the entries between hashSize and size-1
-   * are the overflow entries for the hash values that need one.
-   * The "next" pointer of the entry links entry points to overflow entries,
-   * and links overflow entries between them.
+   * Defined by KJS_HASH_TABLE from an array of entries, the compiler builds
+   * a PerfectHash of their keys.
    */
   struct HashTable {
     /**
-     * type is a version number. Currently always 2
-     */
-    int type;
-    /**
-     * size is the total number of entries in the hashtable, including the null entries,
-     * i.e. the size of the "entries" array.
+     * size is the number of entries, i.e. the size of the "entries" array.
      * Used to iterate over all entries in the table
      */
     int size;
     /**
      * pointer to the array of entries
-     * Mind that some entries in the array are null (0,0,0,0).
      */
     const HashEntry *const entries;
     /**
-     * the maximum value for the hash. Always smaller than size.
+     * find index of the key in entries, -1 if it is not there
      */
-    int hashSize;
-
-    /**
-     * pointer to the string table.
-     */
-    const char* const sbase;
+    int (*find)(const UChar *c, unsigned int len);
   };
 
   /**
@@ -113,19 +92,204 @@ namespace KJS {
      * This variant gives access to the other attributes of the entry,
      * especially the attr field.
      */
-    static const HashEntry* findEntry(const struct HashTable *table,
-                                      const Identifier &s);
     static const HashEntry* findEntry(const struct HashTable *table,
                                       const UChar *c, unsigned int len);
+    static const HashEntry* findEntry(const struct HashTable *table,
+                                      const Identifier &s);
+  };
+
+  /**
+   * @short Perfect hash table of ASCII keys, built by the compiler.
+   *
+   * Each key is hashed once. The upper half of the hash selects a bucket,
+   * the displacement of the bucket mixed with the whole hash selects the
+   * slot. Displacements are searched at compile time so that no two keys
+   * share a slot, therefore a lookup costs one hash and one compare and
+   * the table costs nothing at startup.
+   *
+   * Use it as a constexpr object:
+   * \code
+   * constexpr const char *names[] = { "foo", "bar" };
+   * constexpr PerfectHash<2> table(names);
+   * \endcode
+   * Duplicate keys make the construction fail to compile.
+   */
+  template <unsigned int count>
+  class PerfectHash {
+  public:
+    /**
+     * Build the table, keys must outlive it.
+     */
+    constexpr PerfectHash(const char *const (&names)[count])
+      : keys(), displacements(), slots()
+    {
+      for (unsigned int i = 0; i < count; i++)
+        keys[i] = names[i];
+      build();
+    }
+
+    /**
+     * Build the table of keys stored in member name of entries, find()
+     * then returns index of the entry.
+     */
+    template <class Entry>
+    constexpr PerfectHash(const Entry (&entries)[count],
+                          const char *const Entry::*name)
+      : keys(), displacements(), slots()
+    {
+      for (unsigned int i = 0; i < count; i++)
+        keys[i] = entries[i].*name;
+      build();
+    }
+
+    /**
+     * Find a key in the table.
+     * @return index of the key in the array given to the constructor or -1.
+     */
+    int find(const UChar *c, unsigned int len) const
+    {
+      unsigned long long h = hash(c, len);
+      int i = slots[slot(h, displacements[bucket(h)])];
+      if (i < 0)
+        return -1;
+      const char *s = keys[i];
+      for (unsigned int j = 0; j != len; j++, c++, s++)
+        if (c->uc != (unsigned char)*s)
+          return -1;
+      return *s? -1: i;
+    }
+    int find(const Identifier &s) const { return find(s.data(), s.size()); }
+
+    /**
+     * @return key of given index.
+     */
+    const char *key(unsigned int i) const { return keys[i]; }
 
     /**
-     * Calculate the hash value for a given key
+     * @return number of keys in the table.
      */
-    static unsigned int hash(const Identifier &key);
-    static unsigned int hash(const UChar *c, unsigned int len);
-    static unsigned int hash(const char *s);
+    static constexpr unsigned int size() { return count; }
+
+  private:
+    /**
+     * Search displacements of all buckets.
+     */
+    constexpr void build()
+    {
+      unsigned long long hashes[count] = {};
+      unsigned int bucketSizes[bucketCount] = {};
+      unsigned int maxBucketSize = 0;
+      for (unsigned int i = 0; i < count; i++) {
+        hashes[i] = hash(keys[i]);
+        unsigned int size = ++bucketSizes[bucket(hashes[i])];
+        if (size > maxBucketSize)
+          maxBucketSize = size;
+      }
+      for (unsigned int i = 0; i < slotCount; i++)
+        slots[i] = -1;
+
+      // place the biggest buckets first, they are the hardest to fit
+      for (unsigned int size = maxBucketSize; size > 0; size--)
+        for (unsigned int b = 0; b < bucketCount; b++)
+          if (bucketSizes[b] == size)
+            place(b, hashes);
+    }
+
+    /**
+     * Number of slots, the least power of two holding twice as many keys.
+     */
+    static constexpr unsigned int slotBits()
+    {
+      unsigned int bits = 1;
+      while ((1u << bits) < 2 * count)
+        bits++;
+      return bits;
+    }
+    static constexpr unsigned int slotCount = 1u << slotBits();
+    static constexpr unsigned int bucketCount = count / 2 + 1;
+
+    /**
+     * 64 bit FNV-1a of the key, the same for ASCII and UChar keys.
+     */
+    static constexpr unsigned long long hash(const char *s)
+    {
+      unsigned long long h = 14695981039346656037ull;
+      for (; *s; s++)
+        h = (h ^ (unsigned char)*s) * 1099511628211ull;
+      return h;
+    }
+    static unsigned long long hash(const UChar *c, unsigned int len)
+    {
+      unsigned long long h = 14695981039346656037ull;
+      for (const UChar *end = c + len; c != end; c++)
+        h = (h ^ c->uc) * 1099511628211ull;
+      return h;
+    }
+
+    static constexpr unsigned int bucket(unsigned long long h)
+    {
+      return (h >> 32) % bucketCount;
+    }
+    static constexpr unsigned int slot(unsigned long long h, unsigned int d)
+    {
+      return ((h ^ (d * 0x9e3779b97f4a7c15ull)) * 0xff51afd7ed558ccdull)
+        >> (64 - slotBits());
+    }
+
+    /**
+     * Find the first displacement moving all keys of the bucket to free
+     * slots and occupy them.
+     */
+    constexpr void place(unsigned int b, const unsigned long long *hashes)
+    {
+      for (unsigned int d = 0; d < 65536; d++) {
+        bool fits = true;
+        for (unsigned int i = 0; fits && i < count; i++) {
+          if (bucket(hashes[i]) != b)
+            continue;
+          unsigned int s = slot(hashes[i], d);
+          if (slots[s] >= 0)
+            fits = false;
+          // two keys of the bucket must not meet either
+          for (unsigned int j = 0; fits && j < i; j++)
+            if (bucket(hashes[j]) == b && slot(hashes[j], d) == s)
+              fits = false;
+        }
+        if (!fits)
+          continue;
+        displacements[b] = d;
+        for (unsigned int i = 0; i < count; i++)
+          if (bucket(hashes[i]) == b)
+            slots[slot(hashes[i], d)] = i;
+        return;
+      }
+      throw "PerfectHash: no displacement found (duplicate key?)";
+    }
+
+    const char *keys[count];
+    unsigned int displacements[bucketCount];
+    short slots[slotCount];
   };
 
+  /**
+   * @internal
+   * HashTable::find of a table defined by KJS_HASH_TABLE
+   */
+  template <unsigned int count, const PerfectHash<count> &hash>
+  int findInPerfectHash(const UChar *c, unsigned int len)
+  {
+    return hash.find(c, len);
+  }
+
+/**
+ * Define HashTable name of the constexpr HashEntry array nameEntries.
+ */
+#define KJS_HASH_TABLE(name) \
+  static constexpr PerfectHash<sizeof(name##Entries) / sizeof(*name##Entries)> \
+    name##Hash(name##Entries, &HashEntry::s); \
+  const HashTable name = { sizeof(name##Entries) / sizeof(*name##Entries), \
+    name##Entries, findInPerfectHash<name##Hash.size(), name##Hash> }
+
   class ExecState;
   class UString;
   /**
@@ -386,9 +550,8 @@ namespace KJS {
 
   /*
    * List of things to do when porting an objectimp to the 'static hashtable' mechanism:
-   * - write the hashtable source, between @begin and @end
-   * - add a rule to build the .lut.h
-   * - include the .lut.h
+   * - write the constexpr HashEntry array nameEntries
+   * - define the table with KJS_HASH_TABLE(name)
    * - mention the table in the classinfo (add a classinfo if necessary)
    * - write/update the class enum (for the tokens)
    * - turn get() into getValueProperty(), put() into putValueProperty(), using a switch and removing funcs
@@ -32,7 +32,7 @@
 #include "operations.h"
 #include "math_object.h"
 
-#include "math_object.lut.h"
+#include "lookup.h"
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -46,38 +46,38 @@ using namespace KJS;
 
 // ------------------------------ MathObjectImp --------------------------------
 
+static constexpr HashEntry mathTableEntries[] = {
+  { "E",       MathObjectImp::Euler,   DontEnum|DontDelete|ReadOnly, 0 },
+  { "LN2",     MathObjectImp::Ln2,     DontEnum|DontDelete|ReadOnly, 0 },
+  { "LN10",    MathObjectImp::Ln10,    DontEnum|DontDelete|ReadOnly, 0 },
+  { "LOG2E",   MathObjectImp::Log2E,   DontEnum|DontDelete|ReadOnly, 0 },
+  { "LOG10E",  MathObjectImp::Log10E,  DontEnum|DontDelete|ReadOnly, 0 },
+  { "PI",      MathObjectImp::Pi,      DontEnum|DontDelete|ReadOnly, 0 },
+  { "SQRT1_2", MathObjectImp::Sqrt1_2, DontEnum|DontDelete|ReadOnly, 0 },
+  { "SQRT2",   MathObjectImp::Sqrt2,   DontEnum|DontDelete|ReadOnly, 0 },
+  { "abs",     MathObjectImp::Abs,     DontEnum|Function, 1 },
+  { "acos",    MathObjectImp::ACos,    DontEnum|Function, 1 },
+  { "asin",    MathObjectImp::ASin,    DontEnum|Function, 1 },
+  { "atan",    MathObjectImp::ATan,    DontEnum|Function, 1 },
+  { "atan2",   MathObjectImp::ATan2,   DontEnum|Function, 2 },
+  { "ceil",    MathObjectImp::Ceil,    DontEnum|Function, 1 },
+  { "cos",     MathObjectImp::Cos,     DontEnum|Function, 1 },
+  { "exp",     MathObjectImp::Exp,     DontEnum|Function, 1 },
+  { "floor",   MathObjectImp::Floor,   DontEnum|Function, 1 },
+  { "log",     MathObjectImp::Log,     DontEnum|Function, 1 },
+  { "max",     MathObjectImp::Max,     DontEnum|Function, 2 },
+  { "min",     MathObjectImp::Min,     DontEnum|Function, 2 },
+  { "pow",     MathObjectImp::Pow,     DontEnum|Function, 2 },
+  { "random",  MathObjectImp::Random,  DontEnum|Function, 0 },
+  { "round",   MathObjectImp::Round,   DontEnum|Function, 1 },
+  { "sin",     MathObjectImp::Sin,     DontEnum|Function, 1 },
+  { "sqrt",    MathObjectImp::Sqrt,    DontEnum|Function, 1 },
+  { "tan",     MathObjectImp::Tan,     DontEnum|Function, 1 }
+};
+KJS_HASH_TABLE(mathTable);
+
 const ClassInfo MathObjectImp::info = { "Math", 0, &mathTable, 0 };
 
-/* Source for math_object.lut.h
-@begin mathTable 31
-  E             MathObjectImp::Euler    DontEnum|DontDelete|ReadOnly
-  LN2           MathObjectImp::Ln2      DontEnum|DontDelete|ReadOnly
-  LN10          MathObjectImp::Ln10     DontEnum|DontDelete|ReadOnly
-  LOG2E         MathObjectImp::Log2E    DontEnum|DontDelete|ReadOnly
-  LOG10E        MathObjectImp::Log10E   DontEnum|DontDelete|ReadOnly
-  PI            MathObjectImp::Pi       DontEnum|DontDelete|ReadOnly
-  SQRT1_2       MathObjectImp::Sqrt1_2  DontEnum|DontDelete|ReadOnly
-  SQRT2         MathObjectImp::Sqrt2    DontEnum|DontDelete|ReadOnly
-  abs           MathObjectImp::Abs      DontEnum|Function 1
-  acos          MathObjectImp::ACos     DontEnum|Function 1
-  asin          MathObjectImp::ASin     DontEnum|Function 1
-  atan          MathObjectImp::ATan     DontEnum|Function 1
-  atan2         MathObjectImp::ATan2    DontEnum|Function 2
-  ceil          MathObjectImp::Ceil     DontEnum|Function 1
-  cos           MathObjectImp::Cos      DontEnum|Function 1
-  exp           MathObjectImp::Exp      DontEnum|Function 1
-  floor         MathObjectImp::Floor    DontEnum|Function 1
-  log           MathObjectImp::Log      DontEnum|Function 1
-  max           MathObjectImp::Max      DontEnum|Function 2
-  min           MathObjectImp::Min      DontEnum|Function 2
-  pow           MathObjectImp::Pow      DontEnum|Function 2
-  random        MathObjectImp::Random   DontEnum|Function 0
-  round         MathObjectImp::Round    DontEnum|Function 1
-  sin           MathObjectImp::Sin      DontEnum|Function 1
-  sqrt          MathObjectImp::Sqrt     DontEnum|Function 1
-  tan           MathObjectImp::Tan      DontEnum|Function 1
-@end
-*/
 
 MathObjectImp::MathObjectImp(ExecState * /*exec*/,
                              ObjectPrototypeImp *objProto)
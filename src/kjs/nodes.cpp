@@ -97,10 +97,15 @@ std::list<Node *> * Node::s_nodes = 0L;
 
 // ----------------------------- Node -----------------------------------------
 
-Node::Node()
+Node::Node(NodeKind k)
+  : knd(k)
 {
-  line = Lexer::curr()->lineNo();
+  // nodes are created by the parser running in this thread
+  Lexer *lexer = Lexer::curr();
+  line = lexer ? lexer->lineNo() : -1;
+#ifndef KJS_COMPRESSOR
   refcount = 0;
+#endif
 #ifdef KJS_DEBUG_MEM
   if (!s_nodes)
     s_nodes = new std::list<Node *>;
@@ -115,6 +120,25 @@ Node::~Node()
 #endif
 }
 
+static void destroyNode(void *p)
+{
+  static_cast<Node *>(p)->~Node();
+}
+
+void *Node::operator new(size_t size)
+{
+  // the parse running in this thread may own an arena for its nodes
+  Lexer *lexer = Lexer::curr();
+  Arena *arena = lexer ? lexer->nodeArena() : 0;
+  return arena ? arena->allocate(size, destroyNode) : Arena::allocateHeap(size);
+}
+
+void Node::operator delete(void *p)
+{
+  // memory of the arena goes back with the arena only
+  Arena::release(p);
+}
+
 Reference Node::evaluateReference(ExecState *exec) const
 {
   Value v = evaluate(exec);
@@ -215,14 +239,17 @@ void Node::setExceptionDetailsIfNeeded(ExecState *exec) const
 }
 
 // ----------------------------- StatementNode --------------------------------
-StatementNode::StatementNode() : l0(-1), l1(-1), sourceCode(0), breakPoint(false)
+StatementNode::StatementNode(NodeKind k)
+  : Node(k), l0(-1), l1(-1), sourceCode(0), breakPoint(false)
 {
 }
 
 StatementNode::~StatementNode()
 {
+#ifndef KJS_COMPRESSOR
   if (sourceCode)
     sourceCode->deref();
+#endif
 }
 
 void StatementNode::setLoc(int line0, int line1, SourceCode *src)
@@ -230,12 +257,17 @@ void StatementNode::setLoc(int line0, int line1, SourceCode *src)
   // ### require these to be passed to the constructor
   l0 = line0;
   l1 = line1;
+#ifdef KJS_COMPRESSOR
+  // the source is owned by the caller of the parser, not by the tree
+  sourceCode = src;
+#else
   if (sourceCode != src) {
     if (sourceCode)
       sourceCode->deref();
     sourceCode = src;
     sourceCode->ref();
   }
+#endif
 }
 
 // return true if the debugger wants us to stop at this point
@@ -415,6 +447,7 @@ Reference ResolveNode::evaluateReference(ExecState *exec) const
 
 // ----------------------------- GroupNode ------------------------------------
 
+#ifndef KJS_COMPRESSOR
 void GroupNode::ref()
 {
   Node::ref();
@@ -428,6 +461,7 @@ bool GroupNode::deref()
     delete group;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.1.6
 Value GroupNode::evaluate(ExecState *exec) const
@@ -442,6 +476,7 @@ Reference GroupNode::evaluateReference(ExecState *exec) const
 
 // ----------------------------- ElementNode ----------------------------------
 
+#ifndef KJS_COMPRESSOR
 void ElementNode::ref()
 {
   for (ElementNode *n = this; n; n = n->list) {
@@ -463,6 +498,7 @@ bool ElementNode::deref()
   }
   return Node::deref();
 }
+#endif
 
 // ECMA 11.1.4
 Value ElementNode::evaluate(ExecState *exec) const
@@ -480,6 +516,7 @@ Value ElementNode::evaluate(ExecState *exec) const
 
 // ----------------------------- ArrayNode ------------------------------------
 
+#ifndef KJS_COMPRESSOR
 void ArrayNode::ref()
 {
   Node::ref();
@@ -493,6 +530,7 @@ bool ArrayNode::deref()
     delete element;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.1.4
 Value ArrayNode::evaluate(ExecState *exec) const
@@ -518,6 +556,7 @@ Value ArrayNode::evaluate(ExecState *exec) const
 
 // ----------------------------- ObjectLiteralNode ----------------------------
 
+#ifndef KJS_COMPRESSOR
 void ObjectLiteralNode::ref()
 {
   Node::ref();
@@ -531,6 +570,7 @@ bool ObjectLiteralNode::deref()
     delete list;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.1.5
 Value ObjectLiteralNode::evaluate(ExecState *exec) const
@@ -543,6 +583,7 @@ Value ObjectLiteralNode::evaluate(ExecState *exec) const
 
 // ----------------------------- PropertyValueNode ----------------------------
 
+#ifndef KJS_COMPRESSOR
 void PropertyValueNode::ref()
 {
   for (PropertyValueNode *n = this; n; n = n->list) {
@@ -568,6 +609,7 @@ bool PropertyValueNode::deref()
   }
   return Node::deref();
 }
+#endif
 
 // ECMA 11.1.5
 Value PropertyValueNode::evaluate(ExecState *exec) const
@@ -604,6 +646,7 @@ Value PropertyNode::evaluate(ExecState * /*exec*/) const
 
 // ----------------------------- AccessorNode1 --------------------------------
 
+#ifndef KJS_COMPRESSOR
 void AccessorNode1::ref()
 {
   Node::ref();
@@ -621,6 +664,7 @@ bool AccessorNode1::deref()
     delete expr2;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.2.1a
 Reference AccessorNode1::evaluateReference(ExecState *exec) const
@@ -648,6 +692,7 @@ Reference AccessorNode1::evaluateReference(ExecState *exec) const
 
 // ----------------------------- AccessorNode2 --------------------------------
 
+#ifndef KJS_COMPRESSOR
 void AccessorNode2::ref()
 {
   Node::ref();
@@ -661,6 +706,7 @@ bool AccessorNode2::deref()
     delete expr;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.2.1b
 Reference AccessorNode2::evaluateReference(ExecState *exec) const
@@ -683,6 +729,7 @@ Reference AccessorNode2::evaluateReference(ExecState *exec) const
 
 // ----------------------------- ArgumentListNode -----------------------------
 
+#ifndef KJS_COMPRESSOR
 void ArgumentListNode::ref()
 {
   for (ArgumentListNode *n = this; n; n = n->list) {
@@ -704,6 +751,7 @@ bool ArgumentListNode::deref()
   }
   return Node::deref();
 }
+#endif
 
 Value ArgumentListNode::evaluate(ExecState * /*exec*/) const
 {
@@ -727,6 +775,7 @@ List ArgumentListNode::evaluateList(ExecState *exec) const
 
 // ----------------------------- ArgumentsNode --------------------------------
 
+#ifndef KJS_COMPRESSOR
 void ArgumentsNode::ref()
 {
   Node::ref();
@@ -740,6 +789,7 @@ bool ArgumentsNode::deref()
     delete list;
   return Node::deref();
 }
+#endif
 
 Value ArgumentsNode::evaluate(ExecState * /*exec*/) const
 {
@@ -760,6 +810,7 @@ List ArgumentsNode::evaluateList(ExecState *exec) const
 
 // ECMA 11.2.2
 
+#ifndef KJS_COMPRESSOR
 void NewExprNode::ref()
 {
   Node::ref();
@@ -777,6 +828,7 @@ bool NewExprNode::deref()
     delete args;
   return Node::deref();
 }
+#endif
 
 Value NewExprNode::evaluate(ExecState *exec) const
 {
@@ -805,6 +857,7 @@ Value NewExprNode::evaluate(ExecState *exec) const
 
 // ----------------------------- FunctionCallNode -----------------------------
 
+#ifndef KJS_COMPRESSOR
 void FunctionCallNode::ref()
 {
   Node::ref();
@@ -822,6 +875,7 @@ bool FunctionCallNode::deref()
     delete args;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.2.3
 Value FunctionCallNode::evaluate(ExecState *exec) const
@@ -874,6 +928,7 @@ Value FunctionCallNode::evaluate(ExecState *exec) const
 
 // ----------------------------- PostfixNode ----------------------------------
 
+#ifndef KJS_COMPRESSOR
 void PostfixNode::ref()
 {
   Node::ref();
@@ -887,6 +942,7 @@ bool PostfixNode::deref()
     delete expr;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.3
 Value PostfixNode::evaluate(ExecState *exec) const
@@ -905,6 +961,7 @@ Value PostfixNode::evaluate(ExecState *exec) const
 
 // ----------------------------- DeleteNode -----------------------------------
 
+#ifndef KJS_COMPRESSOR
 void DeleteNode::ref()
 {
   Node::ref();
@@ -918,6 +975,7 @@ bool DeleteNode::deref()
     delete expr;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.4.1
 Value DeleteNode::evaluate(ExecState *exec) const
@@ -929,6 +987,7 @@ Value DeleteNode::evaluate(ExecState *exec) const
 
 // ----------------------------- VoidNode -------------------------------------
 
+#ifndef KJS_COMPRESSOR
 void VoidNode::ref()
 {
   Node::ref();
@@ -942,6 +1001,7 @@ bool VoidNode::deref()
     delete expr;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.4.2
 Value VoidNode::evaluate(ExecState *exec) const
@@ -954,6 +1014,7 @@ Value VoidNode::evaluate(ExecState *exec) const
 
 // ----------------------------- TypeOfNode -----------------------------------
 
+#ifndef KJS_COMPRESSOR
 void TypeOfNode::ref()
 {
   Node::ref();
@@ -967,6 +1028,7 @@ bool TypeOfNode::deref()
     delete expr;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.4.3
 Value TypeOfNode::evaluate(ExecState *exec) const
@@ -1010,6 +1072,7 @@ Value TypeOfNode::evaluate(ExecState *exec) const
 
 // ----------------------------- PrefixNode -----------------------------------
 
+#ifndef KJS_COMPRESSOR
 void PrefixNode::ref()
 {
   Node::ref();
@@ -1023,6 +1086,7 @@ bool PrefixNode::deref()
     delete expr;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.4.4 and 11.4.5
 Value PrefixNode::evaluate(ExecState *exec) const
@@ -1042,6 +1106,7 @@ Value PrefixNode::evaluate(ExecState *exec) const
 
 // ----------------------------- UnaryPlusNode --------------------------------
 
+#ifndef KJS_COMPRESSOR
 void UnaryPlusNode::ref()
 {
   Node::ref();
@@ -1055,6 +1120,7 @@ bool UnaryPlusNode::deref()
     delete expr;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.4.6
 double UnaryPlusNode::toNumber(ExecState *exec) const
@@ -1073,6 +1139,7 @@ Value UnaryPlusNode::evaluate(ExecState *exec) const
 
 // ----------------------------- NegateNode -----------------------------------
 
+#ifndef KJS_COMPRESSOR
 void NegateNode::ref()
 {
   Node::ref();
@@ -1086,6 +1153,7 @@ bool NegateNode::deref()
     delete expr;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.4.7
 double NegateNode::toNumber(ExecState *exec) const
@@ -1104,6 +1172,7 @@ Value NegateNode::evaluate(ExecState *exec) const
 
 // ----------------------------- BitwiseNotNode -------------------------------
 
+#ifndef KJS_COMPRESSOR
 void BitwiseNotNode::ref()
 {
   Node::ref();
@@ -1117,6 +1186,7 @@ bool BitwiseNotNode::deref()
     delete expr;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.4.8
 Value BitwiseNotNode::evaluate(ExecState *exec) const
@@ -1130,6 +1200,7 @@ Value BitwiseNotNode::evaluate(ExecState *exec) const
 
 // ----------------------------- LogicalNotNode -------------------------------
 
+#ifndef KJS_COMPRESSOR
 void LogicalNotNode::ref()
 {
   Node::ref();
@@ -1143,6 +1214,7 @@ bool LogicalNotNode::deref()
     delete expr;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.4.9
 bool LogicalNotNode::toBoolean(ExecState *exec) const
@@ -1161,6 +1233,7 @@ Value LogicalNotNode::evaluate(ExecState *exec) const
 
 // ----------------------------- MultNode -------------------------------------
 
+#ifndef KJS_COMPRESSOR
 void MultNode::ref()
 {
   Node::ref();
@@ -1178,6 +1251,7 @@ bool MultNode::deref()
     delete term2;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.5
 Value MultNode::evaluate(ExecState *exec) const
@@ -1214,6 +1288,7 @@ Node* AddNode::create(Node *t1, Node *t2, char op)
   return new AddNode(t1, t2, op);
 }
 
+#ifndef KJS_COMPRESSOR
 void AddNode::ref()
 {
   Node::ref();
@@ -1231,6 +1306,7 @@ bool AddNode::deref()
     delete term2;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.6
 Value AddNode::evaluate(ExecState *exec) const
@@ -1246,6 +1322,7 @@ Value AddNode::evaluate(ExecState *exec) const
 
 // ------------------------ AddNumberNode ------------------------------------
 
+#ifndef KJS_COMPRESSOR
 void AppendStringNode::ref()
 {
   Node::ref();
@@ -1258,6 +1335,7 @@ bool AppendStringNode::deref()
     delete term;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.6 (special case of string appending)
 Value AppendStringNode::evaluate(ExecState *exec) const
@@ -1270,6 +1348,7 @@ Value AppendStringNode::evaluate(ExecState *exec) const
 
 // ----------------------------- ShiftNode ------------------------------------
 
+#ifndef KJS_COMPRESSOR
 void ShiftNode::ref()
 {
   Node::ref();
@@ -1287,6 +1366,7 @@ bool ShiftNode::deref()
     delete term2;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.7
 Value ShiftNode::evaluate(ExecState *exec) const
@@ -1313,6 +1393,7 @@ Value ShiftNode::evaluate(ExecState *exec) const
 
 // ----------------------------- RelationalNode -------------------------------
 
+#ifndef KJS_COMPRESSOR
 void RelationalNode::ref()
 {
   Node::ref();
@@ -1330,6 +1411,7 @@ bool RelationalNode::deref()
     delete expr2;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.8
 Value RelationalNode::evaluate(ExecState *exec) const
@@ -1382,6 +1464,7 @@ Value RelationalNode::evaluate(ExecState *exec) const
 
 // ----------------------------- EqualNode ------------------------------------
 
+#ifndef KJS_COMPRESSOR
 void EqualNode::ref()
 {
   Node::ref();
@@ -1399,6 +1482,7 @@ bool EqualNode::deref()
     delete expr2;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.9
 Value EqualNode::evaluate(ExecState *exec) const
@@ -1423,6 +1507,7 @@ Value EqualNode::evaluate(ExecState *exec) const
 
 // ----------------------------- BitOperNode ----------------------------------
 
+#ifndef KJS_COMPRESSOR
 void BitOperNode::ref()
 {
   Node::ref();
@@ -1440,6 +1525,7 @@ bool BitOperNode::deref()
     delete expr2;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.10
 Value BitOperNode::evaluate(ExecState *exec) const
@@ -1463,6 +1549,7 @@ Value BitOperNode::evaluate(ExecState *exec) const
 
 // ----------------------------- BinaryLogicalNode ----------------------------
 
+#ifndef KJS_COMPRESSOR
 void BinaryLogicalNode::ref()
 {
   Node::ref();
@@ -1480,6 +1567,7 @@ bool BinaryLogicalNode::deref()
     delete expr2;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.11
 Value BinaryLogicalNode::evaluate(ExecState *exec) const
@@ -1498,6 +1586,7 @@ Value BinaryLogicalNode::evaluate(ExecState *exec) const
 
 // ----------------------------- ConditionalNode ------------------------------
 
+#ifndef KJS_COMPRESSOR
 void ConditionalNode::ref()
 {
   Node::ref();
@@ -1519,6 +1608,7 @@ bool ConditionalNode::deref()
     delete logical;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.12
 Value ConditionalNode::evaluate(ExecState *exec) const
@@ -1534,6 +1624,7 @@ Value ConditionalNode::evaluate(ExecState *exec) const
 
 // ----------------------------- AssignNode -----------------------------------
 
+#ifndef KJS_COMPRESSOR
 void AssignNode::ref()
 {
   Node::ref();
@@ -1551,6 +1642,7 @@ bool AssignNode::deref()
     delete expr;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.13
 Value AssignNode::evaluate(ExecState *exec) const
@@ -1630,6 +1722,7 @@ Value AssignNode::evaluate(ExecState *exec) const
 
 // ----------------------------- CommaNode ------------------------------------
 
+#ifndef KJS_COMPRESSOR
 void CommaNode::ref()
 {
   Node::ref();
@@ -1647,6 +1740,7 @@ bool CommaNode::deref()
     delete expr2;
   return Node::deref();
 }
+#endif
 
 // ECMA 11.14
 Value CommaNode::evaluate(ExecState *exec) const
@@ -1662,18 +1756,19 @@ Value CommaNode::evaluate(ExecState *exec) const
 // ----------------------------- StatListNode ---------------------------------
 
 StatListNode::StatListNode(StatementNode *s)
-  : statement(s), list(this)
+  : StatementNode(StatListNodeKind), statement(s), list(this)
 {
   setLoc(s->firstLine(), s->lastLine(), s->code());
 }
 
 StatListNode::StatListNode(StatListNode *l, StatementNode *s)
-  : statement(s), list(l->list)
+  : StatementNode(StatListNodeKind), statement(s), list(l->list)
 {
   l->list = this;
   setLoc(l->firstLine(),s->lastLine(),l->code());
 }
 
+#ifndef KJS_COMPRESSOR
 void StatListNode::ref()
 {
   for (StatListNode *n = this; n; n = n->list) {
@@ -1695,6 +1790,7 @@ bool StatListNode::deref()
   }
   return StatementNode::deref();
 }
+#endif
 
 // ECMA 12.1
 Completion StatListNode::execute(ExecState *exec)
@@ -1740,6 +1836,7 @@ void StatListNode::processVarDecls(ExecState *exec)
 
 // ----------------------------- AssignExprNode -------------------------------
 
+#ifndef KJS_COMPRESSOR
 void AssignExprNode::ref()
 {
   Node::ref();
@@ -1753,6 +1850,7 @@ bool AssignExprNode::deref()
     delete expr;
   return Node::deref();
 }
+#endif
 
 // ECMA 12.2
 Value AssignExprNode::evaluate(ExecState *exec) const
@@ -1763,10 +1861,11 @@ Value AssignExprNode::evaluate(ExecState *exec) const
 // ----------------------------- VarDeclNode ----------------------------------
 
 VarDeclNode::VarDeclNode(const Identifier &id, AssignExprNode *in, Type t)
-    : varType(t), ident(id), init(in)
+    : Node(VarDeclNodeKind), varType(t), ident(id), init(in)
 {
 }
 
+#ifndef KJS_COMPRESSOR
 void VarDeclNode::ref()
 {
   Node::ref();
@@ -1780,6 +1879,7 @@ bool VarDeclNode::deref()
     delete init;
   return Node::deref();
 }
+#endif
 
 // ECMA 12.2
 Value VarDeclNode::evaluate(ExecState *exec) const
@@ -1833,6 +1933,7 @@ void VarDeclNode::processVarDecls(ExecState *exec)
 
 // ----------------------------- VarDeclListNode ------------------------------
 
+#ifndef KJS_COMPRESSOR
 void VarDeclListNode::ref()
 {
   for (VarDeclListNode *n = this; n; n = n->list) {
@@ -1854,6 +1955,7 @@ bool VarDeclListNode::deref()
   }
   return Node::deref();
 }
+#endif
 
 
 // ECMA 12.2
@@ -1874,6 +1976,7 @@ void VarDeclListNode::processVarDecls(ExecState *exec)
 
 // ----------------------------- VarStatementNode -----------------------------
 
+#ifndef KJS_COMPRESSOR
 void VarStatementNode::ref()
 {
   StatementNode::ref();
@@ -1887,6 +1990,7 @@ bool VarStatementNode::deref()
     delete list;
   return StatementNode::deref();
 }
+#endif
 
 // ECMA 12.2
 Completion VarStatementNode::execute(ExecState *exec)
@@ -1906,7 +2010,8 @@ void VarStatementNode::processVarDecls(ExecState *exec)
 
 // ----------------------------- BlockNode ------------------------------------
 
-BlockNode::BlockNode(SourceElementsNode *s)
+BlockNode::BlockNode(SourceElementsNode *s, NodeKind k)
+  : StatementNode(k)
 {
   if (s) {
     source = s->elements;
@@ -1917,6 +2022,7 @@ BlockNode::BlockNode(SourceElementsNode *s)
   }
 }
 
+#ifndef KJS_COMPRESSOR
 void BlockNode::ref()
 {
   StatementNode::ref();
@@ -1930,6 +2036,7 @@ bool BlockNode::deref()
     delete source;
   return StatementNode::deref();
 }
+#endif
 
 // ECMA 12.1
 Completion BlockNode::execute(ExecState *exec)
@@ -1958,6 +2065,7 @@ Completion EmptyStatementNode::execute(ExecState * /*exec*/)
 
 // ----------------------------- ExprStatementNode ----------------------------
 
+#ifndef KJS_COMPRESSOR
 void ExprStatementNode::ref()
 {
   StatementNode::ref();
@@ -1971,6 +2079,7 @@ bool ExprStatementNode::deref()
     delete expr;
   return StatementNode::deref();
 }
+#endif
 
 // ECMA 12.4
 Completion ExprStatementNode::execute(ExecState *exec)
@@ -1985,6 +2094,7 @@ Completion ExprStatementNode::execute(ExecState *exec)
 
 // ----------------------------- IfNode ---------------------------------------
 
+#ifndef KJS_COMPRESSOR
 void IfNode::ref()
 {
   StatementNode::ref();
@@ -2006,6 +2116,7 @@ bool IfNode::deref()
     delete expr;
   return StatementNode::deref();
 }
+#endif
 
 // ECMA 12.5
 Completion IfNode::execute(ExecState *exec)
@@ -2038,6 +2149,7 @@ void IfNode::processVarDecls(ExecState *exec)
 
 // ----------------------------- DoWhileNode ----------------------------------
 
+#ifndef KJS_COMPRESSOR
 void DoWhileNode::ref()
 {
   StatementNode::ref();
@@ -2055,6 +2167,7 @@ bool DoWhileNode::deref()
     delete expr;
   return StatementNode::deref();
 }
+#endif
 
 // ECMA 12.6.1
 Completion DoWhileNode::execute(ExecState *exec)
@@ -2092,6 +2205,7 @@ void DoWhileNode::processVarDecls(ExecState *exec)
 
 // ----------------------------- WhileNode ------------------------------------
 
+#ifndef KJS_COMPRESSOR
 void WhileNode::ref()
 {
   StatementNode::ref();
@@ -2109,6 +2223,7 @@ bool WhileNode::deref()
     delete expr;
   return StatementNode::deref();
 }
+#endif
 
 // ECMA 12.6.2
 Completion WhileNode::execute(ExecState *exec)
@@ -2150,6 +2265,7 @@ void WhileNode::processVarDecls(ExecState *exec)
 
 // ----------------------------- ForNode --------------------------------------
 
+#ifndef KJS_COMPRESSOR
 void ForNode::ref()
 {
   StatementNode::ref();
@@ -2175,6 +2291,7 @@ bool ForNode::deref()
     delete expr3;
   return StatementNode::deref();
 }
+#endif
 
 // ECMA 12.6.3
 Completion ForNode::execute(ExecState *exec)
@@ -2224,18 +2341,19 @@ void ForNode::processVarDecls(ExecState *exec)
 // ----------------------------- ForInNode ------------------------------------
 
 ForInNode::ForInNode(Node *l, Node *e, StatementNode *s)
-  : init(0L), lexpr(l), expr(e), varDecl(0L), statement(s)
+  : StatementNode(ForInNodeKind), init(0L), lexpr(l), expr(e), varDecl(0L), statement(s)
 {
 }
 
 ForInNode::ForInNode(const Identifier &i, AssignExprNode *in, Node *e, StatementNode *s)
-  : ident(i), init(in), expr(e), statement(s)
+  : StatementNode(ForInNodeKind), ident(i), init(in), expr(e), statement(s)
 {
   // for( var foo = bar in baz )
   varDecl = new VarDeclNode(ident, init, VarDeclNode::Variable);
   lexpr = new ResolveNode(ident);
 }
 
+#ifndef KJS_COMPRESSOR
 void ForInNode::ref()
 {
   StatementNode::ref();
@@ -2265,6 +2383,7 @@ bool ForInNode::deref()
     delete varDecl;
   return StatementNode::deref();
 }
+#endif
 
 // ECMA 12.6.4
 Completion ForInNode::execute(ExecState *exec)
@@ -2371,6 +2490,7 @@ Completion BreakNode::execute(ExecState *exec)
 
 // ----------------------------- ReturnNode -----------------------------------
 
+#ifndef KJS_COMPRESSOR
 void ReturnNode::ref()
 {
   StatementNode::ref();
@@ -2384,6 +2504,7 @@ bool ReturnNode::deref()
     delete value;
   return StatementNode::deref();
 }
+#endif
 
 // ECMA 12.9
 Completion ReturnNode::execute(ExecState *exec)
@@ -2406,6 +2527,7 @@ Completion ReturnNode::execute(ExecState *exec)
 
 // ----------------------------- WithNode -------------------------------------
 
+#ifndef KJS_COMPRESSOR
 void WithNode::ref()
 {
   StatementNode::ref();
@@ -2423,6 +2545,7 @@ bool WithNode::deref()
     delete expr;
   return StatementNode::deref();
 }
+#endif
 
 // ECMA 12.10
 Completion WithNode::execute(ExecState *exec)
@@ -2447,6 +2570,7 @@ void WithNode::processVarDecls(ExecState *exec)
 
 // ----------------------------- CaseClauseNode -------------------------------
 
+#ifndef KJS_COMPRESSOR
 void CaseClauseNode::ref()
 {
   Node::ref();
@@ -2464,6 +2588,7 @@ bool CaseClauseNode::deref()
     delete list;
   return Node::deref();
 }
+#endif
 
 // ECMA 12.11
 Value CaseClauseNode::evaluate(ExecState *exec) const
@@ -2491,6 +2616,7 @@ void CaseClauseNode::processVarDecls(ExecState *exec)
 
 // ----------------------------- ClauseListNode -------------------------------
 
+#ifndef KJS_COMPRESSOR
 void ClauseListNode::ref()
 {
   for (ClauseListNode *n = this; n; n = n->nx) {
@@ -2512,6 +2638,7 @@ bool ClauseListNode::deref()
   }
   return Node::deref();
 }
+#endif
 
 Value ClauseListNode::evaluate(ExecState * /*exec*/) const
 {
@@ -2532,6 +2659,7 @@ void ClauseListNode::processVarDecls(ExecState *exec)
 
 CaseBlockNode::CaseBlockNode(ClauseListNode *l1, CaseClauseNode *d,
                              ClauseListNode *l2)
+  : Node(CaseBlockNodeKind)
 {
   def = d;
   if (l1) {
@@ -2548,6 +2676,7 @@ CaseBlockNode::CaseBlockNode(ClauseListNode *l1, CaseClauseNode *d,
   }
 }
 
+#ifndef KJS_COMPRESSOR
 void CaseBlockNode::ref()
 {
   Node::ref();
@@ -2569,6 +2698,7 @@ bool CaseBlockNode::deref()
     delete list2;
   return Node::deref();
 }
+#endif
 
 Value CaseBlockNode::evaluate(ExecState * /*exec*/) const
 {
@@ -2651,6 +2781,7 @@ void CaseBlockNode::processVarDecls(ExecState *exec)
 
 // ----------------------------- SwitchNode -----------------------------------
 
+#ifndef KJS_COMPRESSOR
 void SwitchNode::ref()
 {
   StatementNode::ref();
@@ -2668,6 +2799,7 @@ bool SwitchNode::deref()
     delete block;
   return StatementNode::deref();
 }
+#endif
 
 // ECMA 12.11
 Completion SwitchNode::execute(ExecState *exec)
@@ -2693,6 +2825,7 @@ void SwitchNode::processVarDecls(ExecState *exec)
 
 // ----------------------------- LabelNode ------------------------------------
 
+#ifndef KJS_COMPRESSOR
 void LabelNode::ref()
 {
   StatementNode::ref();
@@ -2706,6 +2839,7 @@ bool LabelNode::deref()
     delete statement;
   return StatementNode::deref();
 }
+#endif
 
 // ECMA 12.12
 Completion LabelNode::execute(ExecState *exec)
@@ -2732,6 +2866,7 @@ void LabelNode::processVarDecls(ExecState *exec)
 
 // ----------------------------- ThrowNode ------------------------------------
 
+#ifndef KJS_COMPRESSOR
 void ThrowNode::ref()
 {
   StatementNode::ref();
@@ -2745,6 +2880,7 @@ bool ThrowNode::deref()
     delete expr;
   return StatementNode::deref();
 }
+#endif
 
 // ECMA 12.13
 Completion ThrowNode::execute(ExecState *exec)
@@ -2766,6 +2902,7 @@ Completion ThrowNode::execute(ExecState *exec)
 
 // ----------------------------- CatchNode ------------------------------------
 
+#ifndef KJS_COMPRESSOR
 void CatchNode::ref()
 {
   StatementNode::ref();
@@ -2779,6 +2916,7 @@ bool CatchNode::deref()
     delete block;
   return StatementNode::deref();
 }
+#endif
 
 Completion CatchNode::execute(ExecState * /*exec*/)
 {
@@ -2810,6 +2948,7 @@ void CatchNode::processVarDecls(ExecState *exec)
 
 // ----------------------------- FinallyNode ----------------------------------
 
+#ifndef KJS_COMPRESSOR
 void FinallyNode::ref()
 {
   StatementNode::ref();
@@ -2823,6 +2962,7 @@ bool FinallyNode::deref()
     delete block;
   return StatementNode::deref();
 }
+#endif
 
 // ECMA 12.14
 Completion FinallyNode::execute(ExecState *exec)
@@ -2837,6 +2977,7 @@ void FinallyNode::processVarDecls(ExecState *exec)
 
 // ----------------------------- TryNode --------------------------------------
 
+#ifndef KJS_COMPRESSOR
 void TryNode::ref()
 {
   StatementNode::ref();
@@ -2858,6 +2999,7 @@ bool TryNode::deref()
     delete _catch;
   return StatementNode::deref();
 }
+#endif
 
 // ECMA 12.14
 Completion TryNode::execute(ExecState *exec)
@@ -2908,6 +3050,7 @@ void TryNode::processVarDecls(ExecState *exec)
 
 // ----------------------------- ParameterNode --------------------------------
 
+#ifndef KJS_COMPRESSOR
 void ParameterNode::ref()
 {
   for (ParameterNode *n = this; n; n = n->next)
@@ -2924,6 +3067,7 @@ bool ParameterNode::deref()
   }
   return Node::deref();
 }
+#endif
 
 // ECMA 13
 Value ParameterNode::evaluate(ExecState * /*exec*/) const
@@ -2935,7 +3079,7 @@ Value ParameterNode::evaluate(ExecState * /*exec*/) const
 
 
 FunctionBodyNode::FunctionBodyNode(SourceElementsNode *s)
-  : BlockNode(s)
+  : BlockNode(s, FunctionBodyNodeKind)
 {
   //fprintf(stderr,"FunctionBodyNode::FunctionBodyNode %p\n",this);
 }
@@ -2948,6 +3092,7 @@ void FunctionBodyNode::processFuncDecl(ExecState *exec)
 
 // ----------------------------- FuncDeclNode ---------------------------------
 
+#ifndef KJS_COMPRESSOR
 void FuncDeclNode::ref()
 {
   StatementNode::ref();
@@ -2965,6 +3110,7 @@ bool FuncDeclNode::deref()
     delete body;
   return StatementNode::deref();
 }
+#endif
 
 // ECMA 13
 void FuncDeclNode::processFuncDecl(ExecState *exec)
@@ -3010,6 +3156,7 @@ void FuncDeclNode::processFuncDecl(ExecState *exec)
 
 // ----------------------------- FuncExprNode ---------------------------------
 
+#ifndef KJS_COMPRESSOR
 void FuncExprNode::ref()
 {
   Node::ref();
@@ -3027,6 +3174,7 @@ bool FuncExprNode::deref()
     delete body;
   return Node::deref();
 }
+#endif
 
 
 // ECMA 13
@@ -3047,6 +3195,7 @@ Value FuncExprNode::evaluate(ExecState *exec) const
 // ----------------------------- SourceElementsNode ---------------------------
 
 SourceElementsNode::SourceElementsNode(StatementNode *s1)
+  : StatementNode(SourceElementsNodeKind)
 {
   element = s1;
   elements = this;
@@ -3054,6 +3203,7 @@ SourceElementsNode::SourceElementsNode(StatementNode *s1)
 }
 
 SourceElementsNode::SourceElementsNode(SourceElementsNode *s1, StatementNode *s2)
+  : StatementNode(SourceElementsNodeKind)
 {
   elements = s1->elements;
   s1->elements = this;
@@ -3061,6 +3211,7 @@ SourceElementsNode::SourceElementsNode(SourceElementsNode *s1, StatementNode *s2
   setLoc(s1->firstLine(), s2->lastLine(), s1->code());
 }
 
+#ifndef KJS_COMPRESSOR
 void SourceElementsNode::ref()
 {
   for (SourceElementsNode *n = this; n; n = n->elements) {
@@ -3082,6 +3233,7 @@ bool SourceElementsNode::deref()
   }
   return StatementNode::deref();
 }
+#endif
 
 // ECMA 14
 Completion SourceElementsNode::execute(ExecState *exec)
@@ -32,8 +32,8 @@
 #include <assert.h>
 #endif
 
-class CompressStream_t;
-class DeCompressStream_t;
+// the compressor dumps nodes by their kind and reads their members
+class Emitter_t;
 
 namespace KJS {
 
@@ -76,13 +76,91 @@ namespace KJS {
                   OpInstanceOf
   };
 
+  /**
+   * Kind of node, one per node class. It is set by the constructor, so
+   * code walking the tree can switch on it instead of using RTTI.
+   */
+  enum NodeKind { NoNodeKind,
+                  NullNodeKind,
+                  BooleanNodeKind,
+                  NumberNodeKind,
+                  StringNodeKind,
+                  RegExpNodeKind,
+                  ThisNodeKind,
+                  ResolveNodeKind,
+                  GroupNodeKind,
+                  ElementNodeKind,
+                  ArrayNodeKind,
+                  PropertyValueNodeKind,
+                  PropertyNodeKind,
+                  ObjectLiteralNodeKind,
+                  AccessorNode1Kind,
+                  AccessorNode2Kind,
+                  ArgumentListNodeKind,
+                  ArgumentsNodeKind,
+                  NewExprNodeKind,
+                  FunctionCallNodeKind,
+                  PostfixNodeKind,
+                  DeleteNodeKind,
+                  VoidNodeKind,
+                  TypeOfNodeKind,
+                  PrefixNodeKind,
+                  UnaryPlusNodeKind,
+                  NegateNodeKind,
+                  BitwiseNotNodeKind,
+                  LogicalNotNodeKind,
+                  MultNodeKind,
+                  AddNodeKind,
+                  AppendStringNodeKind,
+                  ShiftNodeKind,
+                  RelationalNodeKind,
+                  EqualNodeKind,
+                  BitOperNodeKind,
+                  BinaryLogicalNodeKind,
+                  ConditionalNodeKind,
+                  AssignNodeKind,
+                  CommaNodeKind,
+                  StatListNodeKind,
+                  AssignExprNodeKind,
+                  VarDeclNodeKind,
+                  VarDeclListNodeKind,
+                  VarStatementNodeKind,
+                  BlockNodeKind,
+                  EmptyStatementNodeKind,
+                  ExprStatementNodeKind,
+                  IfNodeKind,
+                  DoWhileNodeKind,
+                  WhileNodeKind,
+                  ForNodeKind,
+                  ForInNodeKind,
+                  ContinueNodeKind,
+                  BreakNodeKind,
+                  ReturnNodeKind,
+                  WithNodeKind,
+                  CaseClauseNodeKind,
+                  ClauseListNodeKind,
+                  CaseBlockNodeKind,
+                  SwitchNodeKind,
+                  LabelNodeKind,
+                  ThrowNodeKind,
+                  CatchNodeKind,
+                  FinallyNodeKind,
+                  TryNodeKind,
+                  ParameterNodeKind,
+                  FunctionBodyNodeKind,
+                  FuncDeclNodeKind,
+                  FuncExprNodeKind,
+                  SourceElementsNodeKind
+  };
+
   class Node {
   public:
-    Node();
+    Node(NodeKind k);
     virtual ~Node();
 
     // reusing Value Type here, declare new enum if required
     virtual Type type() const { return UnspecifiedType; }
+    NodeKind kind() const { return knd; }
 
     /**
      * Evaluate this node and return the result, possibly a reference.
@@ -98,12 +176,23 @@ namespace KJS {
 
     UString toCode() const;
     virtual void streamTo(SourceStream &s) const = 0;
-    virtual void streamTo(CompressStream_t &s) const = 0;
-    virtual void streamTo(DeCompressStream_t &s) const = 0;
     virtual void processVarDecls(ExecState* /*exec*/) {}
     int lineNo() const { return line; }
 
   public:
+    /**
+     * Nodes created by Parser::parse() given an arena are allocated there,
+     * the arena destroys and releases them all at once. Deleting such node
+     * destroys it only, others are freed by delete as usual.
+     */
+    static void *operator new(size_t size);
+    static void operator delete(void *p);
+
+#ifdef KJS_COMPRESSOR
+    // libkjscompress: parse trees are owned by the arena, nothing is counted
+    void ref() { }
+    bool deref() { return false; }
+#else
     // reference counting mechanism
     virtual void ref() { refcount++; }
 #ifdef KJS_DEBUG_MEM
@@ -111,6 +200,7 @@ namespace KJS {
 #else
     virtual bool deref() { return (!--refcount); }
 #endif
+#endif
 
 
 #ifdef KJS_DEBUG_MEM
@@ -123,7 +213,10 @@ namespace KJS {
     Value throwError(ExecState *exec, ErrorType e, const char *msg, Identifier label) const;
     void setExceptionDetailsIfNeeded(ExecState *exec) const;
     int line;
+    NodeKind knd;
+#ifndef KJS_COMPRESSOR
     unsigned int refcount;
+#endif
     virtual int sourceId() const { return -1; }
   private:
 #ifdef KJS_DEBUG_MEM
@@ -137,7 +230,7 @@ namespace KJS {
 
   class StatementNode : public Node {
   public:
-    StatementNode();
+    StatementNode(NodeKind k);
     virtual ~StatementNode();
     void setLoc(int line0, int line1, SourceCode *src);
     int firstLine() const { return l0; }
@@ -160,57 +253,53 @@ namespace KJS {
 
   class NullNode : public Node {
   public:
-    NullNode() {}
+    NullNode() : Node(NullNodeKind) {}
     virtual Value evaluate(ExecState *exec) const;
     virtual bool toBoolean(ExecState *exec) const;
     virtual double toNumber(ExecState *exec) const;
     virtual UString toString(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   };
 
   class BooleanNode : public Node {
   public:
-    BooleanNode(bool v) : val(v) {}
+    BooleanNode(bool v) : Node(BooleanNodeKind), val(v) {}
     virtual Type type() const { return BooleanType; }
     virtual Value evaluate(ExecState *exec) const;
     virtual bool toBoolean(ExecState *exec) const;
     virtual double toNumber(ExecState *exec) const;
     virtual UString toString(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     bool val;
   };
 
   class NumberNode : public Node {
   public:
-    NumberNode(double v) : val(v) { }
+    NumberNode(double v) : Node(NumberNodeKind), val(v) { }
     virtual Type type() const { return NumberType; }
     virtual Value evaluate(ExecState *exec) const;
     virtual bool toBoolean(ExecState *exec) const;
     virtual double toNumber(ExecState *exec) const;
     virtual UString toString(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     double val;
   };
 
   class StringNode : public Node {
   public:
-    StringNode(const UString *v) : val(*v) { }
+    StringNode(const UString &v) : Node(StringNodeKind), val(v) { }
     virtual Type type() const { return StringType; }
     virtual Value evaluate(ExecState *exec) const;
     virtual bool toBoolean(ExecState *exec) const;
     virtual double toNumber(ExecState *exec) const;
     virtual UString toString(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     UString val;
   };
@@ -218,47 +307,45 @@ namespace KJS {
   class RegExpNode : public Node {
   public:
     RegExpNode(const UString &p, const UString &f)
-      : pattern(p), flags(f) { }
+      : Node(RegExpNodeKind), pattern(p), flags(f) { }
     virtual Value evaluate(ExecState *exec) const;
     virtual bool toBoolean(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     UString pattern, flags;
   };
 
   class ThisNode : public Node {
   public:
-    ThisNode() {}
+    ThisNode() : Node(ThisNodeKind) {}
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   };
 
   class ResolveNode : public Node {
   public:
-    ResolveNode(const Identifier &s) : ident(s) { }
+    ResolveNode(const Identifier &s) : Node(ResolveNodeKind), ident(s) { }
     Reference evaluateReference(ExecState *exec) const;
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Identifier ident;
   };
 
   class GroupNode : public Node {
   public:
-    GroupNode(Node *g) : group(g) { }
+    GroupNode(Node *g) : Node(GroupNodeKind), group(g) { }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     Reference evaluateReference(ExecState *exec) const;
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *group;
   };
@@ -266,15 +353,16 @@ namespace KJS {
   class ElementNode : public Node {
   public:
     // list is circular during construction. cracked in ArrayNode ctor
-    ElementNode(int e, Node *n) : list(this), elision(e), node(n) { }
+    ElementNode(int e, Node *n) : Node(ElementNodeKind), list(this), elision(e), node(n) { }
     ElementNode(ElementNode *l, int e, Node *n)
-      : list(l->list), elision(e), node(n) { l->list = this; }
+      : Node(ElementNodeKind), list(l->list), elision(e), node(n) { l->list = this; }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     friend class ArrayNode;
     ElementNode *list;
@@ -284,17 +372,18 @@ namespace KJS {
 
   class ArrayNode : public Node {
   public:
-    ArrayNode(int e) : element(0L), elision(e), opt(true) { }
+    ArrayNode(int e) : Node(ArrayNodeKind), element(0L), elision(e), opt(true) { }
     ArrayNode(ElementNode *ele)
-      : element(ele->list), elision(0), opt(false) { ele->list = 0; }
+      : Node(ArrayNodeKind), element(ele->list), elision(0), opt(false) { ele->list = 0; }
     ArrayNode(int eli, ElementNode *ele)
-      : element(ele->list), elision(eli), opt(true) { ele->list = 0; }
+      : Node(ArrayNodeKind), element(ele->list), elision(eli), opt(true) { ele->list = 0; }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     ElementNode *element;
     int elision;
@@ -305,15 +394,16 @@ namespace KJS {
   public:
     // list is circular during construction, cut in ObjectLiteralNode ctor
     PropertyValueNode(PropertyNode *n, Node *a)
-      : name(n), assign(a), list(this) { }
+      : Node(PropertyValueNodeKind), name(n), assign(a), list(this) { }
     PropertyValueNode(PropertyNode *n, Node *a, PropertyValueNode *l)
-      : name(n), assign(a), list(l->list) { l->list = this; }
+      : Node(PropertyValueNodeKind), name(n), assign(a), list(l->list) { l->list = this; }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     friend class ObjectLiteralNode;
     PropertyNode *name;
@@ -323,12 +413,11 @@ namespace KJS {
 
   class PropertyNode : public Node {
   public:
-    PropertyNode(double d) : numeric(d) { }
-    PropertyNode(const Identifier &s) : str(s) { }
+    PropertyNode(double d) : Node(PropertyNodeKind), numeric(d) { }
+    PropertyNode(const Identifier &s) : Node(PropertyNodeKind), str(s) { }
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     double numeric;
     Identifier str;
@@ -337,28 +426,30 @@ namespace KJS {
   class ObjectLiteralNode : public Node {
   public:
     // empty literal
-    ObjectLiteralNode() : list(0) { }
+    ObjectLiteralNode() : Node(ObjectLiteralNodeKind), list(0) { }
     // l points to last list element, get and detach pointer to first one
-    ObjectLiteralNode(PropertyValueNode *l) : list(l->list) { l->list = 0; }
+    ObjectLiteralNode(PropertyValueNode *l) : Node(ObjectLiteralNodeKind), list(l->list) { l->list = 0; }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     PropertyValueNode *list;
   };
 
   class AccessorNode1 : public Node {
   public:
-    AccessorNode1(Node *e1, Node *e2) : expr1(e1), expr2(e2) {}
+    AccessorNode1(Node *e1, Node *e2) : Node(AccessorNode1Kind), expr1(e1), expr2(e2) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     Reference evaluateReference(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr1;
     Node *expr2;
@@ -366,13 +457,14 @@ namespace KJS {
 
   class AccessorNode2 : public Node {
   public:
-    AccessorNode2(Node *e, const Identifier &s) : expr(e), ident(s) { }
+    AccessorNode2(Node *e, const Identifier &s) : Node(AccessorNode2Kind), expr(e), ident(s) { }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     Reference evaluateReference(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
     Identifier ident;
@@ -381,16 +473,17 @@ namespace KJS {
   class ArgumentListNode : public Node {
   public:
     // list is circular during construction. cracked in ArgumentsNode ctor
-    ArgumentListNode(Node *e) : list(this), expr(e) {}
+    ArgumentListNode(Node *e) : Node(ArgumentListNodeKind), list(this), expr(e) {}
     ArgumentListNode(ArgumentListNode *l, Node *e)
-      : list(l->list), expr(e) { l->list = this; }
+      : Node(ArgumentListNodeKind), list(l->list), expr(e) { l->list = this; }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     List evaluateList(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     friend class ArgumentsNode;
     ArgumentListNode *list;
@@ -399,29 +492,31 @@ namespace KJS {
 
   class ArgumentsNode : public Node {
   public:
-    ArgumentsNode() : list(0) {}
-    ArgumentsNode(ArgumentListNode *l) : list(l->list) { l->list = 0; }
+    ArgumentsNode() : Node(ArgumentsNodeKind), list(0) {}
+    ArgumentsNode(ArgumentListNode *l) : Node(ArgumentsNodeKind), list(l->list) { l->list = 0; }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     List evaluateList(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     ArgumentListNode *list;
   };
 
   class NewExprNode : public Node {
   public:
-    NewExprNode(Node *e) : expr(e), args(0L) {}
-    NewExprNode(Node *e, ArgumentsNode *a) : expr(e), args(a) {}
+    NewExprNode(Node *e) : Node(NewExprNodeKind), expr(e), args(0L) {}
+    NewExprNode(Node *e, ArgumentsNode *a) : Node(NewExprNodeKind), expr(e), args(a) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
     ArgumentsNode *args;
@@ -429,13 +524,14 @@ namespace KJS {
 
   class FunctionCallNode : public Node {
   public:
-    FunctionCallNode(Node *e, ArgumentsNode *a) : expr(e), args(a) {}
+    FunctionCallNode(Node *e, ArgumentsNode *a) : Node(FunctionCallNodeKind), expr(e), args(a) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
     ArgumentsNode *args;
@@ -443,13 +539,14 @@ namespace KJS {
 
   class PostfixNode : public Node {
   public:
-    PostfixNode(Node *e, Operator o) : expr(e), oper(o) {}
+    PostfixNode(Node *e, Operator o) : Node(PostfixNodeKind), expr(e), oper(o) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
     Operator oper;
@@ -457,52 +554,56 @@ namespace KJS {
 
   class DeleteNode : public Node {
   public:
-    DeleteNode(Node *e) : expr(e) {}
+    DeleteNode(Node *e) : Node(DeleteNodeKind), expr(e) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
   };
 
   class VoidNode : public Node {
   public:
-    VoidNode(Node *e) : expr(e) {}
+    VoidNode(Node *e) : Node(VoidNodeKind), expr(e) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
   };
 
   class TypeOfNode : public Node {
   public:
-    TypeOfNode(Node *e) : expr(e) {}
+    TypeOfNode(Node *e) : Node(TypeOfNodeKind), expr(e) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
   };
 
   class PrefixNode : public Node {
   public:
-    PrefixNode(Operator o, Node *e) : oper(o), expr(e) {}
+    PrefixNode(Operator o, Node *e) : Node(PrefixNodeKind), oper(o), expr(e) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Operator oper;
     Node *expr;
@@ -510,68 +611,73 @@ namespace KJS {
 
   class UnaryPlusNode : public Node {
   public:
-    UnaryPlusNode(Node *e) : expr(e) {}
+    UnaryPlusNode(Node *e) : Node(UnaryPlusNodeKind), expr(e) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual double toNumber(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
   };
 
   class NegateNode : public Node {
   public:
-    NegateNode(Node *e) : expr(e) {}
+    NegateNode(Node *e) : Node(NegateNodeKind), expr(e) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual double toNumber(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
   };
 
   class BitwiseNotNode : public Node {
   public:
-    BitwiseNotNode(Node *e) : expr(e) {}
+    BitwiseNotNode(Node *e) : Node(BitwiseNotNodeKind), expr(e) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
   };
 
   class LogicalNotNode : public Node {
   public:
-    LogicalNotNode(Node *e) : expr(e) {}
+    LogicalNotNode(Node *e) : Node(LogicalNotNodeKind), expr(e) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual bool toBoolean(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
   };
 
   class MultNode : public Node {
   public:
-    MultNode(Node *t1, Node *t2, char op) : term1(t1), term2(t2), oper(op) {}
+    MultNode(Node *t1, Node *t2, char op) : Node(MultNodeKind), term1(t1), term2(t2), oper(op) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *term1, *term2;
     char oper;
@@ -579,16 +685,17 @@ namespace KJS {
 
   class AddNode : public Node {
   public:
-    AddNode(Node *t1, Node *t2, char op) : term1(t1), term2(t2), oper(op) {}
+    AddNode(Node *t1, Node *t2, char op) : Node(AddNodeKind), term1(t1), term2(t2), oper(op) {}
 
     static Node* create(Node *t1, Node *t2, char op);
 
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *term1, *term2;
     char oper;
@@ -596,13 +703,14 @@ namespace KJS {
 
   class AppendStringNode : public Node {
   public:
-    AppendStringNode(Node *t, const UString &s) : term(t), str(s) { }
+    AppendStringNode(Node *t, const UString &s) : Node(AppendStringNodeKind), term(t), str(s) { }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *term;
     UString str;
@@ -611,13 +719,14 @@ namespace KJS {
   class ShiftNode : public Node {
   public:
     ShiftNode(Node *t1, Operator o, Node *t2)
-      : term1(t1), term2(t2), oper(o) {}
+      : Node(ShiftNodeKind), term1(t1), term2(t2), oper(o) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *term1, *term2;
     Operator oper;
@@ -625,14 +734,15 @@ namespace KJS {
 
   class RelationalNode : public Node {
   public:
-    RelationalNode(Node *e1, Operator o, Node *e2) :
+    RelationalNode(Node *e1, Operator o, Node *e2) : Node(RelationalNodeKind),
       expr1(e1), expr2(e2), oper(o) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr1, *expr2;
     Operator oper;
@@ -641,13 +751,14 @@ namespace KJS {
   class EqualNode : public Node {
   public:
     EqualNode(Node *e1, Operator o, Node *e2)
-      : expr1(e1), expr2(e2), oper(o) {}
+      : Node(EqualNodeKind), expr1(e1), expr2(e2), oper(o) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr1, *expr2;
     Operator oper;
@@ -655,14 +766,15 @@ namespace KJS {
 
   class BitOperNode : public Node {
   public:
-    BitOperNode(Node *e1, Operator o, Node *e2) :
+    BitOperNode(Node *e1, Operator o, Node *e2) : Node(BitOperNodeKind),
       expr1(e1), expr2(e2), oper(o) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr1, *expr2;
     Operator oper;
@@ -673,14 +785,15 @@ namespace KJS {
    */
   class BinaryLogicalNode : public Node {
   public:
-    BinaryLogicalNode(Node *e1, Operator o, Node *e2) :
+    BinaryLogicalNode(Node *e1, Operator o, Node *e2) : Node(BinaryLogicalNodeKind),
       expr1(e1), expr2(e2), oper(o) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr1, *expr2;
     Operator oper;
@@ -691,27 +804,29 @@ namespace KJS {
    */
   class ConditionalNode : public Node {
   public:
-    ConditionalNode(Node *l, Node *e1, Node *e2) :
+    ConditionalNode(Node *l, Node *e1, Node *e2) : Node(ConditionalNodeKind),
       logical(l), expr1(e1), expr2(e2) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *logical, *expr1, *expr2;
   };
 
   class AssignNode : public Node {
   public:
-    AssignNode(Node *l, Operator o, Node *e) : left(l), oper(o), expr(e) {}
+    AssignNode(Node *l, Operator o, Node *e) : Node(AssignNodeKind), left(l), oper(o), expr(e) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *left;
     Operator oper;
@@ -720,13 +835,14 @@ namespace KJS {
 
   class CommaNode : public Node {
   public:
-    CommaNode(Node *e1, Node *e2) : expr1(e1), expr2(e2) {}
+    CommaNode(Node *e1, Node *e2) : Node(CommaNodeKind), expr1(e1), expr2(e2) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr1, *expr2;
   };
@@ -736,13 +852,14 @@ namespace KJS {
     // list is circular during construction. cracked in CaseClauseNode ctor
     StatListNode(StatementNode *s);
     StatListNode(StatListNode *l, StatementNode *s);
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Completion execute(ExecState *exec);
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     friend class CaseClauseNode;
     StatementNode *statement;
@@ -751,13 +868,14 @@ namespace KJS {
 
   class AssignExprNode : public Node {
   public:
-    AssignExprNode(Node *e) : expr(e) {}
+    AssignExprNode(Node *e) : Node(AssignExprNodeKind), expr(e) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
   };
@@ -766,13 +884,14 @@ namespace KJS {
   public:
     enum Type { Variable, Constant };
     VarDeclNode(const Identifier &id, AssignExprNode *in, Type t);
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Type varType;
     Identifier ident;
@@ -782,16 +901,17 @@ namespace KJS {
   class VarDeclListNode : public Node {
   public:
     // list pointer is tail of a circular list, cracked in the ForNode/VarStatementNode ctor
-    VarDeclListNode(VarDeclNode *v) : list(this), var(v) {}
+    VarDeclListNode(VarDeclNode *v) : Node(VarDeclListNodeKind), list(this), var(v) {}
     VarDeclListNode(VarDeclListNode *l, VarDeclNode *v)
-      : list(l->list), var(v) { l->list = this; }
+      : Node(VarDeclListNodeKind), list(l->list), var(v) { l->list = this; }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     friend class ForNode;
     friend class VarStatementNode;
@@ -801,50 +921,52 @@ namespace KJS {
 
   class VarStatementNode : public StatementNode {
   public:
-    VarStatementNode(VarDeclListNode *l) : list(l->list) { l->list = 0; }
+    VarStatementNode(VarDeclListNode *l) : StatementNode(VarStatementNodeKind), list(l->list) { l->list = 0; }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Completion execute(ExecState *exec);
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     VarDeclListNode *list;
   };
 
   class BlockNode : public StatementNode {
   public:
-    BlockNode(SourceElementsNode *s);
+    BlockNode(SourceElementsNode *s, NodeKind k = BlockNodeKind);
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Completion execute(ExecState *exec);
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   protected:
     SourceElementsNode *source;
   };
 
   class EmptyStatementNode : public StatementNode {
   public:
-    EmptyStatementNode() { } // debug
+    EmptyStatementNode() : StatementNode(EmptyStatementNodeKind) { } // debug
     virtual Completion execute(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   };
 
   class ExprStatementNode : public StatementNode {
   public:
-    ExprStatementNode(Node *e) : expr(e) { }
+    ExprStatementNode(Node *e) : StatementNode(ExprStatementNodeKind), expr(e) { }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Completion execute(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
   };
@@ -852,14 +974,15 @@ namespace KJS {
   class IfNode : public StatementNode {
   public:
     IfNode(Node *e, StatementNode *s1, StatementNode *s2)
-      : expr(e), statement1(s1), statement2(s2) {}
+      : StatementNode(IfNodeKind), expr(e), statement1(s1), statement2(s2) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Completion execute(ExecState *exec);
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
     StatementNode *statement1, *statement2;
@@ -867,14 +990,15 @@ namespace KJS {
 
   class DoWhileNode : public StatementNode {
   public:
-    DoWhileNode(StatementNode *s, Node *e) : statement(s), expr(e) {}
+    DoWhileNode(StatementNode *s, Node *e) : StatementNode(DoWhileNodeKind), statement(s), expr(e) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Completion execute(ExecState *exec);
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     StatementNode *statement;
     Node *expr;
@@ -882,14 +1006,15 @@ namespace KJS {
 
   class WhileNode : public StatementNode {
   public:
-    WhileNode(Node *e, StatementNode *s) : expr(e), statement(s) {}
+    WhileNode(Node *e, StatementNode *s) : StatementNode(WhileNodeKind), expr(e), statement(s) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Completion execute(ExecState *exec);
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
     StatementNode *statement;
@@ -897,17 +1022,18 @@ namespace KJS {
 
   class ForNode : public StatementNode {
   public:
-    ForNode(Node *e1, Node *e2, Node *e3, StatementNode *s) :
+    ForNode(Node *e1, Node *e2, Node *e3, StatementNode *s) : StatementNode(ForNodeKind),
       expr1(e1), expr2(e2), expr3(e3), statement(s), var(false) {}
-    ForNode(VarDeclListNode *e1, Node *e2, Node *e3, StatementNode *s) :
+    ForNode(VarDeclListNode *e1, Node *e2, Node *e3, StatementNode *s) : StatementNode(ForNodeKind),
       expr1(e1->list), expr2(e2), expr3(e3), statement(s), var(true) { e1->list = 0; }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Completion execute(ExecState *exec);
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr1, *expr2, *expr3;
     StatementNode *statement;
@@ -918,13 +1044,14 @@ namespace KJS {
   public:
     ForInNode(Node *l, Node *e, StatementNode *s);
     ForInNode(const Identifier &i, AssignExprNode *in, Node *e, StatementNode *s);
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Completion execute(ExecState *exec);
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Identifier ident;
     AssignExprNode *init;
@@ -935,51 +1062,51 @@ namespace KJS {
 
   class ContinueNode : public StatementNode {
   public:
-    ContinueNode() { }
-    ContinueNode(const Identifier &i) : ident(i) { }
+    ContinueNode() : StatementNode(ContinueNodeKind) { }
+    ContinueNode(const Identifier &i) : StatementNode(ContinueNodeKind), ident(i) { }
     virtual Completion execute(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Identifier ident;
   };
 
   class BreakNode : public StatementNode {
   public:
-    BreakNode() { }
-    BreakNode(const Identifier &i) : ident(i) { }
+    BreakNode() : StatementNode(BreakNodeKind) { }
+    BreakNode(const Identifier &i) : StatementNode(BreakNodeKind), ident(i) { }
     virtual Completion execute(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Identifier ident;
   };
 
   class ReturnNode : public StatementNode {
   public:
-    ReturnNode(Node *v) : value(v) {}
+    ReturnNode(Node *v) : StatementNode(ReturnNodeKind), value(v) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Completion execute(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *value;
   };
 
   class WithNode : public StatementNode {
   public:
-    WithNode(Node *e, StatementNode *s) : expr(e), statement(s) {}
+    WithNode(Node *e, StatementNode *s) : StatementNode(WithNodeKind), expr(e), statement(s) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Completion execute(ExecState *exec);
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
     StatementNode *statement;
@@ -987,17 +1114,18 @@ namespace KJS {
 
   class CaseClauseNode : public Node {
   public:
-    CaseClauseNode(Node *e) : expr(e), list(0) { }
+    CaseClauseNode(Node *e) : Node(CaseClauseNodeKind), expr(e), list(0) { }
     CaseClauseNode(Node *e, StatListNode *l)
-      : expr(e), list(l->list) { l->list = 0; }
+      : Node(CaseClauseNodeKind), expr(e), list(l->list) { l->list = 0; }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     Completion evalStatements(ExecState *exec) const;
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
     StatListNode *list;
@@ -1006,18 +1134,19 @@ namespace KJS {
   class ClauseListNode : public Node {
   public:
     // list is circular during construction. cracked in CaseBlockNode ctor
-    ClauseListNode(CaseClauseNode *c) : cl(c), nx(this) { }
+    ClauseListNode(CaseClauseNode *c) : Node(ClauseListNodeKind), cl(c), nx(this) { }
     ClauseListNode(ClauseListNode *n, CaseClauseNode *c)
-      : cl(c), nx(n->nx) { n->nx = this; }
+      : Node(ClauseListNodeKind), cl(c), nx(n->nx) { n->nx = this; }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     CaseClauseNode *clause() const { return cl; }
     ClauseListNode *next() const { return nx; }
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     friend class CaseBlockNode;
     CaseClauseNode *cl;
@@ -1027,14 +1156,15 @@ namespace KJS {
   class CaseBlockNode: public Node {
   public:
     CaseBlockNode(ClauseListNode *l1, CaseClauseNode *d, ClauseListNode *l2);
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     Completion evalBlock(ExecState *exec, const Value& input) const;
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     ClauseListNode *list1;
     CaseClauseNode *def;
@@ -1043,14 +1173,15 @@ namespace KJS {
 
   class SwitchNode : public StatementNode {
   public:
-    SwitchNode(Node *e, CaseBlockNode *b) : expr(e), block(b) { }
+    SwitchNode(Node *e, CaseBlockNode *b) : StatementNode(SwitchNodeKind), expr(e), block(b) { }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Completion execute(ExecState *exec);
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
     CaseBlockNode *block;
@@ -1058,14 +1189,15 @@ namespace KJS {
 
   class LabelNode : public StatementNode {
   public:
-    LabelNode(const Identifier &l, StatementNode *s) : label(l), statement(s) { }
+    LabelNode(const Identifier &l, StatementNode *s) : StatementNode(LabelNodeKind), label(l), statement(s) { }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Completion execute(ExecState *exec);
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Identifier label;
     StatementNode *statement;
@@ -1073,28 +1205,30 @@ namespace KJS {
 
   class ThrowNode : public StatementNode {
   public:
-    ThrowNode(Node *e) : expr(e) {}
+    ThrowNode(Node *e) : StatementNode(ThrowNodeKind), expr(e) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Completion execute(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Node *expr;
   };
 
   class CatchNode : public StatementNode {
   public:
-    CatchNode(const Identifier &i, StatementNode *b) : ident(i), block(b) {}
+    CatchNode(const Identifier &i, StatementNode *b) : StatementNode(CatchNodeKind), ident(i), block(b) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Completion execute(ExecState *exec);
     Completion execute(ExecState *exec, const Value &arg);
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Identifier ident;
     StatementNode *block;
@@ -1102,14 +1236,15 @@ namespace KJS {
 
   class FinallyNode : public StatementNode {
   public:
-    FinallyNode(StatementNode *b) : block(b) {}
+    FinallyNode(StatementNode *b) : StatementNode(FinallyNodeKind), block(b) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Completion execute(ExecState *exec);
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     StatementNode *block;
   };
@@ -1117,18 +1252,19 @@ namespace KJS {
   class TryNode : public StatementNode {
   public:
     TryNode(StatementNode *b, CatchNode *c)
-      : block(b), _catch(c), _final(0) {}
+      : StatementNode(TryNodeKind), block(b), _catch(c), _final(0) {}
     TryNode(StatementNode *b, FinallyNode *f)
-      : block(b), _catch(0), _final(f) {}
+      : StatementNode(TryNodeKind), block(b), _catch(0), _final(f) {}
     TryNode(StatementNode *b, CatchNode *c, FinallyNode *f)
-      : block(b), _catch(c), _final(f) {}
+      : StatementNode(TryNodeKind), block(b), _catch(c), _final(f) {}
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Completion execute(ExecState *exec);
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     StatementNode *block;
     CatchNode *_catch;
@@ -1138,17 +1274,18 @@ namespace KJS {
   class ParameterNode : public Node {
   public:
     // list is circular during construction. cracked in FuncDecl/ExprNode ctor.
-    ParameterNode(const Identifier &i) : id(i), next(this) { }
+    ParameterNode(const Identifier &i) : Node(ParameterNodeKind), id(i), next(this) { }
     ParameterNode(ParameterNode *list, const Identifier &i)
-      : id(i), next(list->next) { list->next = this; }
+      : Node(ParameterNodeKind), id(i), next(list->next) { list->next = this; }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     Identifier ident() const { return id; }
     ParameterNode *nextParam() const { return next; }
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     friend class FuncDeclNode;
     friend class FuncExprNode;
@@ -1166,17 +1303,18 @@ namespace KJS {
   class FuncDeclNode : public StatementNode {
   public:
     FuncDeclNode(const Identifier &i, FunctionBodyNode *b)
-      : ident(i), param(0), body(b) { }
+      : StatementNode(FuncDeclNodeKind), ident(i), param(0), body(b) { }
     FuncDeclNode(const Identifier &i, ParameterNode *p, FunctionBodyNode *b)
-      : ident(i), param(p->next), body(b) { p->next = 0; }
+      : StatementNode(FuncDeclNodeKind), ident(i), param(p->next), body(b) { p->next = 0; }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     Completion execute(ExecState* /*exec*/)
       { /* empty */ return Completion(); }
     void processFuncDecl(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     Identifier ident;
     ParameterNode *param;
@@ -1186,15 +1324,16 @@ namespace KJS {
   class FuncExprNode : public Node {
   public:
     FuncExprNode(FunctionBodyNode *b)
-      : param(0), body(b) { }
+      : Node(FuncExprNodeKind), param(0), body(b) { }
     FuncExprNode(ParameterNode *p, FunctionBodyNode *b)
-      : param(p->next), body(b) { p->next = 0; }
+      : Node(FuncExprNodeKind), param(p->next), body(b) { p->next = 0; }
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     virtual Value evaluate(ExecState *exec) const;
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     ParameterNode *param;
     FunctionBodyNode *body;
@@ -1206,14 +1345,15 @@ namespace KJS {
     // list is circular until cracked in BlockNode (or subclass) ctor
     SourceElementsNode(StatementNode *s1);
     SourceElementsNode(SourceElementsNode *s1, StatementNode *s2);
+#ifndef KJS_COMPRESSOR
     virtual void ref();
     virtual bool deref();
+#endif
     Completion execute(ExecState *exec);
     virtual void processFuncDecl(ExecState *exec);
     virtual void processVarDecls(ExecState *exec);
     virtual void streamTo(SourceStream &s) const;
-    virtual void streamTo(CompressStream_t &s) const;
-    virtual void streamTo(DeCompressStream_t &s) const;
+    friend class ::Emitter_t;
   private:
     friend class BlockNode;
     StatementNode *element; // 'this' element
@@ -29,7 +29,7 @@
 #include "error_object.h"
 #include "dtoa.h"
 
-#include "number_object.lut.h"
+#include "lookup.h"
 
 #include <assert.h>
 #include <math.h>
@@ -427,17 +427,17 @@ Value NumberProtoFuncImp::call(ExecState *exec, Object &thisObj, const List &arg
 
 // ------------------------------ NumberObjectImp ------------------------------
 
+static constexpr HashEntry numberTableEntries[] = {
+  { "NaN",               NumberObjectImp::NaNValue,    DontEnum|DontDelete|ReadOnly, 0 },
+  { "NEGATIVE_INFINITY", NumberObjectImp::NegInfinity, DontEnum|DontDelete|ReadOnly, 0 },
+  { "POSITIVE_INFINITY", NumberObjectImp::PosInfinity, DontEnum|DontDelete|ReadOnly, 0 },
+  { "MAX_VALUE",         NumberObjectImp::MaxValue,    DontEnum|DontDelete|ReadOnly, 0 },
+  { "MIN_VALUE",         NumberObjectImp::MinValue,    DontEnum|DontDelete|ReadOnly, 0 }
+};
+KJS_HASH_TABLE(numberTable);
+
 const ClassInfo NumberObjectImp::info = {"Function", &InternalFunctionImp::info, &numberTable, 0};
 
-/* Source for number_object.lut.h
-@begin numberTable 5
-  NaN			NumberObjectImp::NaNValue	DontEnum|DontDelete|ReadOnly
-  NEGATIVE_INFINITY	NumberObjectImp::NegInfinity	DontEnum|DontDelete|ReadOnly
-  POSITIVE_INFINITY	NumberObjectImp::PosInfinity	DontEnum|DontDelete|ReadOnly
-  MAX_VALUE		NumberObjectImp::MaxValue	DontEnum|DontDelete|ReadOnly
-  MIN_VALUE		NumberObjectImp::MinValue	DontEnum|DontDelete|ReadOnly
-@end
-*/
 NumberObjectImp::NumberObjectImp(ExecState * /*exec*/,
                                  FunctionPrototypeImp *funcProto,
                                  NumberPrototypeImp *numberProto)
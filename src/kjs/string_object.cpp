@@ -30,7 +30,7 @@
 #include "string_object.h"
 #include "error_object.h"
 #include <stdio.h>
-#include "string_object.lut.h"
+#include "lookup.h"
 
 #ifdef HAVE_STDINT_H
 #include <stdint.h>
@@ -125,46 +125,45 @@ ReferenceList StringInstanceImp::propList(ExecState *exec, bool recursive)
 }
 
 // ------------------------------ StringPrototypeImp ---------------------------
+static constexpr HashEntry stringTableEntries[] = {
+  { "toString",          StringProtoFuncImp::ToString,          DontEnum|Function, 0 },
+  { "valueOf",           StringProtoFuncImp::ValueOf,           DontEnum|Function, 0 },
+  { "charAt",            StringProtoFuncImp::CharAt,            DontEnum|Function, 1 },
+  { "charCodeAt",        StringProtoFuncImp::CharCodeAt,        DontEnum|Function, 1 },
+  { "concat",            StringProtoFuncImp::Concat,            DontEnum|Function, 1 },
+  { "indexOf",           StringProtoFuncImp::IndexOf,           DontEnum|Function, 1 },
+  { "lastIndexOf",       StringProtoFuncImp::LastIndexOf,       DontEnum|Function, 1 },
+  { "match",             StringProtoFuncImp::Match,             DontEnum|Function, 1 },
+  { "replace",           StringProtoFuncImp::Replace,           DontEnum|Function, 2 },
+  { "search",            StringProtoFuncImp::Search,            DontEnum|Function, 1 },
+  { "slice",             StringProtoFuncImp::Slice,             DontEnum|Function, 2 },
+  { "split",             StringProtoFuncImp::Split,             DontEnum|Function, 2 },
+  { "substr",            StringProtoFuncImp::Substr,            DontEnum|Function, 2 },
+  { "substring",         StringProtoFuncImp::Substring,         DontEnum|Function, 2 },
+  { "toLowerCase",       StringProtoFuncImp::ToLowerCase,       DontEnum|Function, 0 },
+  { "toUpperCase",       StringProtoFuncImp::ToUpperCase,       DontEnum|Function, 0 },
+  { "toLocaleLowerCase", StringProtoFuncImp::ToLocaleLowerCase, DontEnum|Function, 0 },
+  { "toLocaleUpperCase", StringProtoFuncImp::ToLocaleUpperCase, DontEnum|Function, 0 },
+  // Under here: html extension, should only exist if KJS_PURE_ECMA is not defined
+  // I guess we need two hashtables, and use #ifdef to select the right
+  // one... TODO. #####
+  { "big",               StringProtoFuncImp::Big,               DontEnum|Function, 0 },
+  { "small",             StringProtoFuncImp::Small,             DontEnum|Function, 0 },
+  { "blink",             StringProtoFuncImp::Blink,             DontEnum|Function, 0 },
+  { "bold",              StringProtoFuncImp::Bold,              DontEnum|Function, 0 },
+  { "fixed",             StringProtoFuncImp::Fixed,             DontEnum|Function, 0 },
+  { "italics",           StringProtoFuncImp::Italics,           DontEnum|Function, 0 },
+  { "strike",            StringProtoFuncImp::Strike,            DontEnum|Function, 0 },
+  { "sub",               StringProtoFuncImp::Sub,               DontEnum|Function, 0 },
+  { "sup",               StringProtoFuncImp::Sup,               DontEnum|Function, 0 },
+  { "fontcolor",         StringProtoFuncImp::Fontcolor,         DontEnum|Function, 1 },
+  { "fontsize",          StringProtoFuncImp::Fontsize,          DontEnum|Function, 1 },
+  { "anchor",            StringProtoFuncImp::Anchor,            DontEnum|Function, 1 },
+  { "link",              StringProtoFuncImp::Link,              DontEnum|Function, 1 }
+};
+KJS_HASH_TABLE(stringTable);
+
 const ClassInfo StringPrototypeImp::info = {"String", &StringInstanceImp::info, &stringTable, 0};
-/* Source for string_object.lut.h
-@begin stringTable 28
-  toString		StringProtoFuncImp::ToString	DontEnum|Function	0
-  valueOf		StringProtoFuncImp::ValueOf	DontEnum|Function	0
-  charAt		StringProtoFuncImp::CharAt	DontEnum|Function	1
-  charCodeAt		StringProtoFuncImp::CharCodeAt	DontEnum|Function	1
-  concat		StringProtoFuncImp::Concat	DontEnum|Function	1
-  indexOf		StringProtoFuncImp::IndexOf	DontEnum|Function	1
-  lastIndexOf		StringProtoFuncImp::LastIndexOf	DontEnum|Function	1
-  match			StringProtoFuncImp::Match	DontEnum|Function	1
-  replace		StringProtoFuncImp::Replace	DontEnum|Function	2
-  search		StringProtoFuncImp::Search	DontEnum|Function	1
-  slice			StringProtoFuncImp::Slice	DontEnum|Function	2
-  split			StringProtoFuncImp::Split	DontEnum|Function	2
-  substr		StringProtoFuncImp::Substr	DontEnum|Function	2
-  substring		StringProtoFuncImp::Substring	DontEnum|Function	2
-  toLowerCase		StringProtoFuncImp::ToLowerCase	DontEnum|Function	0
-  toUpperCase		StringProtoFuncImp::ToUpperCase	DontEnum|Function	0
-  toLocaleLowerCase	StringProtoFuncImp::ToLocaleLowerCase DontEnum|Function	0
-  toLocaleUpperCase     StringProtoFuncImp::ToLocaleUpperCase DontEnum|Function	0
-#
-# Under here: html extension, should only exist if KJS_PURE_ECMA is not defined
-# I guess we need to generate two hashtables in the .lut.h file, and use #ifdef
-# to select the right one... TODO. #####
-  big			StringProtoFuncImp::Big		DontEnum|Function	0
-  small			StringProtoFuncImp::Small	DontEnum|Function	0
-  blink			StringProtoFuncImp::Blink	DontEnum|Function	0
-  bold			StringProtoFuncImp::Bold	DontEnum|Function	0
-  fixed			StringProtoFuncImp::Fixed	DontEnum|Function	0
-  italics		StringProtoFuncImp::Italics	DontEnum|Function	0
-  strike		StringProtoFuncImp::Strike	DontEnum|Function	0
-  sub			StringProtoFuncImp::Sub		DontEnum|Function	0
-  sup			StringProtoFuncImp::Sup		DontEnum|Function	0
-  fontcolor		StringProtoFuncImp::Fontcolor	DontEnum|Function	1
-  fontsize		StringProtoFuncImp::Fontsize	DontEnum|Function	1
-  anchor		StringProtoFuncImp::Anchor	DontEnum|Function	1
-  link			StringProtoFuncImp::Link	DontEnum|Function	1
-@end
-*/
 // ECMA 15.5.4
 StringPrototypeImp::StringPrototypeImp(ExecState * /*exec*/,
                                        ObjectPrototypeImp *objProto)
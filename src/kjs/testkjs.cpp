@@ -62,7 +62,7 @@ int main(int argc, char **argv) {
     KJS::UString errMsg;
     KJS::SourceCode *source = 0;
     KJS::FunctionBodyNode *progNode = KJS::Parser::parse(
-            code.data(), code.size(), &source, &errLine, &errMsg);
+            code, &source, &errLine, &errMsg);
 
     // compress
     KJS::SourceStream stream;
@@ -76,7 +76,7 @@ int main(int argc, char **argv) {
         KJS::UString errMsg;
         KJS::SourceCode *source = 0;
         KJS::FunctionBodyNode *progNode = KJS::Parser::parse(
-                code.data(), code.size(), &source, &errLine, &errMsg);
+                code, &source, &errLine, &errMsg);
 
         if (errLine >= 0)
             std::cerr << "Error: " << errLine << ": " << errMsg.ascii() << std::endl;
@@ -0,0 +1,125 @@
+// -*- c-basic-offset: 2 -*-
+/*
+ *  This file is part of the KDE libraries
+ *  Copyright (C) 2026 agent (agent@local)
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#include <stdlib.h>
+#include <new>
+
+#include "token_stream.h"
+#include "nodes.h"
+#include "lexer.h"
+
+using namespace KJS;
+
+#ifndef KDE_USE_FINAL
+#include "grammar.h"
+#endif
+
+// slash after these tokens is division, otherwise it starts regexp
+static bool regExpAllowed(int token)
+{
+  switch (token) {
+  case IDENT: case NUMBER: case STRING: case THIS:
+  case NULLTOKEN: case TRUETOKEN: case FALSETOKEN:
+  case PLUSPLUS: case MINUSMINUS:
+  case ')': case ']': case '}':
+    return false;
+  default:
+    return true;
+  }
+}
+
+TokenStream::TokenStream()
+  : count(0), capacity(0), kinds(0), offsets(0), lengths(0), lines(0),
+    flagBits(0), errOffset(0), errLine(0)
+{
+}
+
+TokenStream::~TokenStream()
+{
+  free(kinds);
+  free(offsets);
+  free(lengths);
+  free(lines);
+  free(flagBits);
+}
+
+bool TokenStream::lex(const UChar *code, unsigned int length)
+{
+  clear();
+  Lexer lexer;
+  lexer.setCode(code, length);
+  lexer.setEatFunctionNames(false);
+  YYSTYPE value;
+  YYLTYPE location;
+
+  int token;
+  int prev = 0;
+  while ((token = lexer.lex(&value, &location)) > 0) {
+    unsigned char flags = lexer.prevTerminator() ? LineTerminatorBefore : 0;
+    if ((token == '/' || token == DIVEQUAL) && regExpAllowed(prev)) {
+      if (!lexer.scanRegExp())
+        break;
+      flags |= RegExpLiteral;
+    }
+    unsigned int start = lexer.tokenOffset();
+    unsigned int size = lexer.charNo() - start;
+    if (token == ';' && !size)
+      flags |= InsertedSemicolon;
+    append(token, start, size, lexer.tokenLineNo(), flags);
+    prev = token;
+  }
+
+  errOffset = lexer.charNo();
+  errLine = lexer.lineNo() - 1;
+  lexer.doneParsing();
+  return token == 0;
+}
+
+void TokenStream::append(int kind, unsigned int offset, unsigned int length,
+                         int line, unsigned char flags)
+{
+  if (count == capacity)
+    grow();
+  kinds[count] = kind;
+  offsets[count] = offset;
+  lengths[count] = length;
+  lines[count] = line;
+  flagBits[count] = flags;
+  ++count;
+}
+
+void TokenStream::grow()
+{
+  const unsigned int initialCapacity = 1024;
+  const unsigned int growthFactor = 2;
+  capacity = capacity ? capacity * growthFactor : initialCapacity;
+
+  kinds = static_cast<short *>(realloc(kinds, capacity * sizeof(short)));
+  offsets = static_cast<unsigned int *>(
+      realloc(offsets, capacity * sizeof(unsigned int)));
+  lengths = static_cast<unsigned int *>(
+      realloc(lengths, capacity * sizeof(unsigned int)));
+  lines = static_cast<int *>(realloc(lines, capacity * sizeof(int)));
+  flagBits = static_cast<unsigned char *>(
+      realloc(flagBits, capacity * sizeof(unsigned char)));
+  if (!kinds || !offsets || !lengths || !lines || !flagBits)
+    throw std::bad_alloc();
+}
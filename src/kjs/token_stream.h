@@ -0,0 +1,95 @@
+// -*- c-basic-offset: 2 -*-
+/*
+ *  This file is part of the KDE libraries
+ *  Copyright (C) 2026 agent (agent@local)
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+#ifndef _KJS_TOKEN_STREAM_H_
+#define _KJS_TOKEN_STREAM_H_
+
+#include "ustring.h"
+
+namespace KJS {
+
+  /**
+   * @short Tokens of a whole source code.
+   *
+   * Lexes the code at once and keeps the tokens in parallel arrays
+   * (kind, offset, length, line and flags), so tools which only look at
+   * tokens (size statistics, keyword counts, whitespace minifiers) run
+   * without the parser. Kinds are the token numbers of the grammar
+   * (IDENT, STRING, ';', ...) from grammar.h.
+   *
+   * Regular expressions are told from division by the previous token, the
+   * parser decides by grammar and can differ in rare cases such as
+   * "if (a) /re/.exec(b)".
+   */
+  class TokenStream {
+  public:
+    enum Flag { LineTerminatorBefore = 1, // new line since previous token
+                InsertedSemicolon = 2,    // automatic semicolon, length 0
+                RegExpLiteral = 4 };      // '/' or DIVEQUAL starting regexp
+
+    TokenStream();
+    ~TokenStream();
+
+    /**
+     * Lexes code of given length, replacing previous tokens. Returns
+     * false on lexical error, tokens before it are kept then. The code
+     * must be padded as Lexer::setCode() requires.
+     */
+    bool lex(const UChar *code, unsigned int length);
+
+    unsigned int size() const { return count; }
+    int kind(unsigned int i) const { return kinds[i]; }
+    unsigned int offset(unsigned int i) const { return offsets[i]; }
+    unsigned int length(unsigned int i) const { return lengths[i]; }
+    int line(unsigned int i) const { return lines[i]; }
+    unsigned char flags(unsigned int i) const { return flagBits[i]; }
+
+    /**
+     * Offset and line of the lexical error of last lex().
+     */
+    unsigned int errorOffset() const { return errOffset; }
+    int errorLine() const { return errLine; }
+
+    void clear() { count = 0; }
+
+  private:
+    void append(int kind, unsigned int offset, unsigned int length,
+                int line, unsigned char flags);
+    void grow();
+
+    // not copyable
+    TokenStream(const TokenStream &);
+    TokenStream &operator=(const TokenStream &);
+
+    unsigned int count;
+    unsigned int capacity;
+    short *kinds;
+    unsigned int *offsets;
+    unsigned int *lengths;
+    int *lines;
+    unsigned char *flagBits;
+    unsigned int errOffset;
+    int errLine;
+  };
+
+} // namespace
+
+#endif
@@ -125,12 +125,12 @@ bool KJS::operator==(const KJS::CString& c1, const KJS::CString& c2)
 }
 
 UChar UChar::null((char)0);
-UString::Rep UString::Rep::null = { 0, 0, 0, 1, 1 };
-UString::Rep UString::Rep::empty = { 0, 0, 0, 1, 1 };
+UString::Rep UString::Rep::null = { 0, 0, 0, UString::Rep::immortal, 1 };
+UString::Rep UString::Rep::empty = { 0, 0, 0, UString::Rep::immortal, 1 };
 UString UString::null;
 static const int normalStatBufferSize = 4096;
-static char *statBuffer = 0;
-static int statBufferSize = 0;
+static __thread char *statBuffer = 0;
+static __thread int statBufferSize = 0;
 
 UChar UChar::toLower() const
 {
@@ -269,7 +269,9 @@ unsigned UString::Rep::computeHash(const char *s)
 
 UString::UString()
 {
-  null.rep = &Rep::null;
+  // set once during static initialization, read only afterwards
+  if (!null.rep)
+    null.rep = &Rep::null;
   attach(&Rep::null);
 }
 
@@ -893,7 +895,8 @@ void UString::attach(Rep *r)
 
 void UString::detach()
 {
-  if (rep->rc > 1) {
+  // immortal reps are shared, they are copied as well
+  if (rep->rc > 1 || rep->rc == Rep::immortal) {
     int l = size();
     UChar *n = allocateChars(l);
     memcpy(n, data(), l * sizeof(UChar));
@@ -209,8 +209,11 @@ namespace KJS {
       static unsigned computeHash(const UChar *, int length);
       static unsigned computeHash(const char *);
 
-      void ref() { ++rc; }
-      void deref() { if (--rc == 0) destroy(); }
+      // rc is not atomic, a rep is counted by the thread which created it;
+      // reps shared by all threads (null, empty and Identifier::shared())
+      // are immortal, they are never counted nor freed
+      void ref() { if (rc != immortal) ++rc; }
+      void deref() { if (rc != immortal && --rc == 0) destroy(); }
 
       UChar *dat;
       int len;
@@ -219,6 +222,7 @@ namespace KJS {
       mutable unsigned _hash;
 
       enum { capacityForIdentifier = 0x10000000 };
+      enum { immortal = -1 };
 
       static Rep null;
       static Rep empty;
@@ -294,7 +298,7 @@ namespace KJS {
      * bytes. This method should only be used for *debugging* purposes as it
      * is neither Unicode safe nor free from side effects. In order not to
      * waste any memory the char buffer is static and *shared* by all UString
-     * instances.
+     * instances of the calling thread.
      */
     char *ascii() const;
 
@@ -0,0 +1,170 @@
+/*
+ * FILE             $Id$
+ *
+ * PROJECT          KHTML JavaScript compress utility
+ *
+ * DESCRIPTION      Lexer benchmark - tokens per second on given files.
+ *
+ * AUTHOR           agent <agent@local>
+ *
+ * LICENSE          see COPYING
+ *
+ * Copyright (C) Seznam.cz a.s. 2026
+ * All Rights Reserved
+ *
+ * HISTORY
+ *       2026-10-17 (agent)
+ *                  First draft.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include "input.h"
+#include "util.h"
+#include "kjs/token_stream.h"
+#include "kjs/nodes.h"
+#include "kjs/arena.h"
+
+using namespace KJS;
+
+#define OPTIONS "hr:p"
+#define USAGE "Usage: lexbench [Options] file ...\n\
+    -h        show this help\n\
+    -r n      lex each file n times, the fastest run counts [5]\n\
+    -p        parse the files, the nodes are allocated in an arena\n\n\
+    Only the lexer runs, the tokens are stored to a TokenStream.\n\
+    With -p the parse time is measured, tokens are not counted."
+
+namespace {
+
+/**
+ * @short result of lexing one file.
+ */
+struct Result_t {
+    Result_t(): tokens(0), seconds(0) {}
+
+    long tokens;    //< number of tokens.
+    double seconds; //< time of the fastest run.
+};
+
+/**
+ * @short return current time in seconds.
+ * @return current time in seconds.
+ */
+double now() {
+    struct timeval tv;
+    gettimeofday(&tv, 0);
+    return tv.tv_sec + tv.tv_usec / 1e6;
+}
+
+/**
+ * @short lex code to the end.
+ * @param code code to lex, decoded (and so padded) by decode().
+ * @param tokens store tokens here, reused by the runs of one file.
+ * @param result add number of tokens here.
+ * @return false on lexical error.
+ */
+bool lex(const UString &code, TokenStream &tokens, Result_t &result) {
+    bool ok = tokens.lex(code.data(), code.size());
+    result.tokens = tokens.size();
+    return ok;
+}
+
+/**
+ * @short parse code, the tree is released with the arena.
+ * @param code code to parse.
+ * @return false on syntax error.
+ */
+bool parse(const UString &code) {
+    SourceCode *source = 0;
+    Arena nodes;
+    FunctionBodyNode *prog = Parser::parse(code.data(), code.size(), &source,
+            0, 0, 0, 0, &nodes);
+    source->deref();
+    return prog;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+    int repeat = 5;
+    bool parsing = false;
+    int option;
+    while ((option = getopt(argc, argv, OPTIONS)) != EOF) {
+        switch (option) {
+        case 'r':
+            repeat = atoi(optarg);
+            if (repeat < 1) {
+                std::cerr << USAGE << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'p':
+            parsing = true;
+            break;
+        default:
+            std::cerr << USAGE << std::endl;
+            return (option == 'h')? EXIT_SUCCESS: EXIT_FAILURE;
+        }
+    }
+    if (optind >= argc) {
+        std::cerr << USAGE << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    Result_t total;
+    size_t bytes = 0;
+    std::cout << std::fixed;
+    for (int i = optind; i < argc; ++i) {
+        Input_t in;
+        if (!in.open(argv[i])) {
+            std::cerr << "Cannot open input file: " << argv[i] << std::endl;
+            return EXIT_FAILURE;
+        }
+        UString code = decode(in.data(), in.size());
+
+        // the fastest run counts, others are disturbed by the system
+        Result_t result;
+        TokenStream tokens;
+        for (int run = 0; run < repeat; ++run) {
+            double start = now();
+            if (parsing? !parse(code): !lex(code, tokens, result)) {
+                std::cerr << argv[i] << (parsing? ": syntax error.":
+                        ": lexical error.") << std::endl;
+                return EXIT_FAILURE;
+            }
+            double seconds = now() - start;
+            if (!run || (seconds < result.seconds))
+                result.seconds = seconds;
+        }
+
+        if (parsing)
+            std::cout << argv[i] << ": " << std::setprecision(4)
+                << result.seconds << " s, " << std::setprecision(2)
+                << in.size() / result.seconds / 1e6 << " MB/s" << std::endl;
+        else
+            std::cout << argv[i] << ": " << result.tokens << " tokens, "
+                << std::setprecision(4) << result.seconds << " s, "
+                << std::setprecision(2) << result.tokens / result.seconds / 1e6
+                << " Mtokens/s" << std::endl;
+        total.tokens += result.tokens;
+        total.seconds += result.seconds;
+        bytes += in.size();
+    }
+
+    std::cout << "total: ";
+    if (!parsing)
+        std::cout << total.tokens << " tokens, ";
+    std::cout << std::setprecision(4) << total.seconds << " s, ";
+    if (!parsing)
+        std::cout << std::setprecision(2) << total.tokens / total.seconds / 1e6
+            << " Mtokens/s, ";
+    std::cout << std::setprecision(2) << bytes / total.seconds / 1e6 << " MB/s"
+        << std::endl;
+    return EXIT_SUCCESS;
+}
+
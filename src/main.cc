@@ -18,6 +18,9 @@
  */
 
 #include <string>
+#include <map>
+#include <set>
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
 #include <iostream>
@@ -27,89 +30,468 @@
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <fcntl.h>
 #include <string.h>
 #include <errno.h>
+#include <pthread.h>
 
 #include "decompress.h"
 #include "compress.h"
+#include "batch.h"
+#include "input.h"
+#include "output.h"
+#include "util.h"
 #include "kjs/nodes.h"
+#include "kjs/lexer.h"
 
 #define CODE_DUMP_LEN 30
 
-#define OPTIONS "hnve:dob:cB:p:af:t:"
-#define USAGE "Usage: ksjcompress [Options]\n\
+#define OPTIONS "hnve:dob:cB:p:ar:f:t:j:m:s"
+#define USAGE "Usage: ksjcompress [Options] [input output ...]\n\
     -h        show this help\n\
     -f file   read js code from file\n\
     -t file   dump js code to file\n\
     -d        decompress code\n\
     -v        not valide generated code\n\
+    -s        write code to output while transforming (validated\n\
+              output is read back, so it must be regular file)\n\
     -n        add new lines to compressed code\n\
     -e x      dump x chars brefore and after error [30]\n\
     -o        obfuscate identfiers\n\
     -c        write origin identfier in comment\n\
     -a        ask to user whether obfuscate identfier\n\
+    -r file   replay answers from file and record new ones there\n\
     -p prefix dont obfuscate identfiers with prefix\n\
     -b file   identfiers obfuscate blacklist\n\
-    -B file   dump blacklist after obfuscate to file\n\n\
+    -B file   dump blacklist after obfuscate to file\n\
+    -m file   read input/output pairs from manifest file\n\
+    -j n      transform batch on n threads [cpu count]\n\n\
+    Input/output pairs given as arguments or in manifest are\n\
+    transformed in one process (batch mode).\n\n\
     KHTML JavaScript compress utility\n\
     Michal Bukovsky <michal.bukovsky@firma.seznam.cz>\n\
     Copyright (C) Seznam.cz a.s. 2007"
 
+namespace {
+
+/**
+ * @short obfuscate logs and blacklist dumps of batch jobs.
+ *
+ * The files are shared by all jobs, so they are written once when all
+ * jobs are done.
+ */
+struct Dumps_t {
+    Dumps_t() { pthread_mutex_init(&lock, 0);}
+    ~Dumps_t() { pthread_mutex_destroy(&lock);}
+
+    std::map<std::string, std::string> logs; //< obfuscate log by output.
+    std::set<std::string> blacklist; //< union of blacklists of all jobs.
+    pthread_mutex_t lock;            //< guards logs and blacklist.
+};
+
+/**
+ * @short transform options.
+ */
+struct Options_t {
+    Options_t()
+        : eof(false), compress(true), validate(true), obfuscate(false),
+          comment(false), ask(false), stream(false), fastExit(false),
+          code_dump_len(CODE_DUMP_LEN), dumps(0)
+    {}
+
+    bool eof;                  //< add new lines to compressed code.
+    bool compress;             //< compress (or decompress) code.
+    bool validate;             //< validate generated code.
+    bool obfuscate;            //< obfuscate identifiers.
+    bool comment;              //< write origin identifier in comment.
+    bool ask;                  //< ask user whether obfuscate identifier.
+    bool stream;               //< write output while transforming.
+    bool fastExit;             //< leave process when output is written.
+    std::string prefix;        //< dont obfuscate identfiers with prefix.
+    std::string blacklist;     //< identfiers obfuscate blacklist.
+    std::string blacklistDump; //< dump blacklist after obfuscate to file.
+    std::string decisions;     //< replay and record answers in file.
+    int code_dump_len;         //< dump x chars before and after error.
+    Dumps_t *dumps;            //< collect dumps of batch jobs here.
+};
+
+/**
+ * @short write dump file.
+ * @param file path to file.
+ * @param data content of file.
+ * @param what name of dump for error message.
+ */
+void writeDump(const std::string &file, const std::string &data,
+               const char *what)
+{
+    std::ofstream fo(file.c_str());
+    if (fo) {
+        fo << data;
+        fo.close();
+    } else {
+        std::cerr << "Cannot write " << what << "." << std::endl;
+        std::cerr << strerror(errno) << std::endl;
+    }
+}
+
+/**
+ * @short write obfuscate log, blacklist and answers of compressed file,
+ *        batch job passes log and blacklist to opts.dumps.
+ * @param opts transform options.
+ * @param to output file.
+ * @param cs compress stream of file.
+ */
+void dumpLogs(const Options_t &opts, const std::string &to,
+              const CompressStream_t &cs)
+{
+    std::ostringstream log;
+    bool obfuscated = cs.dumpLog(log);
+    std::ostringstream blacklist;
+    if (!opts.blacklistDump.empty())
+        cs.dumpBlacklist(blacklist);
+
+    // batch job, blacklists of all jobs are merged
+    if (opts.dumps) {
+        pthread_mutex_lock(&opts.dumps->lock);
+        if (obfuscated)
+            opts.dumps->logs[to] = log.str();
+        std::istringstream is(blacklist.str());
+        std::copy(std::istream_iterator<std::string>(is),
+                  std::istream_iterator<std::string>(),
+                  std::inserter(opts.dumps->blacklist,
+                                opts.dumps->blacklist.begin()));
+        pthread_mutex_unlock(&opts.dumps->lock);
+        return;
+    }
+
+    if (obfuscated)
+        writeDump("kjscompress.log", log.str(), "obfuscate log");
+    if (!opts.blacklistDump.empty())
+        writeDump(opts.blacklistDump, blacklist.str(), "blacklist");
+
+    // answers are recorded with -a only, which is not allowed in batch
+    std::ostringstream decisions;
+    if (cs.dumpDecisions(decisions))
+        writeDump(opts.decisions, decisions.str(), "decisions");
+}
+
+/**
+ * @short flush standard streams and leave the process at once.
+ *
+ * No destructor runs, memory and mapped files are released by the system.
+ *
+ * @param status exit status.
+ */
+void fastExit(int status) {
+    std::cout.flush();
+    std::cerr.flush();
+    _exit(status);
+}
+
+/**
+ * @short return status of finished transformation.
+ * @param opts transform options.
+ * @param status exit status.
+ * @return status (unless the process is left).
+ */
+int finish(const Options_t &opts, int status) {
+    if (opts.fastExit)
+        fastExit(status);
+    return status;
+}
+
+/**
+ * @short open output file.
+ * @param to path to file ("-" or empty means stdout).
+ * @return file descriptor or -1 (errno is set).
+ */
+int openOutput(const std::string &to) {
+    if ((to == "-") || to.empty())
+        return STDOUT_FILENO;
+    return open(to.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+}
+
+/**
+ * @short report parse error.
+ * @param err stream for error messages.
+ * @param data parsed code as read, before decode().
+ * @param size size of code.
+ * @param errLine line of error.
+ * @param errChar index of error in decoded code.
+ *
+ * "char N" is the byte offset of the error in the code as read (BOM
+ * included), which is what it has always been; the error mark below
+ * the code counts characters.
+ */
+void dumpParseError(std::ostream &err, const char *data, int size,
+                    int errLine, int errChar)
+{
+    err << "Parse error at line " << errLine << " and char "
+        << offsetOf(data, size, errChar);
+}
+
+/**
+ * @short dump code around error and mark the error position.
+ * @param err stream for error messages.
+ * @param code parsed code.
+ * @param errChar offset of error.
+ * @param errColumn column of error.
+ * @param before dump at most so many chars before error.
+ * @param after dump at most so many chars after error (-1 means up to
+ *        the end of line).
+ */
+void dumpErrorContext(std::ostream &err, const KJS::UString &code,
+                      int errChar, int errColumn, int before, int after)
+{
+    const KJS::UChar *data = code.data();
+    int size = code.size();
+    int from = ((errChar - before) > 0)? errChar - before: 0;
+    int limit = ((after >= 0) && (errChar + after < size))?
+            errChar + after: size;
+    int to = errChar;
+    while ((to < limit) && !KJS::Lexer::isLineTerminator(data[to].uc))
+        ++to;
+    dump(err, KJS::UString(data + from, to - from));
+    err << std::endl;
+
+    // error mark goes under the error in its line
+    int lineStart = errChar - errColumn;
+    for (int i = (from > lineStart)? from: lineStart; i < errChar; ++i)
+        err << ' ';
+    err << '^' << std::endl;
+}
+
+/**
+ * @short parse transformed code again and report errors.
+ * @param transformed transformed code.
+ * @param size size of transformed code.
+ * @param code_dump_len dump x chars before and after error.
+ * @param err stream for error messages.
+ * @return true if transformed code is valid.
+ */
+bool validate(const char *transformed, int size, int code_dump_len,
+              std::ostream &err)
+{
+    int errLine = -1;
+    int errChar = -1;
+    int errColumn = -1;
+    KJS::UString code = decode(transformed, size);
+    KJS::SourceCode *source = 0;
+    KJS::Arena nodes;
+    KJS::Parser::parse(code.data(), code.size(), &source, &errLine,
+            &errChar, 0, &errColumn, &nodes);
+    source->deref();
+    if (errLine < 0)
+        return true;
+
+    // report error
+    err << "VALIDATE_ERR: ";
+    dumpParseError(err, transformed, size, errLine, errChar);
+    err << std::endl;
+
+    // dump some bit of compressed code
+    dumpErrorContext(err, code, errChar, errColumn, code_dump_len,
+            code_dump_len);
+
+    // error
+    return false;
+}
+
+/**
+ * @short transform one file.
+ * @param opts transform options.
+ * @param from read js code from file ("-" or empty means stdin).
+ * @param to dump js code to file ("-" or empty means stdout).
+ * @param err stream for error messages.
+ * @return EXIT_SUCCESS or EXIT_FAILURE.
+ */
+int transform(const Options_t &opts, const std::string &from,
+              const std::string &to, std::ostream &err)
+{
+    // error handling
+    int errLine = -1;
+    int errChar = -1;
+    int errColumn = -1;
+    KJS::SourceCode *source = 0;
+    int code_dump_len = opts.code_dump_len;
+
+    // read input
+    Input_t in;
+    if (!in.open(from)) {
+        err << "Cannot open input file." << std::endl;
+        err << strerror(errno) << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // parse via kjs, the tree is released with the arena
+    const char *theCode = in.data();
+    int codeSize = in.size();
+    KJS::UString code = decode(theCode, codeSize);
+    KJS::Arena nodes;
+    KJS::FunctionBodyNode *node = KJS::Parser::parse(code.data(), code.size(),
+            &source, &errLine, &errChar, 0, &errColumn, &nodes);
+    source->deref();
+
+    // report error
+    if (errLine >= 0) {
+        err << "ERR: ";
+        dumpParseError(err, theCode, codeSize, errLine, errChar);
+        err << std::endl;
+
+        // dump some bit of code
+        dumpErrorContext(err, code, errChar, errColumn, code_dump_len, -1);
+
+        return EXIT_FAILURE;
+    }
+
+    // streamed output is opened before transformation, streamed output
+    // is validated by reading it back, so it must be regular file
+    bool stdoutput = (to == "-") || to.empty();
+    bool stream = opts.stream;
+    int out = -1;
+    if (stream) {
+        if ((out = openOutput(to)) < 0) {
+            err << "Cannot open output file." << std::endl;
+            err << strerror(errno) << std::endl;
+            return EXIT_FAILURE;
+        }
+        struct stat st;
+        if (opts.validate && (stdoutput || fstat(out, &st)
+                    || !S_ISREG(st.st_mode)))
+            stream = false;
+    }
+
+    // transform
+    Output_t output(stream? out: -1);
+    if (opts.compress) {
+        CompressStream_t cs(node, output, opts.obfuscate, opts.comment,
+                opts.ask, opts.prefix, opts.blacklist, opts.decisions,
+                opts.eof);
+        dumpLogs(opts, to, cs);
+    } else
+        DeCompressStream_t(node, output);
+
+    output.put('\n');
+
+    // streamed output is complete
+    if (stream) {
+        bool written = output.flush(out);
+        if (!stdoutput && close(out))
+            written = false;
+        if (!written) {
+            err << "Cannot write output file." << std::endl;
+            err << strerror(errno) << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        // validate written file, remove it when broken
+        if (opts.validate) {
+            Input_t transformed;
+            if (!transformed.open(to)) {
+                err << "Cannot read output file." << std::endl;
+                err << strerror(errno) << std::endl;
+                return EXIT_FAILURE;
+            }
+            if (!validate(transformed.data(), transformed.size(),
+                          code_dump_len, err)) {
+                unlink(to.c_str());
+                return EXIT_FAILURE;
+            }
+        }
+        return finish(opts, EXIT_SUCCESS);
+    }
+
+    // validate compressed
+    if (opts.validate) {
+        std::string transformed = output.str();
+        if (!validate(transformed.data(), transformed.size(), code_dump_len,
+                      err))
+            return EXIT_FAILURE;
+    }
+
+    // write transformed code
+    if (out < 0)
+        out = openOutput(to);
+    if (out < 0) {
+        err << "Cannot open output file." << std::endl;
+        err << strerror(errno) << std::endl;
+        return EXIT_FAILURE;
+    }
+    bool written = output.flush(out);
+    if (!stdoutput && close(out))
+        written = false;
+    if (!written) {
+        err << "Cannot write output file." << std::endl;
+        err << strerror(errno) << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // return succes
+    return finish(opts, EXIT_SUCCESS);
+}
+
+/**
+ * @short batch job callback.
+ * @param job job to process.
+ * @param err stream for error messages.
+ * @param arg transform options.
+ * @return EXIT_SUCCESS or EXIT_FAILURE.
+ */
+int transformJob(const Job_t &job, std::ostream &err, void *arg) {
+    return transform(*static_cast<const Options_t *>(arg), job.from, job.to,
+                     err);
+}
+
+} // namespace
+
 /**
  * @short main fuction
  */
 int main(int argc, char **argv) {
     // options
-    bool eof = false;
-    bool compress = true;
-    bool validate = true;
-    bool obfuscate = false;
-    bool comment = false;
-    bool ask = false;
-    std::string prefix;
-    std::string blacklist;
-    std::string blacklistDump;
+    Options_t opts;
     std::string from;
     std::string to;
-    int code_dump_len = CODE_DUMP_LEN;
+    std::string manifest;
+    int workers = 0;
 
     /* getopt unistd.h */
     char options = 0;
     bool error_opt = false;
     struct stat st;
 
-    // error handling
-    int errLine = -1;
-    int errChar = -1;
-    KJS::UString errMsg;
-    KJS::SourceCode *source = 0;
-
     // prase options
     while ((options = getopt(argc, argv, OPTIONS)) != EOF) {
         switch (options) {
         case 'd':
-            compress = false;
+            opts.compress = false;
             break;
         case 'n':
-            eof = true;
+            opts.eof = true;
             break;
         case 'v':
-            validate = false;
+            opts.validate = false;
             break;
         case 'o':
-            obfuscate = true;
+            opts.obfuscate = true;
             break;
         case 'c':
-            comment = true;
+            opts.comment = true;
             break;
         case 'a':
-            ask = true;
+            opts.ask = true;
+            break;
+        case 's':
+            opts.stream = true;
+            break;
+        case 'r':
+            opts.decisions = optarg;
             break;
         case 'p':
-            prefix = optarg;
+            opts.prefix = optarg;
             break;
         case 'B':
-            blacklistDump = optarg;
+            opts.blacklistDump = optarg;
             break;
         case 't':
             to = optarg;
@@ -123,7 +505,7 @@ int main(int argc, char **argv) {
             }
             break;
         case 'b':
-            blacklist = optarg;
+            opts.blacklist = optarg;
             if (stat(optarg, &st)) {
                 std::cerr << "Cannot open file: " << optarg << "." << std::endl;
                 std::cerr << strerror(errno) << std::endl;
@@ -131,11 +513,22 @@ int main(int argc, char **argv) {
             }
             break;
         case 'e':
-            code_dump_len = atoi(optarg);
-            if (code_dump_len < 0) {
+            opts.code_dump_len = atoi(optarg);
+            if (opts.code_dump_len < 0) {
                 std::cerr << "Ignore not valid param for -e option."
                     << std::endl;
-                code_dump_len = CODE_DUMP_LEN;
+                opts.code_dump_len = CODE_DUMP_LEN;
+            }
+            break;
+        case 'm':
+            manifest = optarg;
+            break;
+        case 'j':
+            workers = atoi(optarg);
+            if (workers < 1) {
+                std::cerr << "Ignore not valid param for -j option."
+                    << std::endl;
+                workers = 0;
             }
             break;
         case 'h':
@@ -145,137 +538,65 @@ int main(int argc, char **argv) {
         }
     }
 
-    if (ask && from.empty()) {
-        std::cerr << "Ignore -a option. Can be used only with -f option."
-            << std::endl;
-        ask = false;
-    }
+    // batch mode?
+    bool batch = !manifest.empty() || (optind < argc);
+    if (batch && (!from.empty() || !to.empty()))
+        error_opt = true;
+    if ((argc - optind) % 2)
+        error_opt = true;
 
     // option parse error?
-    if (error_opt || (optind < argc)) {
+    if (error_opt) {
         std::cerr << USAGE << std::endl;
         return EXIT_FAILURE;
     }
 
-    // open input/output
-    std::ifstream in;
-    if ((from == "-") || (from.empty())) {
-        in.copyfmt(std::cin);
-        in.clear(std::cin.rdstate());
-        in.std::basic_ios<char>::rdbuf(std::cin.rdbuf());
-    } else {
-        in.open(from.c_str());
-    }
-    if (!in) {
-        std::cerr << "Cannot open input file." << std::endl;
-        std::cerr << strerror(errno) << std::endl;
-        return EXIT_FAILURE;
-    }
-    std::ofstream out;
-    if ((to == "-") || (to.empty())) {
-        out.copyfmt(std::cout);
-        out.clear(std::cout.rdstate());
-        out.std::basic_ios<char>::rdbuf(std::cout.rdbuf());
-    } else {
-        out.open(to.c_str());
-    }
-    if (!in) {
-        std::cerr << "Cannot open output file." << std::endl;
-        std::cerr << strerror(errno) << std::endl;
-        return EXIT_FAILURE;
+    if (opts.ask && (batch || from.empty())) {
+        std::cerr << "Ignore -a option. Can be used only with -f option."
+            << std::endl;
+        opts.ask = false;
     }
 
-    // read input
-    std::ostringstream os;
-    in >> std::noskipws;
-    std::copy(std::istream_iterator<char>(in),
-            std::istream_iterator<char>(),
-            std::ostream_iterator<char>(os));
-
-    // parse via kjs
-    std::string theCode = os.str();
-    KJS::UString code(theCode.c_str());
-    KJS::FunctionBodyNode *node = KJS::Parser::parse(code.data(), code.size(),
-            &source, &errLine, &errChar, &errMsg);
-
-    // report error
-    if (errLine >= 0) {
-        std::cerr << "ERR: " << errMsg.ascii() << std::endl;
-
-        // dump some bit of code
-        int from = ((errChar - code_dump_len) > 0)?
-            errChar - code_dump_len: 0;
-        int newLine = 0;
-        for (int i = from; (i < errChar) || ((i < (signed)theCode.size())
-                    && (theCode[i] != '\n')); ++i) {
-            std::cerr << theCode[i];
-            if (i < errChar) {
-                if (theCode[i] == '\n')
-                    newLine = 0;
-                else
-                    ++newLine;
-            }
-        }
-        std::cerr << std::endl;
-
-        // dump error mark
-        for (int i = 0; i < newLine; ++i)
-            std::cerr << ' ';
-        std::cerr << '^' << std::endl;
-
-        return EXIT_FAILURE;
+    // single file does not wait for the teardown of its tree and buffers
+    if (!batch) {
+        opts.fastExit = true;
+        fastExit(transform(opts, from, to, std::cerr));
     }
 
-    // transform
-    std::string transformed;
-    if (compress)
-        transformed = CompressStream_t(node, obfuscate, comment, ask, prefix,
-                blacklist, blacklistDump, eof).string();
-    else
-        transformed = DeCompressStream_t(node).string();
-
-    // validate compressed
-    if (validate) {
-        KJS::UString code(transformed.c_str());
-        KJS::SourceCode *source = 0;
-        KJS::Parser::parse(code.data(), code.size(), &source, &errLine,
-                &errChar, &errMsg);
-
-        // report error
-        if (errLine >= 0) {
-            std::cerr << "VALIDATE_ERR: " << errMsg.ascii() << std::endl;
-
-            // dump some bit of compressed code
-            int from = ((errChar - code_dump_len) > 0)?
-                    errChar - code_dump_len: 0;
-            int to = ((errChar + code_dump_len) < (signed)transformed.size())?
-                    (errChar + code_dump_len): transformed.size();
-            int newLine = 0;
-            for (int i = from; i < to; ++i) {
-                if ((i >= errChar) && (transformed[i] == '\n'))
-                    break;
-                std::cerr << transformed[i];
-                if (transformed[i] == '\n')
-                    newLine = 0;
-                else
-                    ++newLine;
-            }
-            std::cerr << std::endl;
+    // collect batch jobs
+    JobList_t jobs;
+    if (!manifest.empty() && !readManifest(manifest, jobs, std::cerr))
+        return EXIT_FAILURE;
+    for (int i = optind; i + 1 < argc; i += 2)
+        jobs.push_back(Job_t(argv[i], argv[i + 1]));
 
-            // dump error mark
-            for (int i = from; i < ((errChar < newLine)? errChar: newLine); ++i)
-                std::cerr << ' ';
-            std::cerr << '^' << std::endl;
+    // transform them
+    Dumps_t dumps;
+    opts.dumps = &dumps;
+    int failed = runBatch(jobs, workers? workers: cpuCount(), transformJob,
+                          &opts, std::cerr);
 
-            // error
-            return EXIT_FAILURE;
-        }
+    // obfuscate logs of all jobs, each under "# output" line
+    if (!dumps.logs.empty()) {
+        std::ostringstream log;
+        for (std::map<std::string, std::string>::const_iterator
+                ilog = dumps.logs.begin(); ilog != dumps.logs.end(); ++ilog)
+            log << "# " << ilog->first << std::endl << ilog->second;
+        writeDump("kjscompress.log", log.str(), "obfuscate log");
+    }
+    if (!opts.blacklistDump.empty()) {
+        std::ostringstream blacklist;
+        std::copy(dumps.blacklist.begin(), dumps.blacklist.end(),
+                  std::ostream_iterator<std::string>(blacklist, "\n"));
+        writeDump(opts.blacklistDump, blacklist.str(), "blacklist");
+    }
+    if (failed) {
+        std::cerr << failed << " of " << jobs.size() << " files failed."
+            << std::endl;
+        fastExit(EXIT_FAILURE);
     }
-
-    // write transformed code
-    out << transformed << std::endl;
 
     // return succes
-    return EXIT_SUCCESS;
+    fastExit(EXIT_SUCCESS);
 }
 
@@ -0,0 +1,180 @@
+/*
+ * FILE             $Id$
+ *
+ * PROJECT          KHTML JavaScript compress utility
+ *
+ * DESCRIPTION      Output buffer
+ *
+ * AUTHOR           agent <agent@local>
+ *
+ * LICENSE          see COPYING
+ *
+ * Copyright (C) Seznam.cz a.s. 2026
+ * All Rights Reserved
+ *
+ * HISTORY
+ *       2026-10-17 (agent)
+ *                  First draft.
+ */
+
+#include <algorithm>
+#include <unistd.h>
+#include <limits.h>
+#include <sys/uio.h>
+#include <errno.h>
+
+#include "output.h"
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+/**
+ * @short release chunks and destroy object.
+ */
+Output_t::~Output_t() {
+    for (std::vector<char *>::iterator ichunk = chunks.begin();
+            ichunk != chunks.end(); ++ichunk)
+        delete [] *ichunk;
+}
+
+/**
+ * @short append new chunk.
+ */
+void Output_t::grow() {
+    // streaming buffer has just one chunk
+    if ((fd >= 0) && !chunks.empty()) {
+        if (!flush(fd) && !error)
+            error = errno;
+        return;
+    }
+
+    chunks.push_back(new char[CHUNK_SIZE]);
+    pos = chunks.back();
+    end = pos + CHUNK_SIZE;
+}
+
+/**
+ * @short append data to buffer.
+ * @param data data to append.
+ * @param size size of data.
+ */
+void Output_t::write(const char *data, std::size_t size) {
+    while (size) {
+        if (pos == end) grow();
+        std::size_t count = std::min<std::size_t>(size, end - pos);
+        memcpy(pos, data, count);
+        pos += count;
+        data += count;
+        size -= count;
+    }
+}
+
+/**
+ * @short return number of chars in buffer.
+ * @return number of chars in buffer.
+ */
+std::size_t Output_t::size() const {
+    if (chunks.empty())
+        return 0;
+    return (chunks.size() - 1) * CHUNK_SIZE + (pos - chunks.back());
+}
+
+/**
+ * @short return whole buffer content.
+ * @return buffer content.
+ */
+std::string Output_t::str() const {
+    std::string result;
+    result.reserve(size());
+    for (std::size_t i = 0; i < chunks.size(); ++i)
+        result.append(chunks[i], used(i));
+    return result;
+}
+
+/**
+ * @short return at most count last chars of output.
+ * @param count number of chars.
+ * @return end of output.
+ */
+std::string Output_t::tail(std::size_t count) const {
+    std::string result;
+    for (std::size_t i = chunks.size(); i && (result.size() < count); --i) {
+        std::size_t len = std::min(used(i - 1), count - result.size());
+        result.insert(0, chunks[i - 1] + used(i - 1) - len, len);
+    }
+
+    // already flushed chars
+    if (result.size() < count) {
+        std::size_t len = std::min(history.size(), count - result.size());
+        result.insert(0, history, history.size() - len, len);
+    }
+    return result;
+}
+
+/**
+ * @short write buffer content to file descriptor and empty buffer.
+ * @param fd file descriptor.
+ * @return true if all data (including chunks written while streaming)
+ *         were written, otherwise errno is set.
+ */
+bool Output_t::flush(int fd) {
+    // nothing is written after failure
+    bool ok = !error && writeChunks(fd);
+
+    // remember end of flushed data
+    history = tail(HISTORY_SIZE);
+
+    // keep one chunk for next data
+    for (std::size_t i = 1; i < chunks.size(); ++i)
+        delete [] chunks[i];
+    if (!chunks.empty()) {
+        chunks.resize(1);
+        pos = chunks.front();
+        end = pos + CHUNK_SIZE;
+    }
+
+    if (error)
+        errno = error;
+    return ok;
+}
+
+/**
+ * @short write whole buffer content to file descriptor.
+ * @param fd file descriptor.
+ * @return true if all data were written, otherwise errno is set.
+ */
+bool Output_t::writeChunks(int fd) const {
+    std::vector<struct iovec> iov(chunks.size());
+    for (std::size_t i = 0; i < chunks.size(); ++i) {
+        iov[i].iov_base = chunks[i];
+        iov[i].iov_len = used(i);
+    }
+
+    std::size_t first = 0;
+    while (true) {
+        // skip written chunks
+        while ((first < iov.size()) && !iov[first].iov_len)
+            ++first;
+        if (first == iov.size())
+            return true;
+
+        // write as many chunks as possible
+        ssize_t written = writev(fd, &iov[first],
+                std::min<std::size_t>(iov.size() - first, IOV_MAX));
+        if (written < 0) {
+            if (errno == EINTR)
+                continue;
+            return false;
+        }
+
+        // forget written data
+        for (std::size_t i = first; written > 0; ++i) {
+            std::size_t len = std::min<std::size_t>(written, iov[i].iov_len);
+            iov[i].iov_base = static_cast<char *>(iov[i].iov_base) + len;
+            iov[i].iov_len -= len;
+            written -= len;
+        }
+    }
+}
+
@@ -0,0 +1,149 @@
+/*
+ * FILE             $Id$
+ *
+ * PROJECT          KHTML JavaScript compress utility
+ *
+ * DESCRIPTION      Output buffer
+ *
+ * AUTHOR           agent <agent@local>
+ *
+ * LICENSE          see COPYING
+ *
+ * Copyright (C) Seznam.cz a.s. 2026
+ * All Rights Reserved
+ *
+ * HISTORY
+ *       2026-10-17 (agent)
+ *                  First draft.
+ */
+
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstring>
+
+/**
+ * @short append only output buffer.
+ *
+ * Data are stored in fixed size chunks, so appending never moves data
+ * already written and whole buffer can be written to file descriptor by
+ * one writev call. Streaming buffer writes each full chunk to its file
+ * descriptor at once and reuses it, so it never holds more than one chunk.
+ */
+class Output_t {
+public:
+    /**
+     * @short create new empty buffer.
+     * @param fd write full chunks to this file descriptor (-1 means keep
+     *           everything in memory).
+     */
+    explicit Output_t(int fd = -1): fd(fd), error(0), pos(0), end(0) {}
+
+    /**
+     * @short release chunks and destroy object.
+     */
+    ~Output_t();
+
+    /**
+     * @short append char to buffer.
+     * @param ch char to append.
+     */
+    void put(char ch) {
+        if (pos == end) grow();
+        *pos++ = ch;
+    }
+
+    /**
+     * @short append data to buffer.
+     * @param data data to append.
+     * @param size size of data.
+     */
+    void write(const char *data, std::size_t size);
+
+    /**
+     * @short append data to buffer and return buffer.
+     * @param value data to append.
+     * @return buffer.
+     */
+    Output_t &operator<<(char value) { put(value); return *this;}
+    Output_t &operator<<(const char *value) {
+        write(value, strlen(value));
+        return *this;
+    }
+    Output_t &operator<<(const std::string &value) {
+        write(value.data(), value.size());
+        return *this;
+    }
+
+    /**
+     * @short return number of chars in buffer.
+     * @return number of chars in buffer.
+     */
+    std::size_t size() const;
+
+    /**
+     * @short return whole buffer content.
+     * @return buffer content.
+     */
+    std::string str() const;
+
+    /**
+     * @short return at most count last chars of output.
+     *
+     * Up to HISTORY_SIZE chars are available even if they were already
+     * flushed.
+     *
+     * @param count number of chars.
+     * @return end of output.
+     */
+    std::string tail(std::size_t count) const;
+
+    /**
+     * @short write buffer content to file descriptor and empty buffer.
+     * @param fd file descriptor.
+     * @return true if all data (including chunks written while
+     *         streaming) were written, otherwise errno is set.
+     */
+    bool flush(int fd);
+
+private:
+    Output_t(const Output_t &);
+    Output_t &operator=(const Output_t &);
+
+    /**
+     * @short append new chunk.
+     */
+    void grow();
+
+    /**
+     * @short write whole buffer content to file descriptor.
+     * @param fd file descriptor.
+     * @return true if all data were written, otherwise errno is set.
+     */
+    bool writeChunks(int fd) const;
+
+    /**
+     * @short return number of used chars in chunk.
+     * @param i index of chunk.
+     * @return number of used chars in chunk.
+     */
+    std::size_t used(std::size_t i) const {
+        return (i + 1 == chunks.size())? pos - chunks[i]: CHUNK_SIZE;
+    }
+
+    static const std::size_t CHUNK_SIZE = 1 << 16; //< size of chunk.
+    static const std::size_t HISTORY_SIZE = 256;   //< size of history.
+
+    int fd;                     //< streaming file descriptor or -1.
+    int error;                  //< errno of failed streaming write.
+    std::vector<char *> chunks; //< chunks of data, last one is filling.
+    char *pos;                  //< write position in last chunk.
+    char *end;                  //< end of last chunk.
+    std::string history;        //< last chars of flushed data.
+};
+
+#endif /* OUTPUT_H */
+
@@ -17,84 +17,422 @@
  *                  First draft.
  */
 
+#include <ctype.h>
+#include <string.h>
+#include <stdint.h>
+
 #include "util.h"
+#include "output.h"
+#include "kjs/ustring.h"
+#include "kjs/lexer.h"
+
+namespace {
+
+/**
+ * @short small caller owned buffer flushed to stream when full.
+ */
+class Buffer_t {
+public:
+    /**
+     * @short create new empty buffer.
+     * @param os flush buffer to this stream.
+     */
+    Buffer_t(std::ostream &os)
+        : os(os), len(0)
+    {}
+
+    /**
+     * @short flush rest of buffer and destroy object.
+     */
+    ~Buffer_t() { flush();}
+
+    /**
+     * @short append char to buffer.
+     * @param ch char to append.
+     */
+    void put(char ch) {
+        if (len == SIZE) flush();
+        data[len++] = ch;
+    }
+
+    /**
+     * @short write buffer content to stream.
+     */
+    void flush() {
+        os.write(data, len);
+        len = 0;
+    }
+
+private:
+    static const int SIZE = 4096; //< size of buffer.
+    std::ostream &os;             //< flush buffer to this stream.
+    int len;                      //< number of used chars.
+    char data[SIZE];              //< buffer.
+};
+
+/**
+ * @short std::string adaptor for encode().
+ */
+struct StringBuffer_t {
+    StringBuffer_t(std::string &str): str(str) {}
+    void put(char ch) { str.push_back(ch);}
+    std::string &str;
+};
+
+/**
+ * @short return true if utf-8 byte order mark starts the source.
+ * @param data source.
+ * @param size size of source.
+ * @return true if byte order mark starts the source.
+ */
+inline bool hasBom(const char *data, std::size_t size) {
+    return (size >= 3) && !memcmp(data, "\xef\xbb\xbf", 3);
+}
+
+/**
+ * @short return true if there are 8 ascii bytes at p.
+ * @param p source.
+ * @return true if there are 8 ascii bytes at p.
+ */
+inline bool isAscii8(const unsigned char *p) {
+    uint64_t word;
+    memcpy(&word, p, sizeof(word));
+    return !(word & 0x8080808080808080ULL);
+}
+
+/**
+ * @short decode one non ascii char from UTF-8.
+ * @param p current position, moved behind the char.
+ * @param end end of source.
+ * @return code point, invalid byte is mapped to U+DC80..U+DCFF.
+ */
+unsigned int decodeChar(const unsigned char *&p, const unsigned char *end) {
+    unsigned int lead = *p++;
+    unsigned int cp;
+    unsigned int min;
+    int count;
+    if ((lead & 0xe0) == 0xc0) {
+        cp = lead & 0x1f;
+        min = 0x80;
+        count = 1;
+    } else if ((lead & 0xf0) == 0xe0) {
+        cp = lead & 0x0f;
+        min = 0x800;
+        count = 2;
+    } else if ((lead & 0xf8) == 0xf0) {
+        cp = lead & 0x07;
+        min = 0x10000;
+        count = 3;
+    } else return 0xdc00 | lead;
+
+    // continuation bytes
+    if ((end - p) < count)
+        return 0xdc00 | lead;
+    for (int i = 0; i < count; ++i) {
+        if ((p[i] & 0xc0) != 0x80)
+            return 0xdc00 | lead;
+        cp = (cp << 6) | (p[i] & 0x3f);
+    }
+
+    // overlong forms, surrogates and out of range
+    if ((cp < min) || (cp > 0x10ffff) || ((cp >= 0xd800) && (cp <= 0xdfff)))
+        return 0xdc00 | lead;
+
+    p += count;
+    return cp;
+}
+
+/**
+ * @short encode one non ascii char to UTF-8.
+ * @param out output buffer.
+ * @param p current char, moved behind the char.
+ * @param end end of string.
+ */
+template <typename Out_t>
+void encodeChar(Out_t &out, const KJS::UChar *&p, const KJS::UChar *end) {
+    unsigned int ch = (p++)->uc;
+    if (ch < 0x80) {
+        out.put(ch);
+
+    } else if (ch < 0x800) {
+        out.put(0xc0 | (ch >> 6));
+        out.put(0x80 | (ch & 0x3f));
+
+    // surrogate pair
+    } else if ((ch >= 0xd800) && (ch <= 0xdbff) && (p != end)
+            && (p->uc >= 0xdc00) && (p->uc <= 0xdfff)) {
+        unsigned int cp = 0x10000 + ((ch - 0xd800) << 10)
+            + ((p++)->uc - 0xdc00);
+        out.put(0xf0 | (cp >> 18));
+        out.put(0x80 | ((cp >> 12) & 0x3f));
+        out.put(0x80 | ((cp >> 6) & 0x3f));
+        out.put(0x80 | (cp & 0x3f));
+
+    // invalid byte of source
+    } else if ((ch >= 0xdc80) && (ch <= 0xdcff)) {
+        out.put(ch & 0xff);
+
+    } else {
+        out.put(0xe0 | (ch >> 12));
+        out.put(0x80 | ((ch >> 6) & 0x3f));
+        out.put(0x80 | (ch & 0x3f));
+    }
+}
+
+/**
+ * @short return true if char is hexadecimal digit.
+ * @param ch char.
+ * @return true if char is hexadecimal digit.
+ */
+inline bool isHex(const KJS::UChar &ch) {
+    return (ch.uc < 0x80) && isxdigit(ch.uc);
+}
+
+/**
+ * @short return true if char is in range <from, to>.
+ * @param ch char.
+ * @param from lower bound.
+ * @param to upper bound.
+ * @return true if char is in range.
+ */
+inline bool inRange(const KJS::UChar &ch, char from, char to) {
+    return (ch.uc >= from) && (ch.uc <= to);
+}
 
 /**
- * @short escape string.
- * @param str string to escape.
- * @return escaped string.
+ * @short write escape sequence to buffer.
+ * @param buffer output buffer.
+ * @param ch char following backslash.
  */
-std::string escape(const std::string &str) {
-    std::string escaped;
-    escaped.reserve(str.size());
+template <typename Out_t>
+inline void escapeChar(Out_t &buffer, char ch) {
+    buffer.put('\\');
+    buffer.put(ch);
+}
+
+/**
+ * @short dump kjs string to buffer encoded to UTF-8.
+ * @param buffer output buffer.
+ * @param str string to dump.
+ */
+template <typename Out_t>
+void dumpString(Out_t &buffer, const KJS::UString &str) {
+    const KJS::UChar *p = str.data();
+    const KJS::UChar *end = p + str.size();
+    while (p != end) {
+        // runs of ascii chars
+        for (; (p != end) && (p->uc < 0x80); ++p)
+            buffer.put(p->uc);
+        if (p != end)
+            encodeChar(buffer, p, end);
+    }
+}
+
+/**
+ * @short dump escaped kjs string to buffer encoded to UTF-8.
+ * @param buffer output buffer.
+ * @param escaped string to escape and dump.
+ */
+template <typename Out_t>
+void dumpEscaped(Out_t &buffer, const Escaped_t &escaped) {
+    const KJS::UChar *str = escaped.str.data();
+    const KJS::UChar *end = str + escaped.str.size();
+    int size = escaped.str.size();
 
     // iterate over all string chars
-    for (std::string::size_type i = 0; i < str.size(); i++) {
+    for (int i = 0; i < size; i++) {
 
-        switch (str[i]) {
+        switch (str[i].uc) {
         case '\n':
-            escaped.append("\\n");
+            escapeChar(buffer, 'n');
             break;
         case '\r':
-            escaped.append("\\r");
+            escapeChar(buffer, 'r');
             break;
         case '\\':
             // do not escape backslah for unicode seq
-            if (((i + 5) < str.size())
-                && (str[i + 1] == 'u')
-                && isxdigit(str[i + 2])
-                && isxdigit(str[i + 3])
-                && isxdigit(str[i + 4])
-                && isxdigit(str[i + 5]))
+            if (((i + 5) < size)
+                && (str[i + 1].uc == 'u')
+                && isHex(str[i + 2])
+                && isHex(str[i + 3])
+                && isHex(str[i + 4])
+                && isHex(str[i + 5]))
             {
-                escaped.append("\\");
+                buffer.put('\\');
 
             // do not escape backslah for hexa seq
-            } else if (((i + 3) < str.size())
-                && (str[i + 1] == 'x')
-                && isxdigit(str[i + 2])
-                && isxdigit(str[i + 3]))
+            } else if (((i + 3) < size)
+                && (str[i + 1].uc == 'x')
+                && isHex(str[i + 2])
+                && isHex(str[i + 3]))
             {
-                escaped.append("\\");
+                buffer.put('\\');
 
             // do not escape backslah for octal seq
-            } else if (((i + 3) < str.size())
-                && (str[i + 1] >= '0' && str[i + 1] <= '3')
-                && (str[i + 2] >= '0' && str[i + 2] <= '7')
-                && (str[i + 3] >= '0' && str[i + 3] <= '7'))
+            } else if (((i + 3) < size)
+                && inRange(str[i + 1], '0', '3')
+                && inRange(str[i + 2], '0', '7')
+                && inRange(str[i + 3], '0', '7'))
             {
-                escaped.append("\\");
+                buffer.put('\\');
 
-            } else if (((i + 3) < str.size())
-                && (str[i + 1] >= '0' && str[i + 1] <= '7')
-                && (str[i + 2] >= '0' && str[i + 2] <= '7'))
+            } else if (((i + 3) < size)
+                && inRange(str[i + 1], '0', '7')
+                && inRange(str[i + 2], '0', '7'))
             {
-                escaped.append("\\");
+                buffer.put('\\');
 
-            } else if (((i + 3) < str.size())
-                && (str[i + 1] >= '0' && str[i + 1] <= '7'))
+            } else if (((i + 3) < size)
+                && inRange(str[i + 1], '0', '7'))
             {
-                escaped.append("\\");
+                buffer.put('\\');
 
             // single backslah escape it
             } else {
-                escaped.append("\\\\");
+                escapeChar(buffer, '\\');
             }
             break;
         case '\b':
-            escaped.append("\\b");
+            escapeChar(buffer, 'b');
             break;
         case '\"':
-            escaped.append("\\\"");
+            escapeChar(buffer, '"');
             break;
         case '\t':
-            escaped.append("\\t");
+            escapeChar(buffer, 't');
+            break;
+        default: {
+            const KJS::UChar *p = str + i;
+            encodeChar(buffer, p, end);
+            i = p - str - 1;
             break;
-        default:
-            escaped.append(1, str[i]);
+        }
+        }
+    }
+}
+
+} // namespace
+
+/**
+ * @short decode UTF-8 source to kjs string.
+ * @param data source.
+ * @param size size of source.
+ * @return kjs string.
+ */
+KJS::UString decode(const char *data, std::size_t size) {
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(data);
+    const unsigned char *end = p + size;
+    if (hasBom(data, size))
+        p += 3;
+    if (p == end)
+        return KJS::UString("");
+
+    // decoded string is never longer than source, padding for the lexer
+    // follows it; raw chars, UChar constructor would clear them needlessly
+    KJS::UChar *code = reinterpret_cast<KJS::UChar *>(
+            new unsigned short[end - p + KJS::Lexer::padding]);
+    KJS::UChar *q = code;
+
+    while (p != end) {
+        // widen runs of ascii chars by words
+        for (; ((end - p) >= 8) && isAscii8(p); p += 8, q += 8)
+            for (int i = 0; i < 8; ++i)
+                q[i].uc = p[i];
+        if (p == end)
             break;
+
+        // one char
+        if (*p < 0x80) {
+            (q++)->uc = *p++;
+            continue;
         }
+        unsigned int cp = decodeChar(p, end);
+        if (cp >= 0x10000) {
+            cp -= 0x10000;
+            (q++)->uc = 0xd800 | (cp >> 10);
+            (q++)->uc = 0xdc00 | (cp & 0x3ff);
+        } else (q++)->uc = cp;
     }
-    return escaped;
+    for (int i = 0; i < KJS::Lexer::padding; ++i)
+        q[i].uc = 0;
+
+    return KJS::UString(code, q - code, false);
+}
+
+/**
+ * @short return offset of decoded char in UTF-8 source.
+ * @param data source.
+ * @param size size of source.
+ * @param pos index of char in string returned by decode().
+ * @return offset of char in source.
+ */
+std::size_t offsetOf(const char *data, std::size_t size, int pos) {
+    const unsigned char *begin = reinterpret_cast<const unsigned char *>(data);
+    const unsigned char *end = begin + size;
+    const unsigned char *p = begin;
+    if (hasBom(data, size))
+        p += 3;
+
+    while ((pos > 0) && (p != end)) {
+        if (*p < 0x80) {
+            ++p;
+            --pos;
+        } else pos -= (decodeChar(p, end) >= 0x10000)? 2: 1;
+    }
+    return p - begin;
+}
+
+/**
+ * @short encode kjs string to UTF-8.
+ * @param str string to encode.
+ * @return encoded string.
+ */
+std::string utf8(const KJS::UString &str) {
+    std::string encoded;
+    encoded.reserve(str.size());
+    StringBuffer_t buffer(encoded);
+    const KJS::UChar *p = str.data();
+    const KJS::UChar *end = p + str.size();
+    while (p != end)
+        encodeChar(buffer, p, end);
+    return encoded;
+}
+
+/**
+ * @short dump kjs string to stream encoded to UTF-8.
+ * @param os output stream.
+ * @param str string to dump.
+ */
+void dump(std::ostream &os, const KJS::UString &str) {
+    Buffer_t buffer(os);
+    dumpString(buffer, str);
+}
+
+/**
+ * @short dump kjs string to buffer encoded to UTF-8.
+ * @param out output buffer.
+ * @param str string to dump.
+ */
+void dump(Output_t &out, const KJS::UString &str) {
+    dumpString(out, str);
+}
+
+/**
+ * @short dump escaped kjs string to stream encoded to UTF-8.
+ * @param os output stream.
+ * @param escaped string to escape and dump.
+ */
+void dump(std::ostream &os, const Escaped_t &escaped) {
+    Buffer_t buffer(os);
+    dumpEscaped(buffer, escaped);
+}
+
+/**
+ * @short dump escaped kjs string to buffer encoded to UTF-8.
+ * @param out output buffer.
+ * @param escaped string to escape and dump.
+ */
+void dump(Output_t &out, const Escaped_t &escaped) {
+    dumpEscaped(out, escaped);
 }
 
@@ -21,13 +21,94 @@
 #define UTIL_H
 
 #include <string>
+#include <ostream>
+#include <cstddef>
+
+namespace KJS {
+    class UString;
+}
+class Output_t;
 
 /**
- * @short escape string.
+ * @short kjs string which should be escaped when dumped.
+ */
+struct Escaped_t {
+    /**
+     * @short create new escaped string.
+     * @param str string to escape.
+     */
+    explicit Escaped_t(const KJS::UString &str)
+        : str(str)
+    {}
+
+    const KJS::UString &str; //< string to escape.
+};
+
+/**
+ * @short mark string for escaping.
  * @param str string to escape.
  * @return escaped string.
  */
-std::string escape(const std::string &str);
+inline Escaped_t escape(const KJS::UString &str) { return Escaped_t(str);}
+
+/**
+ * @short decode UTF-8 source to kjs string.
+ *
+ * Leading byte order mark is skipped. Bytes which are not part of valid
+ * UTF-8 sequence are decoded to U+DC80..U+DCFF (lone low surrogates) and
+ * encoded back to the same bytes by dump(), so any input survives. The
+ * string data is followed by the zero padding the kjs lexer requires, so
+ * it can be passed to KJS::Parser::parse() as is.
+ *
+ * @param data source.
+ * @param size size of source.
+ * @return kjs string.
+ */
+KJS::UString decode(const char *data, std::size_t size);
+
+/**
+ * @short return offset of decoded char in UTF-8 source.
+ * @param data source.
+ * @param size size of source.
+ * @param pos index of char in string returned by decode().
+ * @return offset of char in source.
+ */
+std::size_t offsetOf(const char *data, std::size_t size, int pos);
+
+/**
+ * @short encode kjs string to UTF-8.
+ * @param str string to encode.
+ * @return encoded string.
+ */
+std::string utf8(const KJS::UString &str);
+
+/**
+ * @short dump kjs string to stream encoded to UTF-8.
+ * @param os output stream.
+ * @param str string to dump.
+ */
+void dump(std::ostream &os, const KJS::UString &str);
+
+/**
+ * @short dump kjs string to buffer encoded to UTF-8.
+ * @param out output buffer.
+ * @param str string to dump.
+ */
+void dump(Output_t &out, const KJS::UString &str);
+
+/**
+ * @short dump escaped kjs string to stream encoded to UTF-8.
+ * @param os output stream.
+ * @param escaped string to escape and dump.
+ */
+void dump(std::ostream &os, const Escaped_t &escaped);
+
+/**
+ * @short dump escaped kjs string to buffer encoded to UTF-8.
+ * @param out output buffer.
+ * @param escaped string to escape and dump.
+ */
+void dump(Output_t &out, const Escaped_t &escaped);
 
 
 #endif /* UTIL_H */
@@ -0,0 +1,209 @@
+#!/bin/sh
+#
+# FILE             $Id$
+#
+# PROJECT          KHTML JavaScript compress utility
+#
+# DESCRIPTION      Regression tests - compress small inputs and check
+#                  exit status and output.
+#
+# AUTHOR           agent <agent@local>
+#
+#  LICENSE         see COPYING
+#
+# Copyright (C) Seznam.cz a.s. 2026
+# All Rights Reserved
+#
+# HISTORY
+#       2026-10-17 (agent)
+#                  First draft.
+#
+
+KJSCOMPRESS=${KJSCOMPRESS:-../src/kjscompress}
+failed=0
+
+# check name code status output [options]
+#   compress code (printf format) read from stdin, compare exit status and
+#   output with expected ones
+check() {
+    output=`printf "$2" | $KJSCOMPRESS $5 2>/dev/null`
+    status=$?
+    if [ "$status" != "$3" ] || [ "$output" != "$4" ]; then
+        echo "FAIL: $1: status $status, output: $output"
+        failed=`expr $failed + 1`
+    fi
+}
+
+# input ending inside of escape sequence must not be read past its end
+check "escape at end" 'var s = "abc\\' 1 ''
+check "hex escape at end" 'var s = "abc\\x' 1 ''
+check "unicode escape at end" 'var s = "abc\\u' 1 ''
+check "string at end" 'var s = "abc' 1 ''
+
+# NUL is not end of input
+check "nul" 'var a=1;\0 var b=2;' 1 ''
+
+# constants are folded inside of the node arena
+check "folded addition" 'x = 1 + 2;' 0 '{x=3;}'
+check "folded subtraction" 'x = 5 - true;' 0 '{x=4;}'
+
+# operators next to operands starting or ending with the same char are
+# kept apart, other tokens glue
+check "minus negate" 'x=a - -b;' 0 '{x=a- -b;}'
+check "plus plus" 'x=a + +b, y=a + ++b*c, z=- --a;' 0 '{x=a+ +b,y=a+ ++b*c,z=- --a;}'
+check "postfix" 'x=a++ + b, y=a++ * b;' 0 '{x=a++ +b,y=a++*b;}'
+check "divide regexp" 'x=a / /re/;' 0 '{x=a/ /re/;}'
+check "html comment" 'x=a < !--b, y=a < !b;' 0 '{x=a< !--b,y=a<!b;}'
+check "integer member" 'x=1 .x, y=1.5 .x;' 0 '{x=1 .x,y=1.5.x;}'
+
+# shift assignments are single tokens in both formats
+check "shift assign" 'x>>>=1;y<<=2;z>>=3;' 0 '{x>>>=1;y<<=2;z>>=3;}'
+check "pretty shift assign" 'x>>>=1;y<<=2;z>>=3;' 0 '
+{
+    x >>>= 1;
+    y <<= 2;
+    z >>= 3;
+}' -d
+
+# both formats are written by one emitter, clauses stay in source order
+check "pretty switch" 'switch(a){case 1:b=1;default:c();case 2:break}' 0 '
+{
+    switch(a) {
+        case 1:
+            b = 1;
+        default:
+            c();
+        case 2:
+            break;
+    }
+}' -d
+check "pretty for in" 'for(var k in o)x-=-y;if(a)b();else{c()}' 0 '
+{
+    for (var k in o)
+        x -=  - y;
+    if (a)
+        b();
+    else
+        {
+            c();
+        }
+}' -d
+
+# Latin-1 letters in identifiers are accepted and kept byte for byte
+check "latin-1 identifier" 'var \351=1;\351+=caf\351;' 0 "`printf '{var \351=1;\351+=caf\351;}'`"
+check "latin-1 identifier obfuscated" 'var \351=1;\351+=caf\351;' 0 \
+    '{var __0=1;__0+=__1;}' -o
+
+# other Latin-1 bytes keep their classes: NBSP is blank, x and / signs and
+# bytes below 0xC0 are no letters
+check "latin-1 nbsp" 'var\240x=1;' 0 '{var x=1;}'
+check "latin-1 multiplication sign" 'x=a\327b;' 1 ''
+check "latin-1 control byte" 'var x\223=1;' 1 ''
+
+# "char N" of parse errors is the byte offset in the input, BOM included
+errchar() {
+    output=`printf "$2" | $KJSCOMPRESS 2>&1 >/dev/null | grep '^ERR:'`
+    if [ "$output" != "ERR: Parse error at line 2 and char $3" ]; then
+        echo "FAIL: $1: $output"
+        failed=`expr $failed + 1`
+    fi
+}
+errchar "error offset" 'var s = "\303\251";\n)' 15
+errchar "error offset after bom" '\357\273\277var s = "\303\251";\n)' 18
+
+# batch name options
+#   transform the same input by many jobs on several threads, every output
+#   must equal the single job one; in tree configured with --enable-tsan
+#   any data race reported by thread sanitizer fails the run
+batch() {
+    for i in 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16; do
+        echo "$tmp/in.js $tmp/out$i.js"
+    done > $tmp/manifest
+    $KJSCOMPRESS $2 -f $tmp/in.js -t $tmp/single.js 2>/dev/null \
+        && $KJSCOMPRESS $2 -j 4 -m $tmp/manifest 2>$tmp/err
+    status=$?
+    for i in 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16; do
+        [ "$status" != 0 ] || cmp -s $tmp/single.js $tmp/out$i.js || status=diff
+    done
+    if [ "$status" != 0 ]; then
+        echo "FAIL: $1: status $status"
+        cat $tmp/err
+        failed=`expr $failed + 1`
+    fi
+}
+
+TSAN_OPTIONS="halt_on_error=1 $TSAN_OPTIONS"
+export TSAN_OPTIONS
+tmp=`mktemp -d` || exit 1
+trap 'rm -rf $tmp' EXIT
+
+# answers of -a are replayed without -a, "n" identifiers are kept
+printf 'n foo\ny bar\n' > $tmp/decisions
+check "replayed answers" 'var foo=1,bar=2,baz=3;' 0 \
+    '{var foo=1,__0=2,__1=3;}' "-o -r $tmp/decisions"
+
+cat > $tmp/in.js <<'EOF'
+var names = ["a", "", 'b\n'], count = 0;
+function walk(obj, depth) {
+    var key, result = {};
+    for (key in obj) {
+        if (typeof obj[key] == "object" && depth > 0)
+            result[key] = walk(obj[key], depth - 1);
+        else
+            result[key] = String(obj[key]) + "";
+    }
+    label: while (count++ < 10) {
+        switch (count % 3) {
+        case 0: continue label;
+        case 1: break;
+        default: count >>>= 0;
+        }
+    }
+    return result;
+}
+walk({x: {y: 1, "z": [1, 2, , 3]}, w: null}, 2);
+EOF
+batch "batch" ''
+batch "batch obfuscated" -o
+batch "batch decompressed" -d
+
+# rss jobs
+#   print peak resident memory (kB) of batch of given number of jobs; the
+#   input of the last job is fifo, the batch waits there until we look
+rss() {
+    i=1
+    while [ $i -lt $1 ]; do
+        echo "$tmp/big.js $tmp/out.js"
+        i=`expr $i + 1`
+    done > $tmp/manifest
+    echo "$tmp/fifo $tmp/out.js" >> $tmp/manifest
+    exec 3<>$tmp/fifo
+    $KJSCOMPRESS -o -j 1 -m $tmp/manifest >/dev/null 2>&1 3>&- &
+    until ls -l /proc/$!/fd 2>/dev/null | grep -q fifo; do
+        kill -0 $! 2>/dev/null || break
+        sleep 1
+    done
+    sed -n 's/^VmHWM:[^0-9]*\([0-9]*\).*/\1/p' /proc/$!/status 2>/dev/null
+    echo 'var x;' >&3
+    exec 3>&-
+    wait $!
+}
+
+# parse trees of finished jobs are released, memory must not grow with
+# number of jobs
+if [ -r /proc/self/status ] && mkfifo $tmp/fifo 2>/dev/null; then
+    i=0
+    while [ $i -lt 40 ]; do
+        cat $tmp/in.js
+        i=`expr $i + 1`
+    done > $tmp/big.js
+    rss100=`rss 100`
+    rss400=`rss 400`
+    if [ -z "$rss100" ] || [ -z "$rss400" ] \
+        || [ `expr $rss400 - $rss100` -gt 1024 ]; then
+        echo "FAIL: batch rss: 100 jobs ${rss100}kB, 400 jobs ${rss400}kB"
+        failed=`expr $failed + 1`
+    fi
+fi
+
+[ $failed = 0 ] || exit 1